@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Facility data throughput for a ConnectionPool of 1, 2, 4, and 8 connections, fetching the airport records of the
+// first airports in the facility cache. Needs a running simulator.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection_pool.hpp>
+#include <simconnect/windows_event_connection.hpp>
+#include <simconnect/windows_event_handler.hpp>
+#include <simconnect/requests/facility_handler.hpp>
+#include <simconnect/requests/facility_list_handler.hpp>
+#include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/airport.hpp>
+
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+
+namespace {
+
+using BenchConnection = WindowsEventConnection<false>;
+using BenchHandler = WindowsEventHandler<false>;
+using BenchPool = ConnectionPool<BenchConnection, BenchHandler>;
+
+
+std::vector<std::pair<std::string, std::string>> listCachedAirports(std::size_t maxCount) {
+    std::vector<std::pair<std::string, std::string>> airports;
+
+    BenchConnection connection("BenchConnectionPool-list");
+    BenchHandler handler(connection);
+    if (!connection.open()) {
+        return airports;
+    }
+    FacilityListHandler<BenchHandler> facilityLists(handler);
+    bool done{ false };
+    auto request = facilityLists.listAirports(FacilitiesListScope::cacheOnly,
+        [&airports, maxCount](std::string_view ident, std::string_view region, const AirportDetails&) {
+            if (airports.size() < maxCount) {
+                airports.emplace_back(ident, region);
+            }
+        },
+        [&done]() { done = true; });
+    handler.handleUntilOrTimeout([&done]() { return done; }, 60s);
+    connection.close();
+
+    return airports;
+}
+
+
+double fetchAll(std::size_t connections, const std::vector<std::pair<std::string, std::string>>& airports) {
+    static constexpr std::size_t builderSize{ 64 };
+    const auto builder = Facilities::Builder<builderSize>()
+        .airport()
+            .latitude()
+            .longitude()
+            .altitude()
+        .end();
+
+    BenchPool pool("BenchConnectionPool", { .connections = connections, .maxInFlight = 16 });
+    std::vector<FacilityDefinitionId> defIds(connections);
+    pool.onConnected([&builder, &defIds](BenchPool::Worker& worker) {
+        auto workerBuilder = builder;
+        defIds[worker.index()] = worker.requestHandler<FacilityHandler>().buildDefinition(workerBuilder);
+    });
+    std::size_t records{ 0 };
+
+    const auto start = std::chrono::steady_clock::now();
+    pool.start();
+    for (const auto& [ident, region] : airports) {
+        pool.submit([&pool, &defIds, &records, &ident, &region](BenchPool::Worker& worker, BenchPool::JobDone done) {
+            return worker.requestHandler<FacilityHandler>().requestFacilityData(defIds[worker.index()], ident, region,
+                [&pool, &records](const Messages::FacilityDataMsg&) { pool.deliver([&records]() { ++records; }); },
+                done,
+                [done](const Messages::FacilityMinimalListMsg&) { done(); });
+        });
+    }
+    if (!pool.waitIdle(10min)) {
+        std::cerr << std::format("{} connection(s): not all requests finished.\n", connections);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    pool.stop();
+
+    if (records < airports.size()) {
+        std::cerr << std::format("{} connection(s): received {} of {} airport records.\n", connections, records, airports.size());
+    }
+    return elapsed.count();
+}
+
+} // namespace
+
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 2'000;
+
+    const auto airports = listCachedAirports(count);
+    if (airports.empty()) {
+        std::cerr << "This benchmark needs a running simulator.\n";
+        return 1;
+    }
+    std::cout << std::format("Fetching {} airports\n", airports.size());
+
+    for (const std::size_t connections : { 1, 2, 4, 8 }) {
+        const auto seconds = fetchAll(connections, airports);
+        std::cout << std::format("{} connection(s): {:8.3f} s, {:8.1f} airports/s\n",
+                                 connections, seconds, static_cast<double>(airports.size()) / seconds);
+    }
+    return 0;
+}
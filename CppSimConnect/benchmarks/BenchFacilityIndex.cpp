@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Query times of a FacilityIndex over a world-wide sized set of random facilities, against a linear scan.
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/facility_index.hpp>
+
+
+using namespace SimConnect;
+
+
+namespace {
+
+constexpr std::size_t facilities{ 300'000 };
+constexpr std::size_t queries{ 10'000 };
+
+
+template <class F>
+double measure(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+
+int main()
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0);
+    std::uniform_real_distribution<double> lon(-180.0, 180.0);
+
+    FacilityIndexBuilder builder;
+    builder.reserve(facilities);
+    for (std::size_t i = 0; i < facilities; ++i) {
+        builder.add((i % 8 == 0) ? FacilityListTypes::airport : FacilityListTypes::waypoint, std::format("F{}", i), "XX",
+                    LatLonAlt{ .latitude = lat(random), .longitude = lon(random), .altitude = 0.0 });
+    }
+    FacilityIndex index;
+    const auto buildTime = measure([&] { index = builder.build(); });
+    std::cout << std::format("build of {} facilities: {:10.1f} us\n", facilities, buildTime);
+
+    std::vector<std::pair<double, double>> positions;
+    for (std::size_t i = 0; i < queries; ++i) {
+        positions.emplace_back(lat(random), lon(random));
+    }
+
+    std::size_t found{ 0 };
+    const auto nearest = measure([&] {
+        for (const auto& [la, lo] : positions) {
+            found += index.nearest(la, lo, 10).size();
+        }
+    });
+    const auto nearestAirport = measure([&] {
+        for (const auto& [la, lo] : positions) {
+            found += index.nearest(la, lo, 1, FacilityListTypes::airport).size();
+        }
+    });
+    const auto radius = measure([&] {
+        for (const auto& [la, lo] : positions) {
+            found += index.within(la, lo, 50'000.0).size();
+        }
+    });
+    const auto box = measure([&] {
+        for (const auto& [la, lo] : positions) {
+            found += index.inBox(la - 0.5, lo - 0.5, la + 0.5, lo + 0.5).size();
+        }
+    });
+    const auto linear = measure([&] {
+        for (std::size_t i = 0; i < 100; ++i) {
+            double best{ 1e300 };
+            for (const auto& entry : index.entries()) {
+                best = std::min(best, FacilityIndex::distance(positions[i].first, positions[i].second, entry.position.latitude, entry.position.longitude));
+            }
+            found += (best < 1e300) ? 1 : 0;
+        }
+    });
+
+    std::cout << std::format("10 nearest:        {:8.3f} us/query\n", nearest / queries)
+              << std::format("nearest airport:   {:8.3f} us/query\n", nearestAirport / queries)
+              << std::format("within 50 km:      {:8.3f} us/query\n", radius / queries)
+              << std::format("1 degree box:      {:8.3f} us/query\n", box / queries)
+              << std::format("linear nearest:    {:8.3f} us/query\n", linear / 100)
+              << std::format("({} results)\n", found);
+
+    return 0;
+}
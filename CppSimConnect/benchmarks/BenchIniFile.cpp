@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Load times of IniFile over the aircraft.cfg and sim.cfg files of a Community folder, against the std::getline and
+// std::map based parser it replaced. Pass the folder as the first argument, or a folder of generated files is used.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <simconnect/ai/simobjects/ini_file.hpp>
+
+
+using namespace SimConnect::AI;
+
+
+namespace {
+
+constexpr std::size_t generatedFiles{ 2'000 };
+constexpr int rounds{ 5 };
+
+
+// The previous IniFile, as the baseline.
+class LegacyIniFile {
+    std::map<std::string, std::map<std::string, std::string>> sections_;
+
+public:
+    void load(const std::filesystem::path& path) {
+        std::ifstream in(path);
+        std::string currentSection;
+        for (std::string line{}; std::getline(in, line); ) {
+            line = trim(line);
+            auto endPos = line.size();
+            if (const auto posSemi = line.find(';'); posSemi != std::string::npos) {
+                endPos = posSemi;
+            }
+            if (const auto posDbl = line.find("//"); posDbl != std::string::npos && posDbl < endPos) {
+                endPos = posDbl;
+            }
+            line = trim(line.substr(0, endPos));
+            if (line.empty()) {
+                continue;
+            }
+            if (line.front() == '[' && line.back() == ']') {
+                currentSection = toLower(trim(line.substr(1, line.size() - 2), true));
+                sections_.try_emplace(currentSection);
+                continue;
+            }
+            const auto eq = line.find('=');
+            if (eq == std::string::npos) {
+                continue;
+            }
+            sections_[currentSection][toLower(trim(line.substr(0, eq)))] = trim(line.substr(eq + 1), true);
+        }
+    }
+
+    [[nodiscard]]
+    std::optional<std::string> get(const std::string& section, const std::string& key) const {
+        const auto sec = sections_.find(section);
+        if (sec == sections_.end()) {
+            return std::nullopt;
+        }
+        const auto it = sec->second.find(toLower(key));
+        return (it != sec->second.end()) ? std::optional<std::string>{ it->second } : std::nullopt;
+    }
+};
+
+
+template <class F>
+double measure(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+
+std::vector<std::filesystem::path> findCfgFiles(const std::filesystem::path& community) {
+    std::vector<std::filesystem::path> files;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(community, std::filesystem::directory_options::skip_permission_denied, ec);
+         it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (ec) {
+            break;
+        }
+        const auto name = it->path().filename();
+        if (((name == "aircraft.cfg") || (name == "sim.cfg")) && it->is_regular_file(ec)) {
+            files.push_back(it->path());
+        }
+    }
+    return files;
+}
+
+
+std::vector<std::filesystem::path> generate(const std::filesystem::path& root) {
+    std::vector<std::filesystem::path> files;
+    std::filesystem::create_directories(root);
+    for (std::size_t i = 0; i < generatedFiles; ++i) {
+        const auto file = root / std::format("aircraft{:05}.cfg", i);
+        std::ofstream out(file);
+        out << "[VERSION]\nmajor = 1\nminor = 0\n\n[GENERAL]\ncategory = \"Airplane\"\nperformance = \"Generated\"\n\n";
+        for (std::size_t j = 0; j < 4; ++j) {
+            out << std::format("[FLTSIM.{}]\ntitle = \"Aircraft {} livery {}\" ; generated\nmodel = \"\"\ntexture = \"{}\"\n\n", j, i, j, j);
+        }
+        for (std::size_t j = 0; j < 40; ++j) {
+            out << std::format("[SECTION.{}]\nkey{} = {}\nother{} = \"value {}\"\n", j, j, j, j, j);
+        }
+        files.push_back(file);
+    }
+    return files;
+}
+
+} // namespace
+
+
+int main(int argc, const char* argv[])
+{
+    const auto generatedRoot = std::filesystem::temp_directory_path() / "BenchIniFile";
+    const bool community = (argc > 1);
+    const auto files = community ? findCfgFiles(argv[1]) : generate(generatedRoot);   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (files.empty()) {
+        std::cerr << "No aircraft.cfg or sim.cfg files found.\n";
+        return 1;
+    }
+
+    std::size_t found{ 0 };
+    double legacy{ 1e300 };
+    double mapped{ 1e300 };
+    for (int round = 0; round < rounds; ++round) {
+        legacy = std::min(legacy, measure([&] {
+            for (const auto& file : files) {
+                LegacyIniFile ini;
+                ini.load(file);
+                found += ini.get("general", "category").has_value() ? 1 : 0;
+            }
+        }));
+        mapped = std::min(mapped, measure([&] {
+            for (const auto& file : files) {
+                IniFile ini;
+                ini.load(file);
+                found += ini.view("general", "category").has_value() ? 1 : 0;
+            }
+        }));
+    }
+
+    std::cout << std::format("{} files from {}\n", files.size(), community ? argv[1] : "generated folder")   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+              << std::format("getline and map:   {:8.1f} ms, {:6.1f} us/file\n", legacy, legacy * 1000.0 / static_cast<double>(files.size()))
+              << std::format("memory-mapped:     {:8.1f} ms, {:6.1f} us/file\n", mapped, mapped * 1000.0 / static_cast<double>(files.size()))
+              << std::format("({} categories)\n", found);
+
+    if (!community) {
+        std::filesystem::remove_all(generatedRoot);
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput of JsonCursor and JsonWriter on the kind of messages an EFB or toolbar panel sends over
+// the CommBus, with the std::regex approach the 13-4 sample used before as a baseline.
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/util/json_cursor.hpp>
+#include <simconnect/util/json_writer.hpp>
+
+
+using namespace SimConnect;
+
+
+namespace {
+
+const std::vector<std::string_view> efbMessages{
+    R"({"message": "Hello from the toolbar", "flag": true})",
+    R"({"type": "weights", "aircraft": {"icao": "A20N", "registration": "PH-EFB"},
+        "payload": [{"station": "pax", "kg": 7560.5}, {"station": "cargo", "kg": 1200}, {"station": "fuel", "kg": 8400}],
+        "final": true, "note": null})",
+    R"({"type": "route", "origin": "EHAM", "destination": "LFPG", "cruise": 36000,
+        "waypoints": ["ANDIK", "REFSO", "NIK", "HELEN", "DENUT", "KOK", "CMB", "BUB", "LESDO", "ATREX"],
+        "remarks": "PBN/A1B1C1D1O1S1 DOF/261018 \"escaped\" text"})",
+};
+
+constexpr std::size_t iterations{ 200'000 };
+volatile std::size_t sink{ 0 };
+
+
+template <class F>
+void measure(std::string_view name, std::size_t bytesPerIteration, F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        body();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto nsPerIteration = elapsed.count() * 1e9 / static_cast<double>(iterations);
+    const auto mbPerSecond = static_cast<double>(bytesPerIteration * iterations) / elapsed.count() / 1e6;
+    std::cout << std::format("{:<28} {:>10.1f} ns/iter {:>10.1f} MB/s\n", name, nsPerIteration, mbPerSecond);
+}
+
+} // namespace
+
+
+int main()
+{
+    std::size_t totalBytes{ 0 };
+    for (const auto msg : efbMessages) {
+        totalBytes += msg.size();
+    }
+
+    measure("JsonCursor validate", totalBytes, [] {
+        for (const auto msg : efbMessages) {
+            sink = sink + (JsonCursor(msg).isValid() ? 1 : 0);
+        }
+    });
+
+    measure("JsonCursor lookup", totalBytes, [] {
+        const JsonCursor hello(efbMessages[0]);
+        sink = sink + (hello["flag"].asBool().value_or(false) ? 1 : 0) + hello["message"].raw().size();
+
+        const JsonCursor weights(efbMessages[1]);
+        double kg{ 0.0 };
+        for (const auto station : weights["payload"].elements()) {
+            kg += station["kg"].asNumber<double>().value_or(0.0);
+        }
+        sink = sink + static_cast<std::size_t>(kg);
+
+        const JsonCursor route(efbMessages[2]);
+        sink = sink + route["waypoints"].size() + (route["destination"].equals("LFPG") ? 1 : 0);
+    });
+
+    std::string text;
+    measure("JsonCursor appendTo", efbMessages[2].size(), [&text] {
+        text.clear();
+        (void)JsonCursor(efbMessages[2])["remarks"].appendTo(text);
+        sink = sink + text.size();
+    });
+
+    const std::regex pattern{ R"re("message"\s*:\s*"([^"]*)"\s*,\s*"flag"\s*:\s*(true|false))re" };
+    measure("std::regex (baseline)", efbMessages[0].size(), [&pattern] {
+        std::match_results<std::string_view::const_iterator> match;
+        sink = sink + (std::regex_search(efbMessages[0].cbegin(), efbMessages[0].cend(), match, pattern) ? 1 : 0);
+    });
+
+    JsonWriter writer(512);
+    measure("JsonWriter", efbMessages[1].size(), [&writer] {
+        writer.clear()
+            .beginObject()
+            .member("type", "weights")
+            .key("aircraft").beginObject().member("icao", "A20N").member("registration", "PH-EFB").endObject()
+            .key("payload").beginArray()
+                .beginObject().member("station", "pax").member("kg", 7560.5).endObject()
+                .beginObject().member("station", "cargo").member("kg", 1200).endObject()
+                .beginObject().member("station", "fuel").member("kg", 8400).endObject()
+            .endArray()
+            .member("final", true)
+            .member("note", nullptr)
+            .endObject();
+        sink = sink + writer.view().size();
+    });
+
+    return 0;
+}
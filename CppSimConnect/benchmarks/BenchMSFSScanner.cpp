@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Scan times of an MSFSScanner over a generated Community folder: on one thread, on all threads, and from its cache.
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/ai/simobjects/msfs_scanner.hpp>
+
+
+using namespace SimConnect;
+using namespace SimConnect::AI;
+
+
+namespace {
+
+constexpr std::size_t packages{ 2'000 };
+constexpr std::size_t liveriesPerPackage{ 4 };
+
+
+template <class F>
+double measure(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+
+void generate(const std::filesystem::path& community) {
+    for (std::size_t i = 0; i < packages; ++i) {
+        const auto dir = community / std::format("package-{:05}", i) / "SimObjects" / "Airplanes" / std::format("Aircraft{:05}", i);
+        std::filesystem::create_directories(dir);
+        std::ofstream out(dir / "aircraft.cfg");
+        out << "[VERSION]\nmajor = 1\nminor = 0\n\n[GENERAL]\ncategory = \"Airplane\"\nperformance = \"Generated\"\n\n";
+        for (std::size_t j = 0; j < liveriesPerPackage; ++j) {
+            out << std::format("[FLTSIM.{}]\ntitle = \"Aircraft {} livery {}\" ; generated\nmodel = \"\"\ntexture = \"{}\"\nui_variation = \"Livery {}\"\n\n", j, i, j, j, j);
+        }
+        for (std::size_t j = 0; j < 40; ++j) {
+            out << std::format("[SECTION.{}]\nkey{} = {}\n", j, j, j);
+        }
+    }
+}
+
+} // namespace
+
+
+int main()
+{
+    const auto root = std::filesystem::temp_directory_path() / "BenchMSFSScanner";
+    std::filesystem::remove_all(root);
+    generate(root / "Community");
+    const auto cacheFile = root / "scanner.cache";
+
+    std::size_t found{ 0 };
+    auto count = [&found](std::string_view, std::string_view) { ++found; };
+
+    const auto serial = measure([&] {
+        MSFSScanner<> scanner(MSFSScanConfig{ .roots = { root / "Community" }, .threads = 1 });
+        scanner.scan(SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT, count);
+    });
+    const auto parallel = measure([&] {
+        MSFSScanner<> scanner(MSFSScanConfig{ .roots = { root / "Community" }, .cacheFile = cacheFile });
+        scanner.scan(SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT, count);
+    });
+    const auto cached = measure([&] {
+        MSFSScanner<> scanner(MSFSScanConfig{ .roots = { root / "Community" }, .cacheFile = cacheFile });
+        scanner.scan(SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT, count);
+    });
+
+    std::cout << std::format("{} packages, {} titles per scan\n", packages, found / 3)
+              << std::format("1 thread:          {:8.1f} ms\n", serial)
+              << std::format("all threads:       {:8.1f} ms\n", parallel)
+              << std::format("from cache:        {:8.1f} ms\n", cached);
+
+    std::filesystem::remove_all(root);
+    return 0;
+}
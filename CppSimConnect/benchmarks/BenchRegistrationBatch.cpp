@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Startup latency of 1,000 registrations, made one call at a time and as a single RegistrationBatch.
+// Needs a running simulator, as the calls go to SimConnect.
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/registration_batch.hpp>
+#include <simconnect/windows_event_connection.hpp>
+#include <simconnect/windows_event_handler.hpp>
+
+
+using namespace SimConnect;
+
+
+namespace {
+
+using BenchConnection = WindowsEventConnection<true>;
+
+constexpr std::size_t registrations{ 1'000 };
+constexpr std::size_t perKind{ registrations / 4 };
+
+const std::vector<std::string> simVars{ "PLANE ALTITUDE", "PLANE LATITUDE", "PLANE LONGITUDE", "AIRSPEED INDICATED" };
+
+
+void registerOneByOne(BenchConnection& connection, unsigned long baseId) {
+    for (std::size_t i = 0; i < perKind; ++i) {
+        connection.mapClientEvent(connection.event(std::format("Bench.Single.{}.{}", baseId, i)));
+        connection.addDataDefinition(baseId + 1, simVars[i % simVars.size()], "", DataTypes::float64);
+        connection.addClientDataDefinition(baseId + 2, ClientDataType::float64);
+        connection.addToFacilityDefinition(baseId + 3 + static_cast<unsigned long>(i / 2), (i % 2 == 0) ? "OPEN AIRPORT" : "CLOSE AIRPORT");
+    }
+}
+
+
+void registerBatched(BenchConnection& connection, unsigned long baseId) {
+    RegistrationBatch batch(registrations);
+    for (std::size_t i = 0; i < perKind; ++i) {
+        batch.mapClientEvent(connection.event(std::format("Bench.Batch.{}.{}", baseId, i)))
+            .addDataDefinition(baseId + 1, simVars[i % simVars.size()], "", DataTypes::float64)
+            .addClientDataDefinition(baseId + 2, ClientDataType::float64)
+            .addToFacilityDefinition(baseId + 3 + static_cast<unsigned long>(i / 2), (i % 2 == 0) ? "OPEN AIRPORT" : "CLOSE AIRPORT");
+    }
+    connection.submit(batch);
+    if (batch.failed() > 0) {
+        std::cerr << std::format("{} batched registration(s) failed.\n", batch.failed());
+    }
+}
+
+
+template <class F>
+double measure(F&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+
+int main()
+{
+    BenchConnection connection("BenchRegistrationBatch");
+    if (!connection.open()) {
+        std::cerr << "This benchmark needs a running simulator.\n";
+        return 1;
+    }
+
+    constexpr int rounds{ 5 };
+    for (int round = 0; round < rounds; ++round) {
+        const auto baseId = static_cast<unsigned long>(10'000 + round * 2'000);
+        const auto single = measure([&] { registerOneByOne(connection, baseId); });
+        const auto batched = measure([&] { registerBatched(connection, baseId + 1'000); });
+        std::cout << std::format("round {}: {} registrations one by one {:8.3f} ms, batched {:8.3f} ms\n",
+                                 round + 1, registrations, single, batched);
+    }
+    connection.close();
+
+    return 0;
+}
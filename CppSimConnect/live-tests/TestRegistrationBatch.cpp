@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "live_connection.hpp"
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/registration_batch.hpp>
+
+#include <atomic>
+#include <chrono>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+
+//NOLINTBEGIN(readability-function-cognitive-complexity)
+
+// All entries of a valid batch are sent, each with its own SendId
+TEST(TestRegistrationBatch, SubmitRecordsSendIds) {
+    LiveTests::LiveConnection lc("RegistrationBatchSubmitTest");
+    ASSERT_TRUE(lc.openAndWait());
+
+    RegistrationBatch batch;
+    batch.mapClientEvent(lc.connection.event("Batch.TestEvent"))
+        .mapClientEvent(lc.connection.event("PARKING_BRAKES"))
+        .addDataDefinition(9001, "PLANE ALTITUDE", "feet", DataTypes::float64)
+        .addDataDefinition(9001, "TITLE", "", DataTypes::string256)
+        .addClientDataDefinition(9002, ClientDataType::float64);
+    EXPECT_EQ(batch.pending(), 5u);
+
+    lc.connection.submit(batch);
+
+    EXPECT_TRUE(lc.succeeded());
+    EXPECT_EQ(batch.pending(), 0u);
+    EXPECT_EQ(batch.failed(), 0u);
+    for (const auto& entry : batch.entries()) {
+        EXPECT_TRUE(entry.sent()) << entry.describe();
+        EXPECT_EQ(batch.find(entry.sendId), &entry) << entry.describe();
+    }
+
+    lc.close();
+}
+
+// An exception caused by a batched call is traced back to its entry
+TEST(TestRegistrationBatch, ExceptionIsAttributedToEntry) {
+    LiveTests::LiveConnection lc("RegistrationBatchExceptionTest");
+
+    RegistrationBatch batch;
+    std::atomic<const RegistrationBatch::Entry*> culprit{ nullptr };
+    lc.handler.registerHandler<Messages::ExceptionMsg>(Messages::exception, [&](const Messages::ExceptionMsg& ex) {
+        culprit = batch.find(ex);
+    });
+    ASSERT_TRUE(lc.openAndWait());
+
+    batch.addDataDefinition(9003, "PLANE ALTITUDE", "feet", DataTypes::float64)
+        .addDataDefinition(9003, "NO SUCH SIMVAR", "feet", DataTypes::float64)
+        .addDataDefinition(9003, "PLANE LATITUDE", "degrees", DataTypes::float64);
+    lc.connection.submit(batch);
+    ASSERT_TRUE(lc.succeeded());
+
+    EXPECT_TRUE(lc.waitUntil([&culprit]() { return culprit.load() != nullptr; }));
+    ASSERT_NE(culprit.load(), nullptr);
+    EXPECT_EQ(culprit.load()->name, "NO SUCH SIMVAR");
+
+    lc.close();
+}
+
+// Entries added after a submit are sent by the next submit only
+TEST(TestRegistrationBatch, ResubmitSendsOnlyNewEntries) {
+    LiveTests::LiveConnection lc("RegistrationBatchResubmitTest");
+    ASSERT_TRUE(lc.openAndWait());
+
+    RegistrationBatch batch;
+    batch.addToFacilityDefinition(9004, "OPEN AIRPORT");
+    lc.connection.submit(batch);
+    const auto firstSendId = batch.entries()[0].sendId;
+
+    batch.addToFacilityDefinition(9004, "LATITUDE")
+        .addToFacilityDefinition(9004, "CLOSE AIRPORT");
+    lc.connection.submit(batch);
+
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch.entries()[0].sendId, firstSendId);
+    EXPECT_GT(batch.entries()[1].sendId, firstSendId);
+    EXPECT_GT(batch.entries()[2].sendId, batch.entries()[1].sendId);
+
+    lc.close();
+}
+
+//NOLINTEND(readability-function-cognitive-complexity)
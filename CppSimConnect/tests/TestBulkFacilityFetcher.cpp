@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/requests/facility_handler.hpp>
+#include <simconnect/requests/bulk_facility_fetcher.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: records facility data requests in the send history, and dispatches the answers the test queues.
+class FetchMockConnection : public Connection<FetchMockConnection, false, NullLogger> {
+public:
+    struct Sent {
+        RequestId requestId;
+        SendId sendId;
+        std::string icao;
+    };
+
+private:
+    std::vector<std::vector<std::uint64_t>> messages_;
+    std::size_t messageIndex_{ 0 };
+    SendId nextSendId_{ 1 };
+
+    template <class T>
+    T& newMessage(MessageId id, std::size_t size = sizeof(T)) {
+        auto& buffer = messages_.emplace_back((size + 7) / 8);
+        auto& msg = *reinterpret_cast<T*>(buffer.data());
+        msg.dwID = static_cast<unsigned long>(id);
+        msg.dwSize = static_cast<unsigned long>(size);
+        msg.dwVersion = 1;
+        return msg;
+    }
+
+public:
+    std::vector<Sent> sent;
+    std::vector<Sent> pending;      ///< Sent and not yet answered.
+
+    FetchMockConnection& requestFacilityData(RequestId requestId, FacilityDefinitionId facilityDefId, std::string_view icaoCode, std::string_view = "") {
+        const auto sendId = nextSendId_++;
+        sendHistory().record(sendId, "SimConnect_RequestFacilityData", facilityDefId, icaoCode, requestId);
+        sent.push_back({ requestId, sendId, std::string(icaoCode) });
+        pending.push_back(sent.back());
+        return *this;
+    }
+
+    void answer(const Sent& request, bool withData = true) {
+        if (withData) {
+            auto& data = newMessage<Messages::FacilityDataMsg>(Messages::facilityData, sizeof(Messages::FacilityDataMsg) + 4);
+            data.UserRequestId = request.requestId;
+            data.UniqueRequestId = 1;
+            data.Type = FacilityDataTypes::airport;
+        }
+        newMessage<Messages::FacilityDataEndMsg>(Messages::facilityDataEnd).RequestId = request.requestId;
+    }
+
+    void raise(const Sent& request) {
+        auto& msg = newMessage<Messages::ExceptionMsg>(Messages::exception);
+        msg.dwSendID = request.sendId;
+        msg.dwException = 1;
+    }
+
+    std::vector<Sent> takePending() {
+        auto result = std::move(pending);
+        pending.clear();
+        return result;
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (messageIndex_ < messages_.size()) {
+            const auto& msg = messages_[messageIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(msg.data()), reinterpret_cast<const SIMCONNECT_RECV*>(msg.data())->dwSize);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+};
+
+using TestHandler = SimpleHandler<FetchMockConnection>;
+
+
+// A clock that only moves when the test says so.
+using FetchClock = ManualClock<struct FetchClockTag>;
+
+using TestFetcher = BulkFacilityFetcher<TestHandler, FetchClock>;
+
+
+// Scenario: Fetching many facilities through a bounded window
+// Given 40 airports and a fetcher starting with a window of 4
+// When the simulator answers every request well within the target latency
+// Then never more than the window is in flight, all airports reach the consumer, and the window grows
+TEST(BulkFacilityFetcherTests, WindowGrowsWhileAnswersAreFast) {
+    FetchMockConnection connection;
+    TestHandler handler(connection);
+    FacilityHandler<TestHandler> facilities(handler);
+
+    std::vector<std::string> received;
+    TestFetcher fetcher(handler, facilities, 1, [&received](std::string_view icao, std::string_view, FacilityTree tree) {
+        EXPECT_EQ(tree.nodeCount(), 1U);
+        received.emplace_back(icao);
+    }, nullptr, { .initialWindow = 4, .targetLatency = 100ms });
+
+    for (int i = 0; i < 40; ++i) {
+        fetcher.add(std::format("K{:03}", i));
+    }
+    fetcher.pump();
+    EXPECT_EQ(connection.sent.size(), 4U);
+    EXPECT_EQ(fetcher.progress().inFlight, 4U);
+
+    while (!connection.pending.empty()) {
+        EXPECT_LE(connection.pending.size(), fetcher.window());
+        FetchClock::advance(10ms);
+        for (const auto& request : connection.takePending()) {
+            connection.answer(request);
+        }
+        handler.handle();
+    }
+
+    const auto progress = fetcher.progress();
+    EXPECT_TRUE(progress.done());
+    EXPECT_EQ(received.size(), 40U);
+    EXPECT_EQ(progress.completed, 40U);
+    EXPECT_GT(progress.window, 4.0);
+    EXPECT_EQ(progress.averageLatency, 10ms);
+    EXPECT_GT(progress.throughput, 0.0);
+}
+
+
+// Scenario: Exceptions and timeouts
+// Given a fetcher with a window of 4 and two attempts per facility
+// When one request causes an exception and the others are never answered
+// Then the window is halved each time, failed requests are retried once, and reported as failed after the second attempt
+TEST(BulkFacilityFetcherTests, ExceptionsAndTimeoutsShrinkTheWindowAndRetry) {
+    FetchMockConnection connection;
+    TestHandler handler(connection);
+    FacilityHandler<TestHandler> facilities(handler);
+
+    std::vector<std::string> failed;
+    TestFetcher fetcher(handler, facilities, 1, nullptr, [&failed](std::string_view icao, std::string_view) { failed.emplace_back(icao); },
+                        { .initialWindow = 4, .timeout = 1s, .maxAttempts = 2 });
+    for (const auto* icao : { "EHAM", "EHRD", "EHEH", "EHGG" }) {
+        fetcher.add(icao);
+    }
+    fetcher.pump();
+    ASSERT_EQ(connection.sent.size(), 4U);
+
+    connection.raise(connection.sent[0]);
+    handler.handle();
+    EXPECT_EQ(fetcher.progress().exceptions, 1U);
+    EXPECT_EQ(fetcher.progress().retries, 1U);
+    EXPECT_EQ(fetcher.window(), 2U);
+
+    FetchClock::advance(2s);
+    fetcher.pump();
+    auto progress = fetcher.progress();
+    EXPECT_EQ(progress.timeouts, 3U);
+    EXPECT_EQ(progress.retries, 4U);
+    EXPECT_EQ(fetcher.window(), 1U);
+    EXPECT_EQ(progress.inFlight, 1U);
+
+    for (int i = 0; i < 4; ++i) {
+        FetchClock::advance(2s);
+        fetcher.pump();
+    }
+    progress = fetcher.progress();
+    EXPECT_TRUE(progress.done());
+    EXPECT_EQ(progress.failed, 4U);
+    EXPECT_EQ(failed, (std::vector<std::string>{ "EHAM", "EHRD", "EHEH", "EHGG" }));
+}
+
+
+// Scenario: Slow and empty answers
+// Given a fetcher with a window of 8
+// When answers arrive slower than the target latency, and one facility has no data
+// Then the window shrinks, and the facility without data is reported as failed without retrying
+TEST(BulkFacilityFetcherTests, SlowAnswersShrinkTheWindow) {
+    FetchMockConnection connection;
+    TestHandler handler(connection);
+    FacilityHandler<TestHandler> facilities(handler);
+
+    std::size_t received{ 0 };
+    std::vector<std::string> failed;
+    TestFetcher fetcher(handler, facilities, 1, [&received](std::string_view, std::string_view, FacilityTree) { ++received; },
+                        [&failed](std::string_view icao, std::string_view) { failed.emplace_back(icao); },
+                        { .initialWindow = 8, .targetLatency = 100ms });
+    fetcher.add("XXXX");
+    for (int i = 0; i < 7; ++i) {
+        fetcher.add(std::format("K{:03}", i));
+    }
+    fetcher.pump();
+
+    FetchClock::advance(500ms);
+    auto requests = connection.takePending();
+    ASSERT_EQ(requests.size(), 8U);
+    connection.answer(requests[0], false);
+    for (std::size_t i = 1; i < requests.size(); ++i) {
+        connection.answer(requests[i]);
+    }
+    handler.handle();
+
+    const auto progress = fetcher.progress();
+    EXPECT_TRUE(progress.done());
+    EXPECT_EQ(received, 7U);
+    EXPECT_EQ(failed, (std::vector<std::string>{ "XXXX" }));
+    EXPECT_EQ(progress.retries, 0U);
+    EXPECT_LT(progress.window, 8.0);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/comm_bus_handler.hpp>
+#include <simconnect/comm_bus_channel.hpp>
+
+using namespace SimConnect;
+
+#if MSFS_2024_SDK
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: a loop-back CommBus. Every callCommBusEvent is queued as a CommBus message for each
+// subscription to that event name.
+class CommBusMockConnection {
+public:
+    using mutex_type = NoMutex;
+    using guard_type = NoGuard;
+    using logger_type = NullLogger;
+
+private:
+    std::deque<std::vector<char>> messages_;
+    size_t messageIndex_{0};
+    std::multimap<std::string, CommBusEventId> subscriptions_;
+    NullLogger logger_;
+
+public:
+    std::vector<std::string> sent;
+
+    void deliver(CommBusEventId id, std::string_view data) {
+        std::vector<char> buffer(sizeof(Messages::CommBusMsg) + data.size() + 1, '\0');
+        auto* msg = reinterpret_cast<Messages::CommBusMsg*>(buffer.data());
+        msg->dwID = static_cast<unsigned long>(Messages::commBus);
+        msg->dwSize = static_cast<unsigned long>(buffer.size());
+        msg->dwVersion = 1;
+        msg->uEventID = id;
+        msg->dwEntryNumber = 0;
+        msg->dwOutOf = 1;
+        std::memcpy(msg->rgData, data.data(), data.size());
+        messages_.push_back(std::move(buffer));
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (messageIndex_ < messages_.size()) {
+            const auto& msg = messages_[messageIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(msg.data()), static_cast<unsigned long>(msg.size()));
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+    void close() {}
+
+    CommBusMockConnection& subscribeToCommBusEvent(CommBusEventId id, std::string_view name) {
+        subscriptions_.emplace(std::string(name), id);
+        return *this;
+    }
+    CommBusMockConnection& unsubscribeFromCommBusEvent(CommBusEventId id) {
+        std::erase_if(subscriptions_, [id](const auto& entry) { return entry.second == id; });
+        return *this;
+    }
+    CommBusMockConnection& callCommBusEvent(std::string_view name, std::string_view data, CommBusBroadcastToFlag) {
+        sent.emplace_back(data);
+        auto [first, last] = subscriptions_.equal_range(std::string(name));
+        for (auto it = first; it != last; ++it) {
+            deliver(it->second, data);
+        }
+        return *this;
+    }
+
+    NullLogger& logger() noexcept { return logger_; }
+};
+
+using TestHandler = SimpleHandler<CommBusMockConnection>;
+
+
+// Scenario: Chunk header round trip
+// Given a chunk header
+// When it is written in front of a payload and parsed back
+// Then the header fields and the payload should be unchanged
+TEST(CommBusChannelTests, ChunkHeader_RoundTrip) {
+    const CommBusChunkHeader header{ 42, 3, 7 };
+    std::string frame;
+    header.appendTo(frame);
+    frame.append("a:b:c");
+
+    const auto parsed = CommBusChunkHeader::parse(frame);
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->first.sequence, 42U);
+    EXPECT_EQ(parsed->first.index, 3U);
+    EXPECT_EQ(parsed->first.count, 7U);
+    EXPECT_EQ(parsed->second, "a:b:c");
+}
+
+// Scenario: Parsing frames without a valid header
+// Given frames that lack a header, or have an index past the count
+// When they are parsed
+// Then parsing should fail
+TEST(CommBusChannelTests, ChunkHeader_RejectsInvalidFrames) {
+    EXPECT_FALSE(CommBusChunkHeader::parse("").has_value());
+    EXPECT_FALSE(CommBusChunkHeader::parse("{\"json\":1}").has_value());
+    EXPECT_FALSE(CommBusChunkHeader::parse("1:2:").has_value());
+    EXPECT_FALSE(CommBusChunkHeader::parse("1:2:2:data").has_value());
+    EXPECT_FALSE(CommBusChunkHeader::parse("1:0:0:").has_value());
+}
+
+// Scenario: Reusing pooled buffers
+// Given a buffer pool with one idle buffer
+// When a buffer is acquired, filled, and released again
+// Then the next acquire should return an empty buffer with the same storage
+TEST(CommBusChannelTests, BufferPool_ReusesStorage) {
+    CommBusBufferPool pool(1, 256);
+    ASSERT_EQ(pool.idle(), 1U);
+
+    auto buffer = pool.acquire();
+    EXPECT_EQ(pool.idle(), 0U);
+    EXPECT_GE(buffer.capacity(), 256U);
+    buffer.append("payload");
+    const auto* storage = buffer.data();
+    pool.release(std::move(buffer));
+
+    auto again = pool.acquire();
+    EXPECT_TRUE(again.empty());
+    EXPECT_EQ(again.data(), storage);
+}
+
+// Scenario: Streaming a large payload
+// Given a sending and a receiving channel on the same event name, with a small chunk size
+// When a payload spanning many chunks is sent
+// Then the receiver should get the payload once, intact, and all chunks should be acknowledged
+TEST(CommBusChannelTests, LargePayload_IsChunkedAndReassembled) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.chunkSize = 10;
+    config.window = 2;
+    CommBusChannel<TestHandler> sender(commBus, "test.stream", config);
+    CommBusChannel<TestHandler> receiver(commBus, "test.stream", config);
+
+    std::vector<std::string> received;
+    auto subscription = receiver.subscribe([&](std::string_view payload) { received.emplace_back(payload); });
+
+    std::string payload;
+    for (int i = 0; i < 10; ++i) {
+        payload.append("0123456789");
+    }
+    payload.append("tail");
+    sender.send(payload);
+    EXPECT_EQ(sender.inFlight(), 2U);
+
+    handler.handle();
+
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0], payload);
+    EXPECT_EQ(sender.sentChunks(), 11U);
+    EXPECT_EQ(sender.inFlight(), 0U);
+    EXPECT_EQ(sender.pending(), 0U);
+    EXPECT_EQ(receiver.droppedChunks(), 0U);
+}
+
+// Scenario: The flow-control window
+// Given a channel with a window of 3 whose acknowledgements never arrive
+// When a payload of 5 chunks is sent
+// Then only 3 chunks should go out until the window is reset
+TEST(CommBusChannelTests, Window_LimitsChunksInFlight) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.chunkSize = 4;
+    config.window = 3;
+    CommBusChannel<TestHandler> sender(commBus, "test.window", config);
+
+    sender.send("aaaabbbbccccddddeeee");
+
+    EXPECT_EQ(sender.sentChunks(), 3U);
+    EXPECT_EQ(sender.inFlight(), 3U);
+    EXPECT_EQ(sender.pending(), 1U);
+
+    sender.resetWindow();
+
+    EXPECT_EQ(sender.sentChunks(), 5U);
+    EXPECT_EQ(sender.pending(), 0U);
+}
+
+// Scenario: Sending without flow control
+// Given a channel with a window of 0
+// When a multi-chunk payload is sent
+// Then all chunks should be sent at once, and no acknowledgements should be sent by the receiver
+TEST(CommBusChannelTests, ZeroWindow_DisablesFlowControl) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.chunkSize = 4;
+    config.window = 0;
+    CommBusChannel<TestHandler> sender(commBus, "test.nowindow", config);
+    CommBusChannel<TestHandler> receiver(commBus, "test.nowindow", config);
+
+    std::string received;
+    auto subscription = receiver.subscribe([&](std::string_view payload) { received = payload; });
+
+    sender.send("aaaabbbbcc");
+    EXPECT_EQ(sender.sentChunks(), 3U);
+    EXPECT_EQ(sender.inFlight(), 0U);
+
+    handler.handle();
+
+    EXPECT_EQ(received, "aaaabbbbcc");
+    EXPECT_EQ(connection.sent.size(), 3U);
+}
+
+// Scenario: A lost chunk
+// Given a receiving channel
+// When the middle chunk of a message never arrives
+// Then the message should not be delivered, the out-of-order chunk should be counted as dropped,
+// And the next message should be delivered normally
+TEST(CommBusChannelTests, MissingChunk_DropsMessage) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.window = 0;
+    CommBusChannel<TestHandler> receiver(commBus, "test.lossy", config);
+
+    std::vector<std::string> received;
+    auto subscription = receiver.subscribe([&](std::string_view payload) { received.emplace_back(payload); });
+
+    connection.callCommBusEvent("test.lossy", "1:0:3:aa", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.lossy", "1:2:3:cc", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.lossy", "2:0:2:dd", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.lossy", "2:1:2:ee", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0], "ddee");
+    EXPECT_EQ(receiver.droppedChunks(), 1U);
+}
+
+// Scenario: A frame announcing an oversized message
+// Given a receiving channel with a maximum message size of 64 bytes
+// When the first chunk of a message claims a count that would exceed it
+// Then the chunk should be dropped without reserving a buffer for it, and its follow-up chunks should be dropped too
+TEST(CommBusChannelTests, OversizedMessage_IsDropped) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.window = 0;
+    config.maxMessageSize = 64;
+    CommBusChannel<TestHandler> receiver(commBus, "test.oversized", config);
+
+    std::vector<std::string> received;
+    auto subscription = receiver.subscribe([&](std::string_view payload) { received.emplace_back(payload); });
+
+    connection.callCommBusEvent("test.oversized", "1:0:4000000000:aaaaaaaa", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.oversized", "1:1:4000000000:bbbbbbbb", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.oversized", "2:0:2:cc", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.oversized", "2:1:2:dd", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0], "ccdd");
+    EXPECT_EQ(receiver.droppedChunks(), 2U);
+}
+
+// Scenario: Messages that lost a chunk
+// Given a receiving channel that keeps at most 2 partially received messages
+// When three messages each lose their last chunk
+// Then the oldest incomplete message should be evicted to make room, and its late chunk should be dropped
+TEST(CommBusChannelTests, IncompleteMessages_AreEvicted) {
+    CommBusMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    CommBusChannelConfig config;
+    config.window = 0;
+    config.maxIncoming = 2;
+    CommBusChannel<TestHandler> receiver(commBus, "test.evict", config);
+
+    std::vector<std::string> received;
+    auto subscription = receiver.subscribe([&](std::string_view payload) { received.emplace_back(payload); });
+
+    connection.callCommBusEvent("test.evict", "1:0:2:aa", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.evict", "2:0:2:bb", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.evict", "3:0:2:cc", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.evict", "1:1:2:AA", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("test.evict", "3:1:2:CC", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+
+    ASSERT_EQ(received.size(), 1U);
+    EXPECT_EQ(received[0], "ccCC");
+    EXPECT_EQ(receiver.evictedMessages(), 1U);
+    EXPECT_EQ(receiver.droppedChunks(), 1U);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-pro-type-reinterpret-cast)
+
+#endif // MSFS_2024_SDK
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/comm_bus_handler.hpp>
+#include <simconnect/comm_bus_router.hpp>
+
+using namespace SimConnect;
+
+#if MSFS_2024_SDK
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: a loop-back CommBus. Every callCommBusEvent is queued as a CommBus message for each
+// subscription to that event name.
+class CommBusRouterMockConnection {
+public:
+    using mutex_type = NoMutex;
+    using guard_type = NoGuard;
+    using logger_type = NullLogger;
+
+private:
+    std::deque<std::vector<char>> messages_;
+    size_t messageIndex_{0};
+    std::multimap<std::string, CommBusEventId> subscriptions_;
+    NullLogger logger_;
+
+public:
+    int subscribeCount{0};
+    int unsubscribeCount{0};
+
+    void deliver(CommBusEventId id, std::string_view data) {
+        std::vector<char> buffer(sizeof(Messages::CommBusMsg) + data.size() + 1, '\0');
+        auto* msg = reinterpret_cast<Messages::CommBusMsg*>(buffer.data());
+        msg->dwID = static_cast<unsigned long>(Messages::commBus);
+        msg->dwSize = static_cast<unsigned long>(buffer.size());
+        msg->dwVersion = 1;
+        msg->uEventID = id;
+        msg->dwEntryNumber = 0;
+        msg->dwOutOf = 1;
+        std::memcpy(msg->rgData, data.data(), data.size());
+        messages_.push_back(std::move(buffer));
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (messageIndex_ < messages_.size()) {
+            const auto& msg = messages_[messageIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(msg.data()), static_cast<unsigned long>(msg.size()));
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+    void close() {}
+
+    CommBusRouterMockConnection& subscribeToCommBusEvent(CommBusEventId id, std::string_view name) {
+        ++subscribeCount;
+        subscriptions_.emplace(std::string(name), id);
+        return *this;
+    }
+    CommBusRouterMockConnection& unsubscribeFromCommBusEvent(CommBusEventId id) {
+        ++unsubscribeCount;
+        std::erase_if(subscriptions_, [id](const auto& entry) { return entry.second == id; });
+        return *this;
+    }
+    CommBusRouterMockConnection& callCommBusEvent(std::string_view name, std::string_view data, CommBusBroadcastToFlag) {
+        auto [first, last] = subscriptions_.equal_range(std::string(name));
+        for (auto it = first; it != last; ++it) {
+            deliver(it->second, data);
+        }
+        return *this;
+    }
+
+    NullLogger& logger() noexcept { return logger_; }
+};
+
+using TestHandler = SimpleHandler<CommBusRouterMockConnection>;
+
+
+// Scenario: Matching exact and prefix patterns
+// Given a trie with exact, prefix, and catch-all patterns
+// When an event name is matched
+// Then exactly the matching subscribers should be returned, in ID order
+TEST(CommBusRouterTests, Trie_MatchesExactAndPrefixPatterns) {
+    CommBusTopicTrie trie;
+    trie.insert("efb.weight", 1);
+    trie.insert("efb.*", 2);
+    trie.insert("*", 3);
+    trie.insert("efb.weights", 4);
+    trie.insert("toolbar.*", 5);
+
+    std::vector<CommBusTopicTrie::subscriber_id_type> matches;
+    trie.match("efb.weight", matches);
+    EXPECT_EQ(matches, (std::vector<CommBusTopicTrie::subscriber_id_type>{ 1, 2, 3 }));
+
+    matches.clear();
+    trie.match("efb", matches);
+    EXPECT_EQ(matches, (std::vector<CommBusTopicTrie::subscriber_id_type>{ 3 }));
+
+    matches.clear();
+    trie.erase("*", 3);
+    trie.match("toolbar.open", matches);
+    EXPECT_EQ(matches, (std::vector<CommBusTopicTrie::subscriber_id_type>{ 5 }));
+}
+
+// Scenario: Several subscribers for one event
+// Given a router
+// When three modules subscribe to the same event name
+// Then the simulator should see a single subscription
+// And every module should receive each broadcast once
+TEST(CommBusRouterTests, SameEvent_SubscribesOnceAndFansOut) {
+    CommBusRouterMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+    CommBusRouter<TestHandler> router(commBus);
+
+    std::vector<std::string> received;
+    auto reg1 = router.subscribe("efb.weight", [&](std::string_view, std::string_view payload) { received.emplace_back("1:" + std::string(payload)); });
+    auto reg2 = router.subscribe("efb.weight", [&](std::string_view, std::string_view payload) { received.emplace_back("2:" + std::string(payload)); });
+    auto reg3 = router.subscribe("efb.weight", [&](std::string_view, std::string_view payload) { received.emplace_back("3:" + std::string(payload)); });
+
+    connection.callCommBusEvent("efb.weight", "{}", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+
+    EXPECT_EQ(connection.subscribeCount, 1);
+    EXPECT_EQ(router.topicCount(), 1U);
+    EXPECT_EQ(received, (std::vector<std::string>{ "1:{}", "2:{}", "3:{}" }));
+}
+
+// Scenario: Prefix subscribers
+// Given a router with exact subscriptions to two events, and a prefix subscriber for both
+// When both events are broadcast
+// Then the prefix subscriber should receive both, with the event name
+// And should not cause a simulator subscription of its own
+TEST(CommBusRouterTests, PrefixSubscriber_ReceivesMatchingEvents) {
+    CommBusRouterMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+    CommBusRouter<TestHandler> router(commBus);
+
+    std::vector<std::string> names;
+    auto all = router.subscribe("efb.*", [&](std::string_view name, std::string_view) { names.emplace_back(name); });
+    auto fuel = router.listen("efb.fuel");
+    auto weight = router.subscribe("efb.weight", [](std::string_view, std::string_view) {});
+    auto other = router.listen("toolbar.open");
+
+    connection.callCommBusEvent("efb.fuel", "a", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("toolbar.open", "b", CommBusBroadcastTo::defaultFlag);
+    connection.callCommBusEvent("efb.weight", "c", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+
+    EXPECT_EQ(connection.subscribeCount, 3);
+    EXPECT_EQ(names, (std::vector<std::string>{ "efb.fuel", "efb.weight" }));
+}
+
+// Scenario: Unsubscribing
+// Given two subscribers for the same event
+// When the first one stops, the simulator subscription should remain
+// And when the second one stops, the router should unsubscribe from the simulator
+TEST(CommBusRouterTests, LastSubscriberStops_Unsubscribes) {
+    CommBusRouterMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+    CommBusRouter<TestHandler> router(commBus);
+
+    int firstCount{0};
+    int secondCount{0};
+    auto reg1 = router.subscribe("efb.weight", [&](std::string_view, std::string_view) { ++firstCount; });
+    auto reg2 = router.subscribe("efb.weight", [&](std::string_view, std::string_view) { ++secondCount; });
+
+    reg1.stop();
+    EXPECT_EQ(connection.unsubscribeCount, 0);
+
+    connection.callCommBusEvent("efb.weight", "{}", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+    EXPECT_EQ(firstCount, 0);
+    EXPECT_EQ(secondCount, 1);
+
+    reg2.stop();
+    EXPECT_EQ(connection.unsubscribeCount, 1);
+    EXPECT_EQ(router.topicCount(), 0U);
+    EXPECT_EQ(router.subscriberCount(), 0U);
+}
+
+// Scenario: Destroying the router
+// Given a router with a subscriber that is never stopped
+// When the router is destroyed and the event is broadcast afterwards
+// Then the router should have unsubscribed from the simulator, and the broadcast should not reach the subscriber
+TEST(CommBusRouterTests, Destruction_Unsubscribes) {
+    CommBusRouterMockConnection connection;
+    TestHandler handler(connection);
+    CommBusHandler<TestHandler> commBus(handler);
+
+    int count{0};
+    {
+        CommBusRouter<TestHandler> router(commBus);
+        auto reg = router.subscribe("efb.weight", [&](std::string_view, std::string_view) { ++count; });
+        reg.clearCleanup();
+    }
+    EXPECT_EQ(connection.unsubscribeCount, 1);
+
+    connection.callCommBusEvent("efb.weight", "{}", CommBusBroadcastTo::defaultFlag);
+    handler.handle();
+    EXPECT_EQ(count, 0);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-bounds-array-to-pointer-decay,cppcoreguidelines-pro-type-reinterpret-cast)
+
+#endif // MSFS_2024_SDK
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/command_queue.hpp>
+#include <simconnect/util/statefull_object.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Mock connection: records which thread made each call, and hands out increasing SendIds.
+class CommandMockConnection : public StateFullObject {
+    SendId lastSendId_{ 0 };
+
+public:
+    std::vector<int> values;
+    std::vector<std::thread::id> callers;
+
+    void send(int value) {
+        values.push_back(value);
+        callers.push_back(std::this_thread::get_id());
+        state(value < 0 ? value : 0);   // Negative values act as failed HRESULTs.
+        ++lastSendId_;
+    }
+
+    [[nodiscard]]
+    SendId fetchSendId() const { return succeeded() ? lastSendId_ : noId; }
+};
+
+
+// Scenario: Commands are executed in submission order by the draining thread
+// Given A command queue on a mock connection
+// When Three commands are submitted and the queue is drained
+// Then The commands run in order and the queue is empty afterwards
+TEST(TestCommandQueue, DrainExecutesInOrder) {
+    CommandMockConnection connection;
+    CommandQueue<CommandMockConnection> queue(connection);
+
+    for (int i = 1; i <= 3; ++i) {
+        EXPECT_TRUE(queue.submit([i](CommandMockConnection& conn) { conn.send(i); }));
+    }
+    EXPECT_EQ(queue.depth(), 3);
+
+    EXPECT_EQ(queue.drain(), 3);
+    EXPECT_EQ(connection.values, (std::vector<int>{ 1, 2, 3 }));
+    EXPECT_EQ(queue.depth(), 0);
+    EXPECT_EQ(queue.stats().executed, 3);
+    EXPECT_EQ(queue.stats().maxDepth, 3);
+}
+
+
+// Scenario: Completions report the SendId or failure of their command
+// Given A command queue on a mock connection
+// When A succeeding and a failing command are submitted with completions and the queue is drained
+// Then The first completion has a SendId, the second one is failed without one
+TEST(TestCommandQueue, CompletionsCarryResult) {
+    CommandMockConnection connection;
+    CommandQueue<CommandMockConnection> queue(connection);
+
+    auto good = queue.submitWithCompletion([](CommandMockConnection& conn) { conn.send(1); });
+    auto bad = queue.submitWithCompletion([](CommandMockConnection& conn) { conn.send(-1); });
+    ASSERT_TRUE(good);
+    ASSERT_TRUE(bad);
+    EXPECT_FALSE(good->ready());
+
+    queue.drain();
+
+    ASSERT_TRUE(good->ready());
+    EXPECT_FALSE(good->failed());
+    EXPECT_EQ(good->sendId(), 1);
+    ASSERT_TRUE(bad->ready());
+    EXPECT_TRUE(bad->failed());
+    EXPECT_EQ(bad->sendId(), noId);
+    EXPECT_EQ(queue.stats().failed, 1);
+}
+
+
+// Scenario: A command throws while the queue is drained
+// Given A command queue with a throwing command between two others, the first two with completions
+// When The queue is drained, and a command without a completion throws in a later drain
+// Then The exception ends up in the completion and draining continues, the one without a completion is rethrown,
+// And the queue keeps draining afterwards
+TEST(TestCommandQueue, ThrowingCommandCompletesWithException) {
+    CommandMockConnection connection;
+    CommandQueue<CommandMockConnection> queue(connection);
+
+    auto throwing = queue.submitWithCompletion([](CommandMockConnection&) { throw std::runtime_error("boom"); });
+    auto next = queue.submitWithCompletion([](CommandMockConnection& conn) { conn.send(2); });
+    ASSERT_TRUE(throwing);
+    ASSERT_TRUE(next);
+
+    EXPECT_EQ(queue.drain(), 2);
+    ASSERT_TRUE(throwing->ready());
+    EXPECT_TRUE(throwing->failed());
+    EXPECT_THROW(std::rethrow_exception(throwing->exception()), std::runtime_error);
+    ASSERT_TRUE(next->ready());
+    EXPECT_FALSE(next->failed());
+
+    EXPECT_TRUE(queue.submit([](CommandMockConnection&) { throw std::runtime_error("unreported"); }));
+    EXPECT_TRUE(queue.submit([](CommandMockConnection& conn) { conn.send(3); }));
+    EXPECT_THROW(queue.drain(), std::runtime_error);
+    EXPECT_EQ(queue.drain(), 1);
+    EXPECT_EQ(connection.values, (std::vector<int>{ 2, 3 }));
+    EXPECT_EQ(queue.stats().executed, 4);
+    EXPECT_EQ(queue.stats().failed, 2);
+}
+
+
+// Scenario: A full queue refuses commands instead of blocking
+// Given A command queue with room for two commands
+// When Three commands are submitted before draining
+// Then The third is refused and counted, and a limited drain leaves the rest queued
+TEST(TestCommandQueue, FullQueueRejects) {
+    CommandMockConnection connection;
+    CommandQueue<CommandMockConnection> queue(connection, { .capacity = 2 });
+
+    EXPECT_TRUE(queue.submit([](CommandMockConnection& conn) { conn.send(1); }));
+    EXPECT_TRUE(queue.submit([](CommandMockConnection& conn) { conn.send(2); }));
+    EXPECT_FALSE(queue.submit([](CommandMockConnection& conn) { conn.send(3); }));
+    EXPECT_FALSE(queue.submitWithCompletion([](CommandMockConnection& conn) { conn.send(4); }));
+    EXPECT_EQ(queue.stats().rejected, 2);
+
+    EXPECT_EQ(queue.drain(1), 1);
+    EXPECT_EQ(queue.depth(), 1);
+    EXPECT_TRUE(queue.submit([](CommandMockConnection& conn) { conn.send(5); }));
+    EXPECT_EQ(queue.drain(), 2);
+    EXPECT_EQ(connection.values, (std::vector<int>{ 1, 2, 5 }));
+}
+
+
+// Scenario: Many producers, one owner thread
+// Given A command queue drained by the test thread
+// When Four producer threads each submit a thousand commands
+// Then All commands are executed, each producer's in its own order, and only by the owner thread
+TEST(TestCommandQueue, ManyProducersOneOwner) {
+    constexpr int producers{ 4 };
+    constexpr int perProducer{ 1000 };
+
+    CommandMockConnection connection;
+    std::atomic<int> wakeups{ 0 };
+    CommandQueue<CommandMockConnection> queue(connection, { .capacity = 256, .onSubmit = [&wakeups]() { ++wakeups; } });
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < perProducer; ++i) {
+                const int value = (p * perProducer) + i;
+                while (!queue.submit([value](CommandMockConnection& conn) { conn.send(value); })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::size_t executed{ 0 };
+    while (executed < static_cast<std::size_t>(producers * perProducer)) {
+        executed += queue.drain(64);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(connection.values.size(), static_cast<std::size_t>(producers * perProducer));
+    std::vector<int> last(producers, -1);
+    for (const auto value : connection.values) {
+        const auto p = value / perProducer;
+        EXPECT_GT(value, last[p]);
+        last[p] = value;
+    }
+    for (const auto& caller : connection.callers) {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+    }
+    EXPECT_EQ(wakeups.load(), producers * perProducer);
+
+    const auto stats = queue.stats();
+    EXPECT_EQ(stats.submitted, static_cast<std::size_t>(producers * perProducer));
+    EXPECT_EQ(stats.executed, stats.submitted);
+    EXPECT_LE(stats.maxDepth, queue.capacity());
+    EXPECT_GE(stats.maxLatency, stats.averageLatency());
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
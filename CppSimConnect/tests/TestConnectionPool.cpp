@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/connection_pool.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Mock connection: requests are queued and finish on the next dispatch. Connections whose name is listed in
+// failingNames refuse to open.
+static std::vector<std::string> failingNames;
+
+class PoolMockConnection {
+    std::string name_;
+    bool open_{ false };
+
+public:
+    std::vector<std::function<void()>> pending;
+    std::size_t maxPending{ 0 };
+
+    explicit PoolMockConnection(std::string_view name) : name_(name) {}
+
+    [[nodiscard]] const std::string& name() const noexcept { return name_; }
+
+    PoolMockConnection& open([[maybe_unused]] int configIndex) {
+        open_ = std::find(failingNames.begin(), failingNames.end(), name_) == failingNames.end();
+        return *this;
+    }
+    [[nodiscard]] bool isOpen() const noexcept { return open_; }
+    void close() noexcept { open_ = false; }
+
+    Request startRequest(std::function<void()> onEnd) {
+        pending.push_back(std::move(onEnd));
+        maxPending = std::max(maxPending, pending.size());
+        return Request{ static_cast<RequestId>(pending.size()) };
+    }
+};
+
+class PoolMockHandler {
+    PoolMockConnection& connection_;
+
+public:
+    explicit PoolMockHandler(PoolMockConnection& connection) : connection_(connection) {}
+
+    void handleFor(std::chrono::milliseconds duration) {
+        std::this_thread::sleep_for(std::min(duration, std::chrono::milliseconds{ 1 }));
+        auto finished = std::move(connection_.pending);
+        connection_.pending.clear();
+        for (auto& onEnd : finished) {
+            onEnd();
+        }
+    }
+};
+
+using MockPool = ConnectionPool<PoolMockConnection, PoolMockHandler>;
+
+
+static void submitJobs(MockPool& pool, int count, std::vector<int>& results) {
+    for (int i = 0; i < count; ++i) {
+        pool.submit([&pool, &results, i](MockPool::Worker& worker, MockPool::JobDone done) {
+            return worker.connection().startRequest([&pool, &results, i, done]() {
+                pool.deliver([&results, i]() { results.push_back(i); });
+                done();
+            });
+        });
+    }
+}
+
+
+// Scenario: All jobs are executed, spread over the connections
+// Given A pool of four connections
+// When 200 jobs are submitted
+// Then Every job delivers exactly one result and every worker completed some of them
+TEST(TestConnectionPool, RunsAllJobs) {
+    failingNames.clear();
+    MockPool pool("PoolTest", { .connections = 4, .maxInFlight = 4, .pollInterval = 1ms });
+    std::vector<int> results;
+
+    pool.start();
+    submitJobs(pool, 200, results);
+    ASSERT_TRUE(pool.waitIdle(5s));
+    pool.stop();
+
+    std::sort(results.begin(), results.end());
+    ASSERT_EQ(results.size(), 200);
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(results[i], i);
+    }
+    std::size_t completed{ 0 };
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        EXPECT_EQ(pool.worker(i).connection().name(), std::format("PoolTest-{}", i));
+        EXPECT_GT(pool.worker(i).completed(), 0);
+        EXPECT_LE(pool.worker(i).connection().maxPending, 4);
+        completed += pool.worker(i).completed();
+    }
+    EXPECT_EQ(completed, 200);
+    EXPECT_EQ(pool.abandoned(), 0);
+}
+
+
+// Scenario: Work queued for a connection that fails is stolen by the others
+// Given A pool of three connections, one of which cannot open
+// When 90 jobs are submitted round-robin
+// Then All jobs still finish, the failed worker completed none, and the others stole its share
+TEST(TestConnectionPool, StealsFromFailedConnection) {
+    failingNames = { "StealTest-1" };
+    MockPool pool("StealTest", { .connections = 3, .maxInFlight = 2, .pollInterval = 1ms });
+    std::vector<int> results;
+
+    submitJobs(pool, 90, results);
+    pool.start();
+    ASSERT_TRUE(pool.waitIdle(5s));
+    pool.stop();
+
+    EXPECT_EQ(results.size(), 90);
+    EXPECT_FALSE(pool.worker(1).isConnected());
+    EXPECT_EQ(pool.worker(1).completed(), 0);
+    EXPECT_GE(pool.worker(0).stolen() + pool.worker(2).stolen(), 30);
+    failingNames.clear();
+}
+
+
+// Scenario: Waiting for idle returns when no connection can run the jobs
+// Given A pool whose only connection cannot open
+// When A job is submitted
+// Then waitIdle() returns false without waiting for the full timeout
+TEST(TestConnectionPool, WaitIdleWithoutWorkers) {
+    failingNames = { "DeadPool-0" };
+    MockPool pool("DeadPool", { .connections = 1 });
+    std::vector<int> results;
+
+    submitJobs(pool, 1, results);
+    pool.start();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(pool.waitIdle(5s));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 4s);
+    EXPECT_EQ(pool.queued(), 1);
+    failingNames.clear();
+}
+
+
+// Scenario: Jobs and callbacks that throw
+// Given A pool of two connections with an error callback
+// When 20 jobs are submitted, one of which throws when it starts, and one whose callback throws after finishing
+// Then Both exceptions are reported, the job that failed to start is abandoned, and all other jobs still finish
+TEST(TestConnectionPool, ReportsThrowingJobs) {
+    failingNames.clear();
+    MockPool pool("ThrowPool", { .connections = 2, .maxInFlight = 1, .pollInterval = 1ms });
+    std::vector<int> results;
+    std::atomic<int> errors{ 0 };
+    pool.onError([&errors](MockPool::Worker&, std::exception_ptr error) {
+        try {
+            std::rethrow_exception(error);
+        }
+        catch (const std::runtime_error&) {
+            ++errors;
+        }
+    });
+
+    pool.start();
+    for (int i = 0; i < 20; ++i) {
+        pool.submit([&pool, &results, i](MockPool::Worker& worker, MockPool::JobDone done) {
+            if (i == 3) {
+                throw std::runtime_error("Cannot start");
+            }
+            return worker.connection().startRequest([&pool, &results, i, done]() {
+                pool.deliver([&results, i]() { results.push_back(i); });
+                done();
+                if (i == 7) {
+                    throw std::runtime_error("Callback failed");
+                }
+            });
+        });
+    }
+    ASSERT_TRUE(pool.waitIdle(5s));
+    pool.stop();
+
+    EXPECT_EQ(results.size(), 19);
+    EXPECT_EQ(pool.abandoned(), 1);
+    EXPECT_EQ(pool.errors(), 2);
+    EXPECT_EQ(errors.load(), 2);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/events/event_handler.hpp>
+#include <simconnect/events/event_transmitter.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: a real Connection for event() bookkeeping, with the SimConnect calls under test replaced by
+// recording versions, and a queue of Frame events to dispatch.
+class TransmitterMockConnection : public Connection<TransmitterMockConnection, false, NullLogger> {
+public:
+    struct Transmitted {
+        SimObjectId objectId;
+        EventId eventId;
+        unsigned long data;
+    };
+
+private:
+    std::vector<Messages::EventFrameMsg> frames_;
+    std::size_t frameIndex_{ 0 };
+
+public:
+    std::vector<Transmitted> transmitted;
+    std::map<std::string, EventId> systemEvents;
+
+    void addFrame() {
+        Messages::EventFrameMsg msg{};
+        msg.dwID = static_cast<unsigned long>(Messages::eventFrame);
+        msg.dwSize = sizeof(msg);
+        msg.dwVersion = 1;
+        msg.uGroupID = unknownGroup;
+        msg.uEventID = systemEvents.at("Frame");
+        msg.fFrameRate = 60.0f;
+        msg.fSimSpeed = 1.0f;
+        frames_.push_back(msg);
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (frameIndex_ < frames_.size()) {
+            const auto& msg = frames_[frameIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(&msg), msg.dwSize);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+
+    TransmitterMockConnection& subscribeToSystemEvent(SimConnect::event evt) {
+        systemEvents.emplace(evt.name(), evt.id());
+        return *this;
+    }
+    TransmitterMockConnection& transmitClientEventWithPriority(SimObjectId objectId, SimConnect::event evt, Events::Priority, unsigned long data) {
+        transmitted.push_back({ objectId, evt.id(), data });
+        return *this;
+    }
+    TransmitterMockConnection& transmitClientEvent(SimObjectId objectId, SimConnect::event evt, NotificationGroupId, unsigned long data) {
+        transmitted.push_back({ objectId, evt.id(), data });
+        return *this;
+    }
+};
+
+using TestHandler = SimpleHandler<TransmitterMockConnection>;
+
+
+// Scenario: Coalescing axis values
+// Given a transmitter driven by frame events
+// When many values for the same axis are queued between two frames
+// Then only the latest value should be transmitted, and the others counted as suppressed
+TEST(EventTransmitterTests, LevelEvents_AreCoalescedPerFrame) {
+    TransmitterMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    EventTransmitter<TestHandler> transmitter(eventHandler);
+
+    const auto elevator = connection.event("AXIS_ELEVATOR_SET");
+    for (unsigned long value = 0; value < 100; ++value) {
+        transmitter.send(elevator, value);
+    }
+    EXPECT_TRUE(connection.transmitted.empty());
+
+    connection.addFrame();
+    handler.handle();
+
+    ASSERT_EQ(connection.transmitted.size(), 1U);
+    EXPECT_EQ(connection.transmitted[0].eventId, elevator.id());
+    EXPECT_EQ(connection.transmitted[0].data, 99U);
+    EXPECT_EQ(transmitter.queued(), 100U);
+    EXPECT_EQ(transmitter.suppressed(), 99U);
+    EXPECT_EQ(transmitter.transmitted(), 1U);
+}
+
+// Scenario: Edge events are never coalesced
+// Given a transmitter
+// When an edge event is queued several times, between values of a level event
+// Then every edge event should be transmitted, in order, along with the latest level value
+TEST(EventTransmitterTests, EdgeEvents_AreNeverCoalesced) {
+    TransmitterMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    EventTransmitter<TestHandler> transmitter(eventHandler, { .flushOnFrame = false });
+
+    const auto trimUp = connection.event("ELEV_TRIM_UP");
+    const auto throttle = connection.event("THROTTLE_SET");
+    transmitter.send(throttle, 1);
+    transmitter.send(trimUp);
+    transmitter.send(trimUp);
+    transmitter.send(throttle, 2);
+    transmitter.send(trimUp);
+
+    EXPECT_EQ(transmitter.flush(), 4U);
+
+    ASSERT_EQ(connection.transmitted.size(), 4U);
+    EXPECT_EQ(connection.transmitted[0].eventId, throttle.id());
+    EXPECT_EQ(connection.transmitted[0].data, 2U);
+    EXPECT_EQ(connection.transmitted[1].eventId, trimUp.id());
+    EXPECT_EQ(connection.transmitted[2].eventId, trimUp.id());
+    EXPECT_EQ(connection.transmitted[3].eventId, trimUp.id());
+    EXPECT_EQ(transmitter.suppressed(), 1U);
+}
+
+// Scenario: Values for different objects
+// Given a transmitter
+// When the same level event is queued for two objects
+// Then each object should get its own latest value
+TEST(EventTransmitterTests, LevelEvents_AreKeyedByObject) {
+    TransmitterMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    EventTransmitter<TestHandler> transmitter(eventHandler, { .flushOnFrame = false });
+
+    const auto rudder = connection.event("AXIS_RUDDER_SET");
+    transmitter.set(rudder, 10, 1);
+    transmitter.set(rudder, 20, 2);
+    transmitter.set(rudder, 11, 1);
+
+    transmitter.flush();
+
+    ASSERT_EQ(connection.transmitted.size(), 2U);
+    EXPECT_EQ(connection.transmitted[0].objectId, 1U);
+    EXPECT_EQ(connection.transmitted[0].data, 11U);
+    EXPECT_EQ(connection.transmitted[1].objectId, 2U);
+    EXPECT_EQ(connection.transmitted[1].data, 20U);
+}
+
+// Scenario: Limiting the flush rate
+// Given a transmitter with a minimum interval of an hour
+// When frames arrive after the first flush
+// Then no further events should be sent until the interval has passed
+TEST(EventTransmitterTests, MinInterval_SkipsFrames) {
+    TransmitterMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    EventTransmitter<TestHandler> transmitter(eventHandler, { .minInterval = 1h });
+
+    const auto aileron = connection.event("AXIS_AILERONS_SET");
+    transmitter.send(aileron, 1);
+    connection.addFrame();
+    handler.handle();
+    ASSERT_EQ(connection.transmitted.size(), 1U);
+
+    transmitter.send(aileron, 2);
+    connection.addFrame();
+    handler.handle();
+
+    EXPECT_EQ(connection.transmitted.size(), 1U);
+    EXPECT_EQ(transmitter.pending(), 1U);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
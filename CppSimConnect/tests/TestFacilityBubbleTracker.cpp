@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/requests/facility_list_handler.hpp>
+#include <simconnect/requests/facility_bubble_tracker.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: records facility list requests, and dispatches the list messages the test queues.
+class BubbleMockConnection : public Connection<BubbleMockConnection, false, NullLogger> {
+    std::vector<std::vector<std::uint64_t>> messages_;
+    std::size_t messageIndex_{ 0 };
+
+    template <class Msg, class Item>
+    void queue(MessageId id, RequestId requestId, const std::vector<std::string>& idents) {
+        const auto count = std::max<std::size_t>(idents.size(), 1);
+        const auto size = sizeof(Msg) + ((count - 1) * sizeof(Item));
+        auto& buffer = messages_.emplace_back((size + 7) / 8);
+        auto& msg = *reinterpret_cast<Msg*>(buffer.data());
+        msg.dwID = static_cast<unsigned long>(id);
+        msg.dwSize = static_cast<unsigned long>(size);
+        msg.dwVersion = 1;
+        msg.dwRequestID = requestId;
+        msg.dwArraySize = static_cast<unsigned long>(idents.size());
+        msg.dwEntryNumber = 0;
+        msg.dwOutOf = 1;
+        for (std::size_t i = 0; i < idents.size(); ++i) {
+            idents[i].copy(&msg.rgData[i].Ident[0], sizeof(msg.rgData[i].Ident) - 1);
+            std::string_view{ "EH" }.copy(&msg.rgData[i].Region[0], sizeof(msg.rgData[i].Region) - 1);
+            msg.rgData[i].Latitude = 52.0 + static_cast<double>(i);
+        }
+    }
+
+public:
+    struct Listed {
+        RequestId requestId;
+        FacilityListType type;
+    };
+    std::vector<Listed> listed;
+
+    BubbleMockConnection& listFacilities(RequestId requestId, FacilitiesListScope scope, FacilityListType type) {
+        EXPECT_EQ(scope, FacilitiesListScope::bubbleOnly);
+        listed.push_back({ requestId, type });
+        return *this;
+    }
+
+    // Answers the listing of the given type from the last refresh.
+    void answer(FacilityListType type, const std::vector<std::string>& idents) {
+        for (auto it = listed.rbegin(); it != listed.rend(); ++it) {
+            if (it->type != type) {
+                continue;
+            }
+            if (type == FacilityListTypes::airport) {
+                queue<Messages::AirportListMsg, SIMCONNECT_DATA_FACILITY_AIRPORT>(Messages::airportList, it->requestId, idents);
+            } else {
+                queue<Messages::VorListMsg, SIMCONNECT_DATA_FACILITY_VOR>(Messages::vorList, it->requestId, idents);
+            }
+            return;
+        }
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (messageIndex_ < messages_.size()) {
+            const auto& msg = messages_[messageIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(msg.data()), reinterpret_cast<const SIMCONNECT_RECV*>(msg.data())->dwSize);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+};
+
+using TestHandler = SimpleHandler<BubbleMockConnection>;
+
+
+// A clock that only moves when the test says so.
+using BubbleClock = ManualClock<struct BubbleClockTag>;
+
+using TestTracker = FacilityBubbleTracker<TestHandler, BubbleClock>;
+
+
+namespace {
+
+struct Deltas {
+    std::vector<std::string> entered;
+    std::vector<std::string> left;
+    int calls{ 0 };
+};
+
+TestTracker::consumer_type recordInto(Deltas& deltas) {
+    return [&deltas](std::span<const FacilityLocation> entered, std::span<const FacilityLocation> left) {
+        ++deltas.calls;
+        deltas.entered.clear();
+        deltas.left.clear();
+        for (const auto& location : entered) {
+            deltas.entered.emplace_back(location.identView());
+        }
+        for (const auto& location : left) {
+            deltas.left.emplace_back(location.identView());
+        }
+    };
+}
+
+} // namespace
+
+
+// Scenario: Reporting facilities entering and leaving the bubble
+// Given a tracker for airports and VORs
+// When three listings come in, with facilities appearing and disappearing between them
+// Then the consumer gets every facility on the first listing, and afterwards only the changes, sorted by key
+TEST(FacilityBubbleTrackerTests, ReportsOnlyChanges) {
+    BubbleMockConnection connection;
+    TestHandler handler(connection);
+    FacilityListHandler<TestHandler> lists(handler);
+    Deltas deltas;
+    TestTracker tracker(lists, recordInto(deltas), { FacilityListTypes::airport, FacilityListTypes::vor });
+
+    tracker.refresh();
+    ASSERT_EQ(connection.listed.size(), 2U);
+    connection.answer(FacilityListTypes::airport, { "EHRD", "EHAM" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 0);         // The VOR list is still missing.
+    EXPECT_TRUE(tracker.listing());
+    connection.answer(FacilityListTypes::vor, { "SPL" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 1);
+    EXPECT_EQ(deltas.entered, (std::vector<std::string>{ "EHAM", "EHRD", "SPL" }));
+    EXPECT_TRUE(deltas.left.empty());
+    EXPECT_TRUE(tracker.contains(FacilityListTypes::airport, "EHAM", "EH"));
+    EXPECT_FALSE(tracker.contains(FacilityListTypes::vor, "EHAM", "EH"));
+
+    tracker.refresh();
+    connection.answer(FacilityListTypes::airport, { "EHAM", "EHLE" });
+    connection.answer(FacilityListTypes::vor, { "SPL" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 2);
+    EXPECT_EQ(deltas.entered, (std::vector<std::string>{ "EHLE" }));
+    EXPECT_EQ(deltas.left, (std::vector<std::string>{ "EHRD" }));
+
+    tracker.refresh();
+    connection.answer(FacilityListTypes::vor, { "SPL" });
+    connection.answer(FacilityListTypes::airport, { "EHLE", "EHAM" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 2);         // Nothing changed.
+    EXPECT_EQ(tracker.stats().completed, 3U);
+    EXPECT_EQ(tracker.stats().facilities, 3U);
+    EXPECT_EQ(tracker.stats().entered, 4U);
+    EXPECT_EQ(tracker.stats().left, 1U);
+}
+
+
+// Scenario: Refreshing on an interval
+// Given a tracker with a 5 second interval
+// When pump() is called before and after the interval, and while a listing is running
+// Then a listing is only started when none is running and the interval has passed
+TEST(FacilityBubbleTrackerTests, PumpHonoursInterval) {
+    BubbleMockConnection connection;
+    TestHandler handler(connection);
+    FacilityListHandler<TestHandler> lists(handler);
+    Deltas deltas;
+    TestTracker tracker(lists, recordInto(deltas), { FacilityListTypes::airport }, FacilityBubbleConfig{ .interval = 5s });
+
+    EXPECT_TRUE(tracker.pump());
+    EXPECT_FALSE(tracker.pump());       // Still listing.
+    connection.answer(FacilityListTypes::airport, { "EHAM" });
+    handler.handle();
+    EXPECT_FALSE(tracker.listing());
+
+    BubbleClock::advance(4s);
+    EXPECT_FALSE(tracker.pump());
+    BubbleClock::advance(1s);
+    EXPECT_TRUE(tracker.pump());
+    EXPECT_EQ(connection.listed.size(), 2U);
+}
+
+
+// Scenario: Abandoning a listing
+// Given a tracker with a completed snapshot and a listing in progress
+// When refresh() is called before the listing completes
+// Then the partial listing is dropped, its late answer is ignored, and the new listing is compared with the old snapshot
+TEST(FacilityBubbleTrackerTests, RefreshAbandonsRunningListing) {
+    BubbleMockConnection connection;
+    TestHandler handler(connection);
+    FacilityListHandler<TestHandler> lists(handler);
+    Deltas deltas;
+    TestTracker tracker(lists, recordInto(deltas), { FacilityListTypes::airport });
+
+    tracker.refresh();
+    connection.answer(FacilityListTypes::airport, { "EHAM" });
+    handler.handle();
+
+    tracker.refresh();
+    const auto abandoned = connection.listed.back();
+    tracker.refresh();
+    EXPECT_EQ(tracker.stats().abandoned, 1U);
+
+    connection.listed.push_back(abandoned);     // The late answer to the abandoned listing.
+    connection.answer(FacilityListTypes::airport, { "EHGG" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 1);
+
+    connection.listed.pop_back();
+    connection.answer(FacilityListTypes::airport, { "EHAM", "EHEH" });
+    handler.handle();
+    EXPECT_EQ(deltas.calls, 2);
+    EXPECT_EQ(deltas.entered, (std::vector<std::string>{ "EHEH" }));
+    EXPECT_TRUE(deltas.left.empty());
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
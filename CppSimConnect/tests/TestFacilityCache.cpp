@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/facility_cache.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
+
+namespace {
+
+// A facility data message with a payload after the header, kept in 8-byte aligned storage.
+std::vector<std::uint64_t> makeMessage(unsigned long uniqueId, unsigned long parentId, std::uint32_t payload) {
+    const auto size = sizeof(Messages::FacilityDataMsg) + sizeof(payload);
+    std::vector<std::uint64_t> storage((size + 7) / 8);
+
+    auto& msg = *reinterpret_cast<Messages::FacilityDataMsg*>(storage.data());
+    msg.dwID = static_cast<unsigned long>(Messages::facilityData);
+    msg.dwSize = static_cast<unsigned long>(size);
+    msg.dwVersion = 1;
+    msg.UniqueRequestId = uniqueId;
+    msg.ParentUniqueRequestId = parentId;
+    std::memcpy(reinterpret_cast<std::byte*>(storage.data()) + sizeof(Messages::FacilityDataMsg), &payload, sizeof(payload));
+    return storage;
+}
+
+std::vector<std::byte> makeAnswer(std::uint32_t firstPayload, std::size_t count) {
+    std::vector<std::byte> buffer;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto storage = makeMessage(static_cast<unsigned long>(i + 1), static_cast<unsigned long>(i), firstPayload + static_cast<std::uint32_t>(i));
+        FacilityCache::append(buffer, *reinterpret_cast<const Messages::FacilityDataMsg*>(storage.data()));
+    }
+    return buffer;
+}
+
+std::vector<std::uint32_t> payloads(const FacilityCacheEntry& entry) {
+    std::vector<std::uint32_t> result;
+    entry.forEach([&result](const Messages::FacilityDataMsg& msg) {
+        std::uint32_t payload{ 0 };
+        std::memcpy(&payload, reinterpret_cast<const std::byte*>(&msg) + sizeof(Messages::FacilityDataMsg), sizeof(payload));
+        result.push_back(payload);
+    });
+    return result;
+}
+
+constexpr auto airportDefinition = Facilities::FacilityDefinition<4>{}.push(Facilities::FacilityField::airportOpen);
+constexpr std::uint64_t airportKey = FacilityCache::definitionKey(airportDefinition);
+
+const SimulatorIdentity msfs{ .name = "Microsoft Flight Simulator", .version = "12", .build = "1.2" };
+
+std::filesystem::path cachePath(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path;
+}
+
+std::vector<char> readFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+}
+
+void writeFile(const std::filesystem::path& path, const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+template <class T>
+T readAt(const std::vector<char>& bytes, std::size_t offset) {
+    T value{};
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+}
+
+// The header starts with the magic, format version, header size, and entry count, followed by the index offset.
+constexpr std::size_t headerSizeOffset{ 8 };
+constexpr std::size_t indexOffsetOffset{ 16 };
+// An index entry is a 24-byte key followed by the offset, size, and message count.
+constexpr std::size_t indexEntrySize{ 40 };
+
+} // namespace
+
+
+// Scenario: Storing, flushing, and reopening the cache
+// Given an empty cache with two stored facilities
+// When the cache is flushed and opened again for the same simulator
+// Then both facilities are found in the mapped file with their messages in order, and other definitions miss
+TEST(FacilityCacheTests, StoredFacilitiesSurviveReopening) {
+    const auto path = cachePath("cppsimconnect_test_facilities.bin");
+    {
+        FacilityCache cache(path, msfs);
+        EXPECT_FALSE(cache.stats().loaded);
+        EXPECT_FALSE(cache.find("EHAM", "", airportKey).has_value());
+
+        ASSERT_TRUE(cache.store("EHAM", "", airportKey, makeAnswer(100, 3), 3));
+        ASSERT_TRUE(cache.store("EGLL", "EG", airportKey, makeAnswer(200, 1), 1));
+        ASSERT_TRUE(cache.find("EHAM", "", airportKey).has_value());
+
+        ASSERT_TRUE(cache.flush());
+        EXPECT_EQ(cache.stats().entries, 2U);
+        EXPECT_EQ(cache.stats().pending, 0U);
+    }
+
+    FacilityCache cache(path, msfs);
+    EXPECT_TRUE(cache.stats().loaded);
+
+    const auto eham = cache.find("EHAM", "", airportKey);
+    ASSERT_TRUE(eham.has_value());
+    EXPECT_EQ(eham->messages(), 3U);
+    EXPECT_EQ(payloads(*eham), (std::vector<std::uint32_t>{ 100, 101, 102 }));
+
+    const auto egll = cache.find("EGLL", "EG", airportKey);
+    ASSERT_TRUE(egll.has_value());
+    EXPECT_EQ(payloads(*egll), (std::vector<std::uint32_t>{ 200 }));
+
+    EXPECT_FALSE(cache.find("EGLL", "", airportKey).has_value());
+    EXPECT_FALSE(cache.find("EHAM", "", airportKey + 1).has_value());
+    EXPECT_EQ(cache.stats().hits, 2U);
+    EXPECT_EQ(cache.stats().misses, 2U);
+
+    std::filesystem::remove(path);
+}
+
+
+// Scenario: A cache file from another simulator build
+// Given a cache file written for build 1.2
+// When it is opened for build 1.3
+// Then it is ignored, and flushing replaces it with a file for the new build
+TEST(FacilityCacheTests, OtherBuildsAreIgnored) {
+    const auto path = cachePath("cppsimconnect_test_facilities_build.bin");
+    {
+        FacilityCache cache(path, msfs);
+        ASSERT_TRUE(cache.store("EHAM", "", airportKey, makeAnswer(100, 1), 1));
+        ASSERT_TRUE(cache.flush());
+    }
+
+    auto newer = msfs;
+    newer.build = "1.3";
+    {
+        FacilityCache cache(path, newer);
+        EXPECT_FALSE(cache.stats().loaded);
+        EXPECT_FALSE(cache.find("EHAM", "", airportKey).has_value());
+
+        ASSERT_TRUE(cache.store("EDDF", "", airportKey, makeAnswer(300, 1), 1));
+        ASSERT_TRUE(cache.flush());
+    }
+
+    FacilityCache cache(path, newer);
+    EXPECT_TRUE(cache.stats().loaded);
+    EXPECT_EQ(cache.stats().entries, 1U);
+    EXPECT_TRUE(cache.find("EDDF", "", airportKey).has_value());
+
+    FacilityCache old(path, msfs);
+    EXPECT_FALSE(old.stats().loaded);
+
+    std::filesystem::remove(path);
+}
+
+
+// Scenario: Updating a mapped cache
+// Given a cache file with EHAM
+// When a new answer for EHAM and one for EDDF are stored and flushed
+// Then the file holds both, with the new answer for EHAM
+TEST(FacilityCacheTests, FlushMergesWithMappedEntries) {
+    const auto path = cachePath("cppsimconnect_test_facilities_merge.bin");
+    {
+        FacilityCache cache(path, msfs);
+        ASSERT_TRUE(cache.store("EHAM", "", airportKey, makeAnswer(100, 2), 2));
+        ASSERT_TRUE(cache.store("LFPG", "", airportKey, makeAnswer(400, 1), 1));
+        ASSERT_TRUE(cache.flush());
+    }
+
+    FacilityCache cache(path, msfs);
+    ASSERT_TRUE(cache.store("EHAM", "", airportKey, makeAnswer(500, 1), 1));
+    ASSERT_TRUE(cache.store("EDDF", "", airportKey, makeAnswer(300, 1), 1));
+    EXPECT_FALSE(cache.store("TOOLONGIDENT", "", airportKey, makeAnswer(0, 1), 1));
+    ASSERT_TRUE(cache.flush());
+
+    EXPECT_EQ(cache.stats().entries, 3U);
+    EXPECT_EQ(payloads(*cache.find("EHAM", "", airportKey)), (std::vector<std::uint32_t>{ 500 }));
+    EXPECT_EQ(payloads(*cache.find("LFPG", "", airportKey)), (std::vector<std::uint32_t>{ 400 }));
+    EXPECT_EQ(payloads(*cache.find("EDDF", "", airportKey)), (std::vector<std::uint32_t>{ 300 }));
+
+    std::filesystem::remove(path);
+}
+
+
+
+// Scenario: Damaged cache files
+// Given a cache file with two facilities
+// When the first message's size is set to zero, or the index entries are swapped so they are no longer sorted
+// Then the file is not loaded and every lookup misses, instead of looping or reading outside the entries
+TEST(FacilityCacheTests, DamagedFilesAreIgnored) {
+    const auto path = cachePath("cppsimconnect_test_facilities_damaged.bin");
+    {
+        FacilityCache cache(path, msfs);
+        ASSERT_TRUE(cache.store("EHAM", "", airportKey, makeAnswer(100, 2), 2));
+        ASSERT_TRUE(cache.store("LFPG", "", airportKey, makeAnswer(400, 1), 1));
+        ASSERT_TRUE(cache.flush());
+    }
+    const auto good = readFile(path);
+    ASSERT_TRUE(FacilityCache(path, msfs).stats().loaded);
+
+    auto zeroSize = good;
+    const auto firstMessage = readAt<std::uint32_t>(good, headerSizeOffset);
+    auto msg = readAt<Messages::FacilityDataMsg>(good, firstMessage);
+    msg.dwSize = 0;
+    std::memcpy(zeroSize.data() + firstMessage, &msg, sizeof(msg));
+    writeFile(path, zeroSize);
+    {
+        FacilityCache cache(path, msfs);
+        EXPECT_FALSE(cache.stats().loaded);
+        EXPECT_FALSE(cache.find("EHAM", "", airportKey).has_value());
+    }
+
+    auto unsorted = good;
+    const auto index = static_cast<std::size_t>(readAt<std::uint64_t>(good, indexOffsetOffset));
+    std::swap_ranges(unsorted.begin() + static_cast<std::ptrdiff_t>(index),
+                     unsorted.begin() + static_cast<std::ptrdiff_t>(index + indexEntrySize),
+                     unsorted.begin() + static_cast<std::ptrdiff_t>(index + indexEntrySize));
+    writeFile(path, unsorted);
+    {
+        FacilityCache cache(path, msfs);
+        EXPECT_FALSE(cache.stats().loaded);
+        EXPECT_FALSE(cache.find("LFPG", "", airportKey).has_value());
+    }
+
+    std::filesystem::remove(path);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
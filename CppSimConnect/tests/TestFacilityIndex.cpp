@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <random>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/facility_index.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+namespace {
+
+// Adds facilities at random positions through the list handlers, every fourth one an airport, and returns them for a linear scan.
+std::vector<FacilityLocation> addRandom(FacilityIndexBuilder& builder, std::size_t count) {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0);
+    std::uniform_real_distribution<double> lon(-180.0, 180.0);
+
+    auto airports = builder.airports();
+    auto waypoints = builder.waypoints();
+    std::vector<FacilityLocation> result;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto ident = std::format("W{}", i);
+        const LatLonAlt position{ .latitude = lat(random), .longitude = lon(random), .altitude = 0.0 };
+        const auto location = FacilityLocation::of((i % 4 == 0) ? FacilityListTypes::airport : FacilityListTypes::waypoint, ident, "EH", position);
+
+        if (location.type == FacilityListTypes::airport) {
+            airports(ident, "EH", position);
+        } else {
+            waypoints(ident, "EH", WaypointDetails{ position, 0.0F });
+        }
+        result.push_back(location);
+    }
+    return result;
+}
+
+std::vector<std::string_view> idents(const std::vector<FacilityHit>& hits) {
+    std::vector<std::string_view> result;
+    for (const auto& hit : hits) {
+        result.push_back(hit.location->identView());
+    }
+    return result;
+}
+
+std::filesystem::path indexPath(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path;
+}
+
+} // namespace
+
+
+// Scenario: Finding the nearest facilities
+// Given an index over 20,000 random facilities
+// When the nearest facilities to several positions are requested, with and without a type filter
+// Then they equal the nearest facilities found by a linear scan, nearest first, with great-circle distances
+TEST(FacilityIndexTests, NearestMatchesLinearScan) {
+    FacilityIndexBuilder builder;
+    const auto all = addRandom(builder, 20'000);
+    const auto index = builder.build();
+    ASSERT_EQ(index.size(), all.size());
+
+    for (const auto& [lat, lon] : { std::pair{ 52.3, 4.76 }, std::pair{ -33.9, 151.2 }, std::pair{ 89.9, 0.0 }, std::pair{ 0.0, 179.99 } }) {
+        auto expected = all;
+        std::sort(expected.begin(), expected.end(), [lat, lon](const FacilityLocation& a, const FacilityLocation& b) {
+            return FacilityIndex::distance(lat, lon, a.position.latitude, a.position.longitude)
+                 < FacilityIndex::distance(lat, lon, b.position.latitude, b.position.longitude);
+        });
+        const auto hits = index.nearest(lat, lon, 10);
+        ASSERT_EQ(hits.size(), 10U);
+        for (std::size_t i = 0; i < hits.size(); ++i) {
+            EXPECT_EQ(hits[i].location->identView(), expected[i].identView());
+            EXPECT_NEAR(hits[i].distance, FacilityIndex::distance(lat, lon, expected[i].position.latitude, expected[i].position.longitude), 1e-3);
+        }
+
+        const auto airports = index.nearest(lat, lon, 3, FacilityListTypes::airport);
+        std::vector<std::string_view> expectedAirports;
+        for (const auto& location : expected) {
+            if ((location.type == FacilityListTypes::airport) && (expectedAirports.size() < 3)) {
+                expectedAirports.push_back(location.identView());
+            }
+        }
+        EXPECT_EQ(idents(airports), expectedAirports);
+    }
+    EXPECT_NEAR(FacilityIndex::distance(0.0, 0.0, 0.0, 1.0), 111'195.0, 1.0);
+}
+
+
+// Scenario: Radius and bounding box queries
+// Given an index with facilities around the date line
+// When facilities within 200 km of a position and inside a box crossing the date line are requested
+// Then exactly the facilities a linear scan finds are returned
+TEST(FacilityIndexTests, RadiusAndBoxMatchLinearScan) {
+    FacilityIndexBuilder builder;
+    const auto all = addRandom(builder, 20'000);
+    const auto index = builder.build();
+
+    const auto hits = index.within(-17.7, 178.0, 200'000.0);
+    std::size_t expected = 0;
+    for (const auto& location : all) {
+        if (FacilityIndex::distance(-17.7, 178.0, location.position.latitude, location.position.longitude) <= 200'000.0) {
+            ++expected;
+        }
+    }
+    EXPECT_GT(expected, 0U);
+    EXPECT_EQ(hits.size(), expected);
+    EXPECT_TRUE(std::is_sorted(hits.begin(), hits.end(), [](const FacilityHit& a, const FacilityHit& b) { return a.distance < b.distance; }));
+
+    const auto boxed = index.inBox(-30.0, 170.0, 10.0, -170.0);
+    std::size_t expectedBoxed = 0;
+    for (const auto& location : all) {
+        const auto& p = location.position;
+        if ((p.latitude >= -30.0) && (p.latitude <= 10.0) && ((p.longitude >= 170.0) || (p.longitude <= -170.0))) {
+            ++expectedBoxed;
+        }
+    }
+    EXPECT_GT(expectedBoxed, 0U);
+    EXPECT_EQ(boxed.size(), expectedBoxed);
+    EXPECT_TRUE(index.inBox(10.0, 0.0, -10.0, 10.0).empty());
+}
+
+
+// Scenario: Saving and loading an index
+// Given a built index
+// When it is saved and loaded again
+// Then the loaded index answers queries the same, and a damaged file is rejected
+TEST(FacilityIndexTests, SurvivesSaveAndLoad) {
+    const auto path = indexPath("cppsimconnect_test_facility_index.bin");
+    FacilityIndexBuilder builder;
+    addRandom(builder, 5'000);
+    const auto index = builder.build();
+    ASSERT_TRUE(index.save(path));
+
+    const auto loaded = FacilityIndex::load(path);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), index.size());
+    EXPECT_EQ(idents(loaded->nearest(48.1, 11.6, 5)), idents(index.nearest(48.1, 11.6, 5)));
+    EXPECT_EQ(loaded->nearest(48.1, 11.6, 1).front().location->regionView(), "EH");
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+    EXPECT_FALSE(FacilityIndex::load(path).has_value());
+    EXPECT_FALSE(FacilityIndex::load(indexPath("cppsimconnect_test_missing_index.bin")).has_value());
+    std::filesystem::remove(path);
+}
+
+
+// Scenario: Identifiers that fill their field
+// Given two waypoints with 8-character identifiers that differ only in the last character
+// When they are indexed
+// Then both keep their full identifier, and their keys differ and match the keys of the same facilities in a list
+TEST(FacilityIndexTests, KeepsFullLengthIdents) {
+    FacilityIndexBuilder builder;
+    auto waypoints = builder.waypoints();
+    waypoints("ABCDEFGH", "EH", WaypointDetails{ LatLonAlt{ .latitude = 52.0, .longitude = 4.0, .altitude = 0.0 }, 0.0F });
+    waypoints("ABCDEFGI", "EH", WaypointDetails{ LatLonAlt{ .latitude = 52.0, .longitude = 5.0, .altitude = 0.0 }, 0.0F });
+    const auto index = builder.build();
+
+    const auto hits = index.nearest(52.0, 4.0, 2);
+    ASSERT_EQ(hits.size(), 2U);
+    EXPECT_EQ(idents(hits), (std::vector<std::string_view>{ "ABCDEFGH", "ABCDEFGI" }));
+    EXPECT_NE(hits[0].location->key(), hits[1].location->key());
+    EXPECT_EQ(hits[0].location->key(), Facilities::FacilityKey::of("ABCDEFGH", "EH"));
+
+    const auto location = FacilityLocation::of(FacilityListTypes::waypoint, "ABCDEFGHIJ", "EHAM1234X");
+    EXPECT_EQ(location.identView(), "ABCDEFGH");
+    EXPECT_EQ(location.regionView(), "EHAM1234");
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
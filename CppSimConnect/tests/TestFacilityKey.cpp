@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <simconnect/requests/facilities/facility_key.hpp>
+#include <simconnect/requests/facilities/airport.hpp>
+#include <simconnect/requests/facility_index.hpp>
+
+using namespace SimConnect;
+using namespace SimConnect::Facilities;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
+
+static_assert(sizeof(FacilityKey) == sizeof(std::uint64_t));
+static_assert(FacilityKey::packed("EHAM", "EH").has_value());
+static_assert(FacilityKey::packed("EHAM", "EH") != FacilityKey::packed("EHAM", "ED"));
+static_assert(!FacilityKey::packed("TOOLONGID", "").has_value());
+static_assert(!FacilityKey::packed("eham", "EH").has_value());
+
+
+// Scenario: Packing idents and regions
+// Given idents and regions as the simulator returns them
+// When they are turned into keys and back
+// Then they are packed without the global table, round-trip, and sort like the text
+TEST(FacilityKeyTests, PackedRoundTrip) {
+    const std::array<char, ICAOLength + 1> fixedIdent{ 'E', 'H', 'A', 'M' };
+    const auto before = FacilityKey::internedCount();
+
+    const auto eham = FacilityKey::of(std::string_view{ fixedIdent.data(), fixedIdent.size() }, "EH");
+    EXPECT_TRUE(eham.isPacked());
+    EXPECT_EQ(eham, FacilityKey::of("EHAM", "EH"));
+    EXPECT_EQ(eham.ident(), "EHAM");
+    EXPECT_EQ(eham.region(), "EH");
+
+    const auto waypoint = FacilityKey::of("RW22-1_.", "K1");
+    EXPECT_TRUE(waypoint.isPacked());
+    EXPECT_EQ(waypoint.ident(), "RW22-1_.");
+    EXPECT_EQ(waypoint.region(), "K1");
+
+    const auto noRegion = FacilityKey::of("SPL");
+    EXPECT_EQ(noRegion.ident(), "SPL");
+    EXPECT_EQ(noRegion.region(), "");
+    EXPECT_EQ(FacilityKey::internedCount(), before);
+
+    std::vector<std::pair<std::string, std::string>> texts{
+        { "EHRD", "EH" }, { "EHAM", "EH" }, { "EHAM", "ED" }, { "EH", "EH" }, { "00A", "K6" }, { "A 1", "" }, { "EHAM-", "" }, { "Z_", "" } };
+    std::vector<FacilityKey> keys;
+    for (const auto& [ident, region] : texts) {
+        keys.push_back(FacilityKey::of(ident, region));
+    }
+    std::ranges::sort(texts);
+    std::ranges::sort(keys);
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        EXPECT_EQ(keys[i].ident(), texts[i].first);
+        EXPECT_EQ(keys[i].region(), texts[i].second);
+    }
+}
+
+
+// Scenario: Interning what cannot be packed
+// Given idents and regions that are too long or have other characters
+// When they are turned into keys, twice
+// Then they are added to the global table once, give the same key, and round-trip
+TEST(FacilityKeyTests, InternedRoundTrip) {
+    const auto before = FacilityKey::internedCount();
+
+    const auto longIdent = FacilityKey::of("VERYLONGID", "EH");
+    const auto longRegion = FacilityKey::of("EHAM", "REGION");
+    const auto lowerCase = FacilityKey::of("ehxx", "EH");
+    EXPECT_FALSE(longIdent.isPacked());
+    EXPECT_FALSE(longRegion.isPacked());
+    EXPECT_FALSE(lowerCase.isPacked());
+    EXPECT_EQ(FacilityKey::internedCount(), before + 3);
+
+    EXPECT_EQ(longIdent, FacilityKey::of("VERYLONGID", "EH"));
+    EXPECT_NE(longRegion, FacilityKey::of("EHAM", "EH"));
+    EXPECT_EQ(FacilityKey::internedCount(), before + 3);
+
+    EXPECT_EQ(longIdent.ident(), "VERYLONGID");
+    EXPECT_EQ(longRegion.region(), "REGION");
+    EXPECT_EQ(lowerCase.ident(), "ehxx");
+}
+
+
+// Scenario: Keying hash maps
+// Given facilities from an index and parkings of an airport
+// When they are put in unordered maps keyed by FacilityKey and ParkingKey
+// Then they can be found again by ident and region, or by parking name and number
+TEST(FacilityKeyTests, HashMapKeys) {
+    FacilityLocation location{ .position = { 52.3, 4.76, -3.0 }, .ident = { 'E', 'H', 'A', 'M' }, .region = { 'E', 'H' } };
+
+    std::unordered_map<FacilityKey, const FacilityLocation*> byKey;
+    byKey[location.key()] = &location;
+    byKey[FacilityKey::of("EHRD", "EH")] = nullptr;
+    EXPECT_EQ(byKey.size(), 2U);
+    EXPECT_EQ(byKey.at(FacilityKey::of("EHAM", "EH")), &location);
+
+    std::unordered_map<ParkingKey, int> parkings;
+    parkings[ParkingKey{ ParkingName::Gate_A, 12, ParkingName::None }] = 1;
+    parkings[ParkingKey{ ParkingName::Gate_A, 12, ParkingName::Gate_B }] = 2;
+    parkings[ParkingKey{ ParkingName::Gate_B, 12, ParkingName::None }] = 3;
+    EXPECT_EQ(parkings.size(), 3U);
+    EXPECT_EQ(parkings.at(ParkingKey{ ParkingName::Gate_A, 12, ParkingName::Gate_B }), 2);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
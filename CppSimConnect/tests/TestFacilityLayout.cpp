@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
+#include <simconnect/requests/facilities/airport.hpp>
+
+using namespace SimConnect;
+using namespace SimConnect::Facilities;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
+
+namespace {
+
+constexpr auto definition = Builder<64>{}
+    .airport()
+        .icao().region().latitude().longitude().altitude().magvar().runways()
+        .runway()
+            .latitude().longitude().altitude().heading().length()
+            .primaryThreshold().length().width().end()
+            .surface()
+        .end()
+    .end()
+    .definition;
+
+constexpr auto airportLayout = layoutOf(definition, FacilityField::airportOpen);
+constexpr auto runwayLayout = layoutOf(definition, FacilityField::runwayOpen);
+constexpr auto thresholdLayout = layoutOf(definition, FacilityField::runwayPrimaryThresholdOpen);
+
+#pragma pack(push, 1)
+struct MyAirport {
+    std::array<char, ICAOLength> icao;
+    std::array<char, RegionLength> region;
+    LatLonAltMagVar position;
+    std::int32_t nRunways;
+};
+
+struct MyRunway {
+    LatLonAlt position;
+    float heading;
+    float length;
+    RunwaySurface surface;
+};
+#pragma pack(pop)
+
+static_assert(layoutMatches<MyAirport>(airportLayout));
+static_assert(layoutMatches<MyRunway>(runwayLayout));
+static_assert(offsetof(MyRunway, heading) == runwayLayout.offsetOf(FacilityField::runwayHeading));
+static_assert(offsetof(MyRunway, surface) == runwayLayout.offsetOf(FacilityField::runwaySurface));
+static_assert(!layoutMatches<MyRunway>(airportLayout));
+
+constexpr std::array myAirportMembers{
+    facilityMember<MyAirport, &MyAirport::icao>(FacilityField::airportICAO),
+    facilityMember<MyAirport, &MyAirport::region>(FacilityField::airportRegion),
+    facilityMember<MyAirport, &MyAirport::position, &LatLonAlt::latitude>(FacilityField::airportLatitude),
+    facilityMember<MyAirport, &MyAirport::position, &LatLonAlt::longitude>(FacilityField::airportLongitude),
+    facilityMember<MyAirport, &MyAirport::position, &LatLonAlt::altitude>(FacilityField::airportAltitude),
+    facilityMember<MyAirport, &MyAirport::position, &LatLonAltMagVar::magVar>(FacilityField::airportMagvar),
+    facilityMember<MyAirport, &MyAirport::nRunways>(FacilityField::airportRunways),
+};
+static_assert(layoutMatches<MyAirport>(airportLayout, myAirportMembers));
+
+// Same size, but the runway count is claimed for the magnetic variation and the other way around.
+constexpr std::array swappedMembers{
+    myAirportMembers[0], myAirportMembers[1], myAirportMembers[2], myAirportMembers[3], myAirportMembers[4],
+    FacilityMember{ FacilityField::airportMagvar, myAirportMembers[6].offset, myAirportMembers[6].size },
+    FacilityMember{ FacilityField::airportRunways, myAirportMembers[5].offset, myAirportMembers[5].size },
+};
+static_assert(!layoutMatches<MyAirport>(airportLayout, swappedMembers));
+static_assert(!layoutMatches<MyAirport>(airportLayout, std::array{ myAirportMembers[0] }));
+
+std::vector<std::uint64_t> makeMessage(const void* data, std::size_t size) {
+    std::vector<std::uint64_t> buffer((sizeof(Messages::FacilityDataMsg) + size + 7) / 8);
+    auto& msg = *reinterpret_cast<Messages::FacilityDataMsg*>(buffer.data());
+    msg.Type = FacilityDataTypes::airport;
+    std::memcpy(&msg.Data, data, size);
+    return buffer;
+}
+
+} // namespace
+
+
+// Scenario: Computing the layout of a nested definition
+// Given an airport definition with a runway, which has a threshold pavement
+// When the layouts of the three objects are computed
+// Then each only holds its own fields, with offsets following the wire sizes of the fields
+TEST(FacilityLayoutTests, ComputesObjectLayouts) {
+    EXPECT_TRUE(airportLayout.found());
+    EXPECT_EQ(airportLayout.fieldCount, 7U);
+    EXPECT_EQ(airportLayout.size, 8U + 8U + 3 * 8U + 4U + 4U);
+    EXPECT_EQ(airportLayout.offsetOf(FacilityField::airportLatitude), 16U);
+    EXPECT_EQ(airportLayout.offsetOf(FacilityField::airportMagvar), 40U);
+
+    EXPECT_EQ(runwayLayout.fieldCount, 6U);
+    EXPECT_EQ(runwayLayout.size, 3 * 8U + 3 * 4U);
+    EXPECT_FALSE(runwayLayout.contains(FacilityField::pavementLength));
+
+    EXPECT_EQ(thresholdLayout.fieldCount, 2U);
+    EXPECT_EQ(thresholdLayout.offsetOf(FacilityField::pavementWidth), 4U);
+
+    EXPECT_FALSE(layoutOf(definition, FacilityField::vorOpen).found());
+    EXPECT_EQ(airportLayout.offsetOf(FacilityField::airportName), FacilityLayout<64>::npos);
+}
+
+
+// Scenario: Reading typed fields from a message
+// Given a facility data message holding a runway record
+// When fields are read through a FacilityRecord for the runway layout
+// Then each field has the C++ type of its wire type and the value that was written
+TEST(FacilityLayoutTests, ReadsTypedFields) {
+    const MyRunway runway{ .position = { .latitude = 52.3, .longitude = 4.76, .altitude = -3.0 },
+                           .heading = 183.5F, .length = 3800.0F, .surface = RunwaySurface::Asphalt };
+    const auto buffer = makeMessage(&runway, sizeof(runway));
+    const FacilityRecord<runwayLayout> record(*reinterpret_cast<const Messages::FacilityDataMsg*>(buffer.data()));
+
+    static_assert(std::is_same_v<decltype(record.get<FacilityField::runwayLatitude>()), double>);
+    static_assert(std::is_same_v<decltype(record.get<FacilityField::runwayHeading>()), float>);
+    static_assert(std::is_same_v<decltype(record.get<FacilityField::runwaySurface>()), std::int32_t>);
+
+    EXPECT_DOUBLE_EQ(record.get<FacilityField::runwayLatitude>(), 52.3);
+    EXPECT_DOUBLE_EQ(record.get<FacilityField::runwayAltitude>(), -3.0);
+    EXPECT_FLOAT_EQ(record.get<FacilityField::runwayLength>(), 3800.0F);
+    EXPECT_EQ(record.get<FacilityField::runwaySurface>(), static_cast<std::int32_t>(RunwaySurface::Asphalt));
+    EXPECT_EQ(record.as<MyRunway>().heading, 183.5F);
+}
+
+
+// Scenario: Locating members through member pointers
+// Given a packed struct that inherits its position, and one that holds it as a member
+// When the offsets of their members are computed
+// Then they match the packed positions, also for inherited and nested members
+TEST(FacilityLayoutTests, LocatesMembers) {
+#pragma pack(push, 1)
+    struct MyWaypoint : LatLonAltMagVar {
+        std::array<char, ICAOLength> icao;
+        std::int32_t nRoutes;
+    };
+#pragma pack(pop)
+
+    EXPECT_EQ((memberOffset<MyWaypoint, &MyWaypoint::latitude>()), 0U);
+    EXPECT_EQ((memberOffset<MyWaypoint, &MyWaypoint::magVar>()), 24U);
+    EXPECT_EQ((memberOffset<MyWaypoint, &MyWaypoint::icao>()), 28U);
+    EXPECT_EQ((memberOffset<MyWaypoint, &MyWaypoint::nRoutes>()), 28U + ICAOLength);
+
+    EXPECT_EQ(myAirportMembers[5].offset, 8U + 8U + 24U);
+    EXPECT_EQ(myAirportMembers[5].size, sizeof(float));
+    EXPECT_EQ(myAirportMembers[6].offset, 8U + 8U + 28U);
+}
+
+
+// Scenario: Checking the hand-written facility structs
+// Given the builders' allFields() definitions
+// When their layouts are computed
+// Then the sizes and member offsets match the structs the library uses to decode them
+TEST(FacilityLayoutTests, MatchesLibraryStructs) {
+    constexpr auto all = Builder<128>{}.airport().allFields().runway().allFields().end().end().definition;
+    using AirportRecord = FacilityRecord<layoutOf(all, FacilityField::airportOpen)>;
+
+    EXPECT_EQ(AirportRecord::size(), sizeof(AirportData));
+    EXPECT_EQ(AirportRecord::offsetOf<FacilityField::airportRunways>() + 12 * sizeof(std::int32_t) + (MSFS_2024_SDK ? 8U : 0U), sizeof(AirportData));
+    EXPECT_TRUE(layoutMatches<RunwayData>(layoutOf(all, FacilityField::runwayOpen)));
+    EXPECT_TRUE(layoutMatches<RunwayData>(layoutOf(all, FacilityField::runwayOpen), RunwayData::facilityMembers()));
+    EXPECT_TRUE(layoutMatches<AirportData>(layoutOf(all, FacilityField::airportOpen), AirportData::facilityMembers()));
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
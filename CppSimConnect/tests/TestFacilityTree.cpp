@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/requests/facility_tree.hpp>
+#include <simconnect/util/monotonic_arena.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
+
+namespace {
+
+// Builds facility data messages with a 32-bit payload, in 8-byte aligned storage.
+class MessageStream {
+    std::vector<std::vector<std::uint64_t>> storage_;
+
+public:
+    const Messages::FacilityDataMsg& make(unsigned long requestId, FacilityDataType type, unsigned long uniqueId, unsigned long parentId,
+                                          std::uint32_t payload)
+    {
+        const auto size = sizeof(Messages::FacilityDataMsg) + sizeof(payload);
+        auto& buffer = storage_.emplace_back((size + 7) / 8);
+
+        auto& msg = *reinterpret_cast<Messages::FacilityDataMsg*>(buffer.data());
+        msg.dwID = static_cast<unsigned long>(Messages::facilityData);
+        msg.dwSize = static_cast<unsigned long>(size);
+        msg.dwVersion = 1;
+        msg.UserRequestId = requestId;
+        msg.UniqueRequestId = uniqueId;
+        msg.ParentUniqueRequestId = parentId;
+        msg.Type = type;
+        std::memcpy(&msg.Data, &payload, sizeof(payload));
+        return msg;
+    }
+};
+
+std::vector<std::uint32_t> payloads(FacilityNode::Children children) {
+    std::vector<std::uint32_t> result;
+    for (const auto& child : children) {
+        result.push_back(child.as<std::uint32_t>());
+    }
+    return result;
+}
+
+} // namespace
+
+
+// Scenario: Assembling an airport
+// Given the records of an airport with runways, a pavement, a frequency, and parkings
+// When they are added and the request is finished
+// Then the tree has the airport as root, children in the order received, and all nodes in one block in depth-first order
+TEST(FacilityTreeTests, AssemblesAirportTree) {
+    using namespace FacilityDataTypes;
+    MessageStream stream;
+    FacilityTreeAssembler assembler;
+
+    assembler.add(stream.make(7, airport, 1, 0, 1000));
+    assembler.add(stream.make(7, runway, 2, 1, 2001));
+    assembler.add(stream.make(7, pavement, 3, 2, 3001));
+    assembler.add(stream.make(7, runway, 4, 1, 2002));
+    assembler.add(stream.make(7, frequency, 5, 1, 4001));
+    assembler.add(stream.make(7, taxiParking, 6, 1, 5001));
+    assembler.add(stream.make(7, taxiParking, 7, 1, 5002));
+    EXPECT_EQ(assembler.active(), 1U);
+
+    const auto tree = assembler.finish(7);
+    EXPECT_EQ(assembler.active(), 0U);
+    ASSERT_FALSE(tree.empty());
+    EXPECT_EQ(tree.nodeCount(), 7U);
+
+    const auto* root = tree.root();
+    EXPECT_EQ(root->type, airport);
+    EXPECT_EQ(root->as<std::uint32_t>(), 1000U);
+    using LargeRecord = std::array<std::byte, 256>;
+    EXPECT_THROW((void)root->as<LargeRecord>(), SimConnectException);
+    EXPECT_EQ(root->childCount, 5U);
+    EXPECT_EQ(payloads(root->children()), (std::vector<std::uint32_t>{ 2001, 2002, 4001, 5001, 5002 }));
+    EXPECT_EQ(payloads(root->children(runway)), (std::vector<std::uint32_t>{ 2001, 2002 }));
+    EXPECT_EQ(payloads(root->children(taxiParking)), (std::vector<std::uint32_t>{ 5001, 5002 }));
+
+    const auto& firstRunway = *root->children(runway).begin();
+    EXPECT_EQ(firstRunway.parent, root);
+    EXPECT_EQ(payloads(firstRunway.children(pavement)), (std::vector<std::uint32_t>{ 3001 }));
+
+    // Depth-first: airport, runway, pavement, runway, frequency, parking, parking
+    std::vector<std::uint32_t> order;
+    for (std::size_t i = 0; i < tree.nodeCount(); ++i) {
+        EXPECT_EQ(tree.nodes()[i].index, i);
+        order.push_back(tree.nodes()[i].as<std::uint32_t>());
+    }
+    EXPECT_EQ(order, (std::vector<std::uint32_t>{ 1000, 2001, 3001, 2002, 4001, 5001, 5002 }));
+
+    const auto* begin = reinterpret_cast<const std::byte*>(tree.nodes());
+    for (std::size_t i = 0; i < tree.nodeCount(); ++i) {
+        EXPECT_GE(tree.nodes()[i].data, begin);
+        EXPECT_LT(tree.nodes()[i].data, begin + tree.bytes());
+    }
+}
+
+
+// Scenario: Interleaved requests
+// Given records of two requests arriving interleaved, and a record with an unknown parent
+// When both requests are finished
+// Then each gets its own tree, the orphan is dropped, and discarded or unknown requests give empty trees
+TEST(FacilityTreeTests, KeepsInterleavedRequestsApart) {
+    using namespace FacilityDataTypes;
+    MessageStream stream;
+    FacilityTreeAssembler assembler;
+
+    assembler.add(stream.make(1, airport, 10, 0, 100));
+    assembler.add(stream.make(2, airport, 10, 0, 200));
+    assembler.add(stream.make(1, runway, 11, 10, 101));
+    assembler.add(stream.make(2, runway, 11, 10, 201));
+    assembler.add(stream.make(2, runway, 12, 10, 202));
+    assembler.add(stream.make(1, pavement, 13, 99, 999));
+    assembler.add(stream.make(3, airport, 10, 0, 300));
+    EXPECT_EQ(assembler.active(), 3U);
+
+    const auto first = assembler.finish(1);
+    const auto second = assembler.finish(2);
+    assembler.discard(3);
+    EXPECT_EQ(assembler.active(), 0U);
+    EXPECT_EQ(assembler.orphans(), 1U);
+
+    EXPECT_EQ(first.nodeCount(), 2U);
+    EXPECT_EQ(payloads(first.root()->children()), (std::vector<std::uint32_t>{ 101 }));
+    EXPECT_EQ(second.nodeCount(), 3U);
+    EXPECT_EQ(payloads(second.root()->children()), (std::vector<std::uint32_t>{ 201, 202 }));
+
+    EXPECT_TRUE(assembler.finish(3).empty());
+    EXPECT_EQ(assembler.finish(4).root(), nullptr);
+}
+
+
+// Scenario: Records with unique IDs out of order
+// Given an airport whose runways have lower unique IDs than the airport, and a pavement under the first runway
+// When they are added and the request is finished
+// Then the records are still linked to their parents
+TEST(FacilityTreeTests, LinksRecordsWithUnorderedIds) {
+    using namespace FacilityDataTypes;
+    MessageStream stream;
+    FacilityTreeAssembler assembler;
+
+    assembler.add(stream.make(5, airport, 50, 0, 100));
+    assembler.add(stream.make(5, runway, 20, 50, 201));
+    assembler.add(stream.make(5, runway, 10, 50, 202));
+    assembler.add(stream.make(5, pavement, 30, 20, 301));
+
+    const auto tree = assembler.finish(5);
+    EXPECT_EQ(tree.nodeCount(), 4U);
+    EXPECT_EQ(assembler.orphans(), 0U);
+    EXPECT_EQ(payloads(tree.root()->children(runway)), (std::vector<std::uint32_t>{ 201, 202 }));
+    EXPECT_EQ(payloads(tree.root()->children(runway).begin()->children()), (std::vector<std::uint32_t>{ 301 }));
+}
+
+
+// Scenario: Reusing an arena
+// Given an arena with a small first chunk
+// When more is allocated than fits in one chunk, and the arena is reset
+// Then earlier allocations keep their address while growing, and the reset arena keeps its largest chunk
+TEST(FacilityTreeTests, ArenaPointersAreStable) {
+    MonotonicArena arena(64);
+
+    std::vector<std::uint64_t*> values;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        values.push_back(arena.create<std::uint64_t>(i));
+    }
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(*values[i], i);
+    }
+    EXPECT_EQ(arena.used(), 800U);
+
+    const auto capacity = arena.capacity();
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0U);
+    EXPECT_LT(arena.capacity(), capacity);
+    EXPECT_GE(arena.capacity(), 512U);
+
+    const auto* before = arena.allocate(8, 8);
+    arena.reset();
+    EXPECT_EQ(arena.allocate(8, 8), before);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cppcoreguidelines-pro-type-reinterpret-cast)
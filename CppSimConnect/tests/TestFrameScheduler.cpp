@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/events/event_handler.hpp>
+#include <simconnect/events/frame_scheduler.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: a real Connection for event() bookkeeping, with a queue of Frame events to dispatch.
+class FrameMockConnection : public Connection<FrameMockConnection, false, NullLogger> {
+    std::vector<Messages::EventFrameMsg> frames_;
+    std::size_t frameIndex_{ 0 };
+
+public:
+    std::map<std::string, EventId> systemEvents;
+
+    void addFrame(float frameRate) {
+        Messages::EventFrameMsg msg{};
+        msg.dwID = static_cast<unsigned long>(Messages::eventFrame);
+        msg.dwSize = sizeof(msg);
+        msg.dwVersion = 1;
+        msg.uGroupID = unknownGroup;
+        msg.uEventID = systemEvents.at("Frame");
+        msg.fFrameRate = frameRate;
+        msg.fSimSpeed = 1.0f;
+        frames_.push_back(msg);
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (frameIndex_ < frames_.size()) {
+            const auto& msg = frames_[frameIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(&msg), msg.dwSize);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+
+    FrameMockConnection& subscribeToSystemEvent(SimConnect::event evt) {
+        systemEvents.emplace(evt.name(), evt.id());
+        return *this;
+    }
+};
+
+using TestHandler = SimpleHandler<FrameMockConnection>;
+
+
+// A clock that only moves when the tasks say so.
+using TaskClock = ManualClock<struct TaskClockTag>;
+
+
+// Scenario: Running tasks by priority within the budget
+// Given a 1ms budget and three tasks of 600us, 600us, and 100us with decreasing priority
+// When two frames are run
+// Then the lowest priority task is deferred in the first frame, and runs first in the second
+// And the overruns are counted for the task that crossed the budget and for the frames
+TEST(FrameSchedulerTests, TasksRunByPriorityAndDeferWhenOverBudget) {
+    FrameMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    FrameScheduler<TestHandler, TaskClock> scheduler(eventHandler, { .budget = 1000us, .runOnFrame = false });
+
+    std::vector<std::string> ran;
+    const auto ai = scheduler.add("ai", 10, [&ran](const FrameInfo&) { ran.emplace_back("ai"); TaskClock::advance(600us); });
+    const auto writes = scheduler.add("writes", 5, [&ran](const FrameInfo&) { ran.emplace_back("writes"); TaskClock::advance(600us); });
+    const auto ui = scheduler.add("ui", 1, [&ran](const FrameInfo&) { ran.emplace_back("ui"); TaskClock::advance(100us); });
+
+    EXPECT_EQ(scheduler.runFrame(), 2U);
+    EXPECT_EQ(ran, (std::vector<std::string>{ "ai", "writes" }));
+
+    ran.clear();
+    EXPECT_EQ(scheduler.runFrame(), 3U);
+    EXPECT_EQ(ran, (std::vector<std::string>{ "ui", "ai", "writes" }));
+
+    const auto stats = scheduler.stats();
+    EXPECT_EQ(stats.frames, 2U);
+    EXPECT_EQ(stats.overrunFrames, 2U);
+    EXPECT_EQ(stats.deferrals, 1U);
+    EXPECT_EQ(stats.lastFrameTime, 1300us);
+    EXPECT_EQ(stats.maxFrameTime, 1300us);
+
+    EXPECT_EQ(scheduler.taskStats(ui)->deferrals, 1U);
+    EXPECT_EQ(scheduler.taskStats(ui)->runs, 1U);
+    EXPECT_EQ(scheduler.taskStats(writes)->overruns, 2U);
+    EXPECT_EQ(scheduler.taskStats(writes)->totalTime, 1200us);
+    EXPECT_EQ(scheduler.taskStats(ai)->overruns, 0U);
+    EXPECT_EQ(scheduler.taskStats(ai)->maxTime, 600us);
+}
+
+
+// Scenario: One-shot tasks and removal
+// Given a recurring task that posts a one-shot task and a task that removes itself
+// When frames are run
+// Then the one-shot task runs once, in the next frame, and the removed task no longer runs
+TEST(FrameSchedulerTests, PostedTasksRunOnceAndTasksCanBeRemoved) {
+    FrameMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    FrameScheduler<TestHandler, TaskClock> scheduler(eventHandler, { .runOnFrame = false });
+
+    int posted{ 0 };
+    int selfRemoving{ 0 };
+    [[maybe_unused]] auto poster = scheduler.add("poster", 0, [&scheduler, &posted](const FrameInfo& info) {
+        if (info.frame == 1) {
+            [[maybe_unused]] auto id = scheduler.post("write", 0, [&posted](const FrameInfo&) { ++posted; });
+        }
+    });
+    FrameScheduler<TestHandler, TaskClock>::TaskId selfId{ 0 };
+    selfId = scheduler.add("once", 0, [&scheduler, &selfRemoving, &selfId](const FrameInfo&) {
+        ++selfRemoving;
+        scheduler.remove(selfId);
+    });
+
+    EXPECT_EQ(scheduler.runFrame(), 2U);
+    EXPECT_EQ(scheduler.size(), 2U);
+    EXPECT_EQ(scheduler.runFrame(), 2U);
+    EXPECT_EQ(scheduler.runFrame(), 1U);
+
+    EXPECT_EQ(posted, 1);
+    EXPECT_EQ(selfRemoving, 1);
+    EXPECT_EQ(scheduler.size(), 1U);
+    EXPECT_FALSE(scheduler.taskStats(selfId).has_value());
+}
+
+
+// Scenario: A task that throws
+// Given two tasks, the higher priority one throwing in the first frame only
+// When two frames are run
+// Then the exception is passed on, and the next frame runs both tasks again
+TEST(FrameSchedulerTests, ThrowingTaskLeavesSchedulerUsable) {
+    FrameMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    FrameScheduler<TestHandler, TaskClock> scheduler(eventHandler, { .runOnFrame = false });
+
+    std::vector<std::string> ran;
+    [[maybe_unused]] auto thrower = scheduler.add("thrower", 10, [&ran](const FrameInfo& info) {
+        ran.emplace_back("thrower");
+        if (info.frame == 1) {
+            throw std::runtime_error("task failed");
+        }
+    });
+    [[maybe_unused]] auto other = scheduler.add("other", 1, [&ran](const FrameInfo&) { ran.emplace_back("other"); });
+
+    EXPECT_THROW((void)scheduler.runFrame(), std::runtime_error);
+    EXPECT_EQ(scheduler.runFrame(), 2U);
+
+    EXPECT_EQ(ran, (std::vector<std::string>{ "thrower", "thrower", "other" }));
+    EXPECT_EQ(scheduler.size(), 2U);
+}
+
+
+// Scenario: Driven by the Frame system event
+// Given a scheduler subscribed to the Frame event
+// When two Frame events are dispatched
+// Then the task runs twice and sees the frame rate reported by the simulator
+TEST(FrameSchedulerTests, FrameEvents_RunTheTasks) {
+    FrameMockConnection connection;
+    TestHandler handler(connection);
+    EventHandler<TestHandler> eventHandler(handler);
+    FrameScheduler<TestHandler> scheduler(eventHandler);
+
+    std::vector<float> frameRates;
+    [[maybe_unused]] auto id = scheduler.add("rates", 0, [&frameRates](const FrameInfo& info) {
+        frameRates.push_back(info.frameRate);
+        EXPECT_GT(info.remaining.count(), 0);
+    });
+
+    connection.addFrame(30.0f);
+    connection.addFrame(60.0f);
+    handler.handle();
+
+    EXPECT_EQ(frameRates, (std::vector<float>{ 30.0f, 60.0f }));
+    EXPECT_EQ(scheduler.stats().frames, 2U);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/ai/simobjects/ini_file.hpp>
+
+using namespace SimConnect::AI;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
+
+namespace {
+
+constexpr std::string_view aircraftCfg{
+    "version = 1 ; before any section\r\n"
+    "[GENERAL]\r\n"
+    "Category = \"Airplane\" // a comment\r\n"
+    "\r\n"
+    "[FLTSIM.1]\n"
+    "title = 'Cessna 172 Floats'\n"
+    "[fltsim.0]\n"
+    "title=\"Cessna 172\"\n"
+    "model = \n"
+    "not a key value line\n"
+    "title = \"Cessna 172 Skyhawk\"\n"
+    "[ \"Empty\" ]\n"
+    "[general]\n"
+    "performance = fast"
+};
+
+} // namespace
+
+
+// Scenario: Looking up values
+// Given the text of a typical aircraft.cfg, with comments, quotes, mixed case, and CRLF line ends
+// When values are looked up
+// Then sections and keys match regardless of case, quotes and comments are stripped, and the last duplicate wins
+TEST(IniFileTests, LooksUpValues) {
+    IniFile ini;
+    ini.parse(aircraftCfg);
+
+    EXPECT_EQ(ini.get("general", "category"), "Airplane");
+    EXPECT_EQ(ini.view("GENERAL", "CATEGORY"), "Airplane");
+    EXPECT_EQ(ini.get("general", "performance"), "fast");
+    EXPECT_EQ(ini.get("fltsim.0", "title"), "Cessna 172 Skyhawk");
+    EXPECT_EQ(ini.get("FLTSIM.1", "Title"), "Cessna 172 Floats");
+    EXPECT_EQ(ini.get("fltsim.0", "model"), "");
+    EXPECT_EQ(ini.get("", "version"), "1");
+    EXPECT_FALSE(ini.get("fltsim.2", "title").has_value());
+    EXPECT_FALSE(ini.view("general", "title").has_value());
+
+    std::vector<std::string> sections;
+    for (const auto section : ini.sections()) {
+        sections.emplace_back(section);
+    }
+    EXPECT_EQ(sections, (std::vector<std::string>{ "", "Empty", "fltsim.0", "FLTSIM.1", "GENERAL" }));
+    EXPECT_TRUE(ini.contains("empty"));
+    EXPECT_FALSE(ini.contains("fltsim.2"));
+    EXPECT_EQ(ini.entries().size(), 6U);
+}
+
+
+// Scenario: Loading files
+// Given a cfg file, an empty file, and a missing file
+// When they are loaded
+// Then the cfg file's values are found, and the others give an empty IniFile
+TEST(IniFileTests, LoadsFiles) {
+    const auto dir = std::filesystem::temp_directory_path() / "TestIniFile";
+    std::filesystem::create_directories(dir);
+    std::ofstream(dir / "aircraft.cfg", std::ios::binary) << aircraftCfg;
+    std::ofstream(dir / "empty.cfg", std::ios::binary).flush();
+
+    IniFile ini;
+    EXPECT_TRUE(ini.load(dir / "aircraft.cfg"));
+    EXPECT_EQ(ini.get("fltsim.0", "title"), "Cessna 172 Skyhawk");
+
+    IniFile moved(std::move(ini));
+    EXPECT_EQ(moved.view("general", "category"), "Airplane");
+
+    EXPECT_FALSE(moved.load(dir / "empty.cfg"));
+    EXPECT_TRUE(moved.entries().empty());
+    EXPECT_FALSE(moved.load(dir / "missing.cfg"));
+    EXPECT_TRUE(moved.sections().empty());
+
+    std::filesystem::remove_all(dir);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/util/null_logger.hpp>
+#include <simconnect/requests/jetway_batch.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Mock connection: records jetway requests in the send history, and dispatches the answers the test queues.
+class JetwayMockConnection : public Connection<JetwayMockConnection, false, NullLogger> {
+public:
+    struct Sent {
+        SendId sendId;
+        std::string icao;
+        std::vector<int> indices;
+    };
+
+private:
+    std::vector<std::vector<std::uint64_t>> messages_;
+    std::size_t messageIndex_{ 0 };
+    SendId nextSendId_{ 1 };
+
+    template <class T>
+    T& newMessage(MessageId id, std::size_t size = sizeof(T)) {
+        auto& buffer = messages_.emplace_back((size + 7) / 8);
+        auto& msg = *reinterpret_cast<T*>(buffer.data());
+        msg.dwID = static_cast<unsigned long>(id);
+        msg.dwSize = static_cast<unsigned long>(size);
+        msg.dwVersion = 1;
+        return msg;
+    }
+
+public:
+    std::vector<Sent> sent;
+
+    JetwayMockConnection& requestJetwayData(std::string_view icaoCode, std::span<const int> jetwayIndices) {
+        const auto sendId = nextSendId_++;
+        sendHistory().record(sendId, "SimConnect_RequestJetwayData", unused, icaoCode);
+        sent.push_back({ sendId, std::string(icaoCode), { jetwayIndices.begin(), jetwayIndices.end() } });
+        return *this;
+    }
+
+    [[nodiscard]] SendId fetchSendId() const { return nextSendId_ - 1; }
+
+    // Answers with the given parking indices, split over messages of at most perMessage jetways.
+    void answer(const std::string& icao, const std::vector<int>& parkings, std::size_t perMessage = 8) {
+        const auto count = std::max<std::size_t>((parkings.size() + perMessage - 1) / perMessage, 1);
+        for (std::size_t part = 0; part < count; ++part) {
+            const auto first = part * perMessage;
+            const auto size = std::min(perMessage, parkings.size() - std::min(first, parkings.size()));
+            auto& msg = newMessage<Messages::JetwayDataMsg>(Messages::jetwayData,
+                sizeof(Messages::JetwayDataMsg) + ((std::max<std::size_t>(size, 1) - 1) * sizeof(SIMCONNECT_JETWAY_DATA)));
+            msg.dwArraySize = static_cast<unsigned long>(size);
+            msg.dwEntryNumber = static_cast<unsigned long>(part);
+            msg.dwOutOf = static_cast<unsigned long>(count);
+            for (std::size_t i = 0; i < size; ++i) {
+                icao.copy(&msg.rgData[i].AirportIcao[0], sizeof(msg.rgData[i].AirportIcao));
+                msg.rgData[i].ParkingIndex = parkings[first + i];
+            }
+        }
+    }
+
+    void raise(const Sent& request) {
+        auto& msg = newMessage<Messages::ExceptionMsg>(Messages::exception);
+        msg.dwSendID = request.sendId;
+        msg.dwException = Exceptions::jetwayData;
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, unsigned long)>& dispatchFunc) {
+        if (messageIndex_ < messages_.size()) {
+            const auto& msg = messages_[messageIndex_++];
+            dispatchFunc(reinterpret_cast<const SIMCONNECT_RECV*>(msg.data()), reinterpret_cast<const SIMCONNECT_RECV*>(msg.data())->dwSize);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const { return true; }
+};
+
+using TestHandler = SimpleHandler<JetwayMockConnection>;
+
+
+namespace {
+
+std::vector<int> parkingsOf(const AirportJetways& airport) {
+    std::vector<int> result;
+    for (const auto& jetway : airport.jetways) {
+        result.push_back(jetway.parkingIndex);
+    }
+    return result;
+}
+
+} // namespace
+
+
+// Scenario: Coalescing jetway queries per airport
+// Given queries for three airports, two of which are named more than once
+// When the batch is sent and all airports are answered, one of them in several messages
+// Then there is one call per airport with the merged indices, and one callback with all jetways per airport
+TEST(JetwayBatchTests, CoalescesPerAirport) {
+    JetwayMockConnection connection;
+    TestHandler handler(connection);
+
+    const std::vector<int> ehamGates{ 4, 2 };
+    const std::vector<int> ehamMore{ 2, 7 };
+    const std::vector<int> egllGates{ 1 };
+    const std::vector<JetwayQuery> queries{
+        { .icao = "EHAM", .indices = ehamGates },
+        { .icao = "EGLL", .indices = egllGates },
+        { .icao = "EHAM", .indices = ehamMore },
+        { .icao = "KJFK" },
+        { .icao = "EGLL" },
+    };
+
+    int calls{ 0 };
+    JetwayBatch<TestHandler> batch(handler, queries, [&calls](std::span<const AirportJetways> airports) {
+        ++calls;
+        EXPECT_EQ(airports.size(), 3U);
+    });
+
+    ASSERT_EQ(connection.sent.size(), 3U);
+    EXPECT_EQ(connection.sent[0].icao, "EHAM");
+    EXPECT_EQ(connection.sent[0].indices, (std::vector<int>{ 2, 4, 7 }));
+    EXPECT_EQ(connection.sent[1].icao, "EGLL");
+    EXPECT_TRUE(connection.sent[1].indices.empty());
+    EXPECT_TRUE(connection.sent[2].indices.empty());
+
+    std::vector<int> jfkGates(20);
+    for (std::size_t i = 0; i < jfkGates.size(); ++i) {
+        jfkGates[i] = static_cast<int>(i);
+    }
+    connection.answer("KJFK", jfkGates, 8);
+    connection.answer("EHAM", { 2, 4, 7 });
+    handler.handle();
+    EXPECT_EQ(calls, 0);
+    EXPECT_FALSE(batch.done());
+
+    connection.answer("EGLL", { 1, 3 });
+    handler.handle();
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(batch.done());
+
+    ASSERT_NE(batch.find("KJFK"), nullptr);
+    EXPECT_EQ(parkingsOf(*batch.find("KJFK")), jfkGates);
+    EXPECT_EQ(parkingsOf(*batch.find("EHAM")), (std::vector<int>{ 2, 4, 7 }));
+    EXPECT_EQ(parkingsOf(*batch.find("EGLL")), (std::vector<int>{ 1, 3 }));
+    EXPECT_FALSE(batch.find("EGLL")->failed);
+    EXPECT_EQ(batch.find("EDDF"), nullptr);
+}
+
+
+// Scenario: Airports without jetways, and failed requests
+// Given a batch for three airports, sent after a request for another airport
+// When one is answered without jetways, one with an exception, and one normally, and the other airport is answered too
+// Then the empty answer goes to the airport whose turn it is, the exception marks its airport as failed, and the
+// answer for the airport outside the batch is ignored
+TEST(JetwayBatchTests, EmptyAnswersAndExceptions) {
+    JetwayMockConnection connection;
+    TestHandler handler(connection);
+
+    int calls{ 0 };
+    JetwayBatch<TestHandler> batch(handler, [&calls](std::span<const AirportJetways>) { ++calls; });
+    batch.add("EHRD").add("EHAM").add("EHGG");
+    EXPECT_FALSE(batch.done());
+    connection.requestJetwayData("EDDF", {});
+    batch.send();
+    ASSERT_EQ(connection.sent.size(), 4U);
+    EXPECT_THROW(batch.add("EHAM", std::vector<int>{ 1 }), SimConnectException);
+
+    connection.answer("EDDF", { 5 });
+    connection.answer("EHRD", {});
+    connection.raise(connection.sent[2]);
+    connection.answer("EHGG", { 9 });
+    handler.handle();
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(batch.find("EHRD")->complete);
+    EXPECT_TRUE(batch.find("EHRD")->jetways.empty());
+    EXPECT_TRUE(batch.find("EHAM")->failed);
+    EXPECT_EQ(parkingsOf(*batch.find("EHGG")), (std::vector<int>{ 9 }));
+}
+
+
+// Scenario: Answers for other calls
+// Given a batch for two airports, and another call for one of them that fails
+// When the exception for the other call arrives, and then the answers for the batch
+// Then the exception is ignored, and the callback is called once, also when the batch is sent again without new
+// airports
+TEST(JetwayBatchTests, AnswersForOtherCalls) {
+    JetwayMockConnection connection;
+    TestHandler handler(connection);
+
+    int calls{ 0 };
+    JetwayBatch<TestHandler> batch(handler, [&calls](std::span<const AirportJetways>) { ++calls; });
+    batch.add("EHRD").add("EHAM").send();
+    connection.requestJetwayData("EHAM", std::vector<int>{ 99 });
+    ASSERT_EQ(connection.sent.size(), 3U);
+
+    connection.raise(connection.sent[2]);
+    handler.handle();
+    EXPECT_FALSE(batch.find("EHAM")->complete);
+
+    connection.answer("EHRD", {});
+    connection.answer("EHAM", { 3 });
+    handler.handle();
+    EXPECT_TRUE(batch.done());
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(batch.find("EHRD")->complete);
+    EXPECT_TRUE(batch.find("EHRD")->jetways.empty());
+    EXPECT_FALSE(batch.find("EHAM")->failed);
+    EXPECT_EQ(parkingsOf(*batch.find("EHAM")), (std::vector<int>{ 3 }));
+
+    connection.answer("EHRD", {});
+    handler.handle();
+    batch.send();
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(connection.sent.size(), 3U);
+}
+
+
+// Scenario: An empty batch
+// Given a batch without airports
+// When it is sent
+// Then the callback is called straight away, without any requests
+TEST(JetwayBatchTests, EmptyBatch) {
+    JetwayMockConnection connection;
+    TestHandler handler(connection);
+
+    int calls{ 0 };
+    JetwayBatch<TestHandler> batch(handler, std::span<const JetwayQuery>{}, [&calls](std::span<const AirportJetways> airports) {
+        ++calls;
+        EXPECT_TRUE(airports.empty());
+    });
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(batch.done());
+    EXPECT_TRUE(connection.sent.empty());
+
+    batch.send();
+    EXPECT_EQ(calls, 1);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner,cppcoreguidelines-pro-type-reinterpret-cast)
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/util/json_cursor.hpp>
+#include <simconnect/util/json_writer.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(misc-include-cleaner)
+
+constexpr std::string_view efbMessage{ R"({
+    "type": "weights",
+    "aircraft": { "icao": "A20N", "registration": "PH-ÉFB" },
+    "payload": [ { "station": "pax", "kg": 7560.5 }, { "station": "cargo", "kg": 1200 } ],
+    "final": true,
+    "note": null
+})" };
+
+
+// Scenario: Navigating a typical EFB message
+// Given a JSON payload with nested objects and arrays
+// When I look up members and elements through the cursor
+// Then I should get the values, without copying the text
+TEST(JsonCursorTests, NavigatesObjectsAndArrays) {
+    const JsonCursor doc(efbMessage);
+
+    ASSERT_TRUE(doc.isValid());
+    EXPECT_TRUE(doc.isObject());
+    EXPECT_EQ(doc.size(), 5U);
+    EXPECT_TRUE(doc["type"].equals("weights"));
+    EXPECT_EQ(doc["aircraft"]["icao"].rawString(), "A20N");
+    EXPECT_EQ(doc["payload"].size(), 2U);
+    EXPECT_EQ(doc["payload"].at(0)["kg"].asNumber<double>(), 7560.5);
+    EXPECT_EQ(doc["payload"].at(1)["kg"].asNumber<int>(), 1200);
+    EXPECT_EQ(doc["final"].asBool(), true);
+    EXPECT_TRUE(doc["note"].isNull());
+
+    const auto raw = doc["type"].rawString();
+    ASSERT_TRUE(raw.has_value());
+    EXPECT_GE(raw->data(), efbMessage.data());
+    EXPECT_LT(raw->data(), efbMessage.data() + efbMessage.size());
+}
+
+// Scenario: Looking up something that is not there
+// Given a valid document
+// When I ask for missing keys, out-of-range indices, or values of the wrong type
+// Then I should get invalid cursors and empty optionals rather than exceptions
+TEST(JsonCursorTests, MissingValuesAreInvalid) {
+    const JsonCursor doc(efbMessage);
+
+    EXPECT_FALSE(doc["missing"].isValid());
+    EXPECT_FALSE(doc["missing"]["deeper"].isValid());
+    EXPECT_FALSE(doc["payload"].at(2).isValid());
+    EXPECT_FALSE(doc["type"].asNumber<double>().has_value());
+    EXPECT_FALSE(doc["payload"].at(0)["kg"].asNumber<int>().has_value());
+    EXPECT_FALSE(doc["final"].rawString().has_value());
+}
+
+// Scenario: Iterating members and elements
+// Given an object and an array
+// When I iterate them with range-based for loops
+// Then I should see every member and element in order
+TEST(JsonCursorTests, IteratesMembersAndElements) {
+    const JsonCursor doc(R"({"a": 1, "b": [true, false, null], "c": {"d": "e"}})");
+
+    std::vector<std::string> keys;
+    for (const auto& member : doc.members()) {
+        keys.emplace_back(member.rawKey);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{ "a", "b", "c" }));
+
+    std::vector<JsonCursor::Type> types;
+    for (const auto& element : doc["b"].elements()) {
+        types.push_back(element.type());
+    }
+    EXPECT_EQ(types, (std::vector<JsonCursor::Type>{ JsonCursor::Type::boolean, JsonCursor::Type::boolean, JsonCursor::Type::null }));
+
+    EXPECT_EQ(JsonCursor("[]").size(), 0U);
+    EXPECT_EQ(JsonCursor("{}").size(), 0U);
+}
+
+// Scenario: Strings with escapes
+// Given strings containing escapes, including a surrogate pair
+// When I compare, append, or copy them
+// Then the unescaped UTF-8 value should be used
+TEST(JsonCursorTests, UnescapesStrings) {
+    const JsonCursor doc(R"({"quote\"key": "line\nbreak \"quoted\" é 😀"})");
+
+    const auto value = doc["quote\"key"];
+    ASSERT_TRUE(value.isString());
+    EXPECT_TRUE(value.equals("line\nbreak \"quoted\" \xC3\xA9 \xF0\x9F\x98\x80"));
+    EXPECT_FALSE(value.equals("line\nbreak"));
+
+    std::string out;
+    EXPECT_TRUE(value.appendTo(out));
+    EXPECT_EQ(out, "line\nbreak \"quoted\" \xC3\xA9 \xF0\x9F\x98\x80");
+
+    std::array<char, 8> small{};
+    EXPECT_FALSE(value.copyTo(small.data(), small.size()).has_value());
+    EXPECT_EQ(doc["quote\"key"].raw().front(), '"');
+    EXPECT_EQ(JsonCursor(R"("abc")").copyTo(small.data(), small.size()), 3U);
+}
+
+// Scenario: Malformed documents
+// Given texts that are not a single well-formed JSON value
+// When I create cursors for them
+// Then the cursors should be invalid
+TEST(JsonCursorTests, RejectsMalformedDocuments) {
+    EXPECT_FALSE(JsonCursor("").isValid());
+    EXPECT_FALSE(JsonCursor("   ").isValid());
+    EXPECT_FALSE(JsonCursor(R"({"a": 1)").isValid());
+    EXPECT_FALSE(JsonCursor(R"({"a": [1, 2})").isValid());
+    EXPECT_FALSE(JsonCursor(R"("unterminated)").isValid());
+    EXPECT_FALSE(JsonCursor("{} {}").isValid());
+    EXPECT_FALSE(JsonCursor("tru").isValid());
+    EXPECT_TRUE(JsonCursor(" 42 ").isValid());
+}
+
+// Scenario: Evaluating at compile time
+// Given a literal JSON document
+// When it is navigated in a constant expression
+// Then the result should be available at compile time
+TEST(JsonCursorTests, WorksInConstantExpressions) {
+    static_assert(JsonCursor(R"({"mode": "cruise"})")["mode"].equals("cruise"));
+    static_assert(JsonCursor("[1, 2, 3]").size() == 3);
+    SUCCEED();
+}
+
+// Scenario: Writing a message
+// Given a JSON writer
+// When I write nested objects and arrays with various value types
+// Then the output should be valid, compact JSON that reads back the same
+TEST(JsonWriterTests, WritesNestedValues) {
+    JsonWriter writer;
+    writer.beginObject()
+        .member("type", "weights")
+        .key("aircraft").beginObject().member("icao", "A20N").endObject()
+        .key("payload").beginArray()
+            .beginObject().member("station", "pax").member("kg", 7560.5).endObject()
+            .beginObject().member("station", "cargo").member("kg", 1200).endObject()
+        .endArray()
+        .member("final", true)
+        .member("note", nullptr)
+        .endObject();
+
+    EXPECT_EQ(writer.depth(), 0U);
+    EXPECT_EQ(writer.view(), R"({"type":"weights","aircraft":{"icao":"A20N"},"payload":[{"station":"pax","kg":7560.5},{"station":"cargo","kg":1200}],"final":true,"note":null})");
+
+    const JsonCursor doc(writer.view());
+    ASSERT_TRUE(doc.isValid());
+    EXPECT_EQ(doc["payload"].at(1)["kg"].asNumber<int>(), 1200);
+}
+
+// Scenario: Escaping strings
+// Given strings with quotes, backslashes, and control characters
+// When they are written
+// Then they should be escaped, and read back unchanged
+TEST(JsonWriterTests, EscapesStrings) {
+    JsonWriter writer;
+    const std::string_view text{ "say \"hi\"\\\n\x01" };
+    writer.beginArray().value(text).endArray();
+
+    EXPECT_EQ(writer.view(), R"(["say \"hi\"\\\n\u0001"])");
+    EXPECT_TRUE(JsonCursor(writer.view()).at(0).equals(text));
+}
+
+// Scenario: Reusing a writer
+// Given a writer that has written a message
+// When it is cleared and reused
+// Then the new message should not contain any of the old one, and the buffer should be reused
+TEST(JsonWriterTests, ClearKeepsCapacity) {
+    JsonWriter writer(256);
+    writer.beginObject().member("a", 1).endObject();
+    const auto* storage = writer.view().data();
+
+    writer.clear().beginArray().value(1).value(2.5).value(-3).endArray();
+
+    EXPECT_EQ(writer.view(), "[1,2.5,-3]");
+    EXPECT_EQ(writer.view().data(), storage);
+}
+
+//NOLINTEND(misc-include-cleaner)
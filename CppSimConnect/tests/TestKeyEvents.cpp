@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <set>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/events/key_events.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(misc-include-cleaner)
+
+// Scenario: Resolving a Key Event at compile time
+// Given the Key Event catalog
+// When a known name is looked up in a constant expression
+// Then its fixed ID should be available at compile time, and map back to the name
+TEST(KeyEventsTests, KnownNameIsCompileTimeConstant) {
+    constexpr EventId apMaster = KeyEvents::id("AP_MASTER");
+
+    static_assert(apMaster == KeyEvents::firstId);
+    static_assert(KeyEvents::contains(apMaster));
+    static_assert(KeyEvents::name(apMaster) == "AP_MASTER");
+    EXPECT_EQ(KeyEvents::find("AP_MASTER"), apMaster);
+}
+
+// Scenario: Looking up every name
+// Given the Key Event catalog
+// When every name in it is looked up
+// Then each should resolve to its own index, so the hash table is collision-free
+TEST(KeyEventsTests, AllNamesResolveToTheirIndex) {
+    std::set<EventId> ids;
+    for (std::size_t i = 0; i < KeyEvents::count; ++i) {
+        const auto id = KeyEvents::find(KeyEvents::names[i]);
+        ASSERT_TRUE(id.has_value()) << KeyEvents::names[i];
+        EXPECT_EQ(*id, KeyEvents::firstId + i);
+        ids.insert(*id);
+    }
+    EXPECT_EQ(ids.size(), KeyEvents::count);
+}
+
+// Scenario: Looking up names that are not in the catalog
+// Given the Key Event catalog
+// When unknown, lower case, or partial names are looked up
+// Then nothing should be found
+TEST(KeyEventsTests, UnknownNamesAreNotFound) {
+    EXPECT_FALSE(KeyEvents::find("").has_value());
+    EXPECT_FALSE(KeyEvents::find("ap_master").has_value());
+    EXPECT_FALSE(KeyEvents::find("AP_MASTE").has_value());
+    EXPECT_FALSE(KeyEvents::find("MY_CUSTOM.EVENT").has_value());
+    EXPECT_FALSE(KeyEvents::contains(1));
+    EXPECT_TRUE(KeyEvents::name(1).empty());
+}
+
+// Scenario: Tracking mapped events
+// Given a MappedEventSet
+// When catalog and dynamically allocated IDs are inserted
+// Then both kinds should be found until the set is cleared
+TEST(KeyEventsTests, MappedEventSetTracksBothKinds) {
+    MappedEventSet mapped;
+    const auto gearUp = KeyEvents::id("GEAR_UP");
+
+    mapped.insert(gearUp);
+    mapped.insert(42);
+
+    EXPECT_TRUE(mapped.contains(gearUp));
+    EXPECT_TRUE(mapped.contains(42));
+    EXPECT_FALSE(mapped.contains(KeyEvents::id("GEAR_DOWN")));
+    EXPECT_FALSE(mapped.contains(43));
+
+    mapped.clear();
+    EXPECT_FALSE(mapped.contains(gearUp));
+    EXPECT_FALSE(mapped.contains(42));
+}
+
+//NOLINTEND(misc-include-cleaner)
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/ai/simobjects/msfs_scanner.hpp>
+
+using namespace SimConnect;
+using namespace SimConnect::AI;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
+
+namespace {
+
+// A temporary folder with two package roots, removed again at the end of the test.
+class PackageFolder {
+    std::filesystem::path root_;
+
+public:
+    explicit PackageFolder(std::string_view name)
+        : root_(std::filesystem::temp_directory_path() / name)
+    {
+        std::filesystem::remove_all(root_);
+        std::filesystem::create_directories(root_);
+    }
+    PackageFolder(const PackageFolder&) = delete;
+    PackageFolder(PackageFolder&&) = delete;
+    PackageFolder& operator=(const PackageFolder&) = delete;
+    PackageFolder& operator=(PackageFolder&&) = delete;
+    ~PackageFolder() {
+        std::error_code ec;
+        std::filesystem::remove_all(root_, ec);
+    }
+
+    [[nodiscard]] std::filesystem::path path(std::string_view relative) const { return root_ / relative; }
+
+    void write(std::string_view relative, std::string_view content) const {
+        const auto file = path(relative);
+        std::filesystem::create_directories(file.parent_path());
+        std::ofstream(file, std::ios::trunc) << content;
+    }
+};
+
+std::vector<std::string> titlesOf(MSFSScanner<>& scanner, SimObjectType type) {
+    std::vector<std::string> titles;
+    scanner.scan(type, [&titles](std::string_view title, std::string_view) { titles.emplace_back(title); });
+    return titles;
+}
+
+void fillPackages(const PackageFolder& folder) {
+    folder.write("Official/asobo-c172/SimObjects/Airplanes/C172/aircraft.cfg",
+        "[GENERAL]\ncategory = \"Airplane\"\n\n[FLTSIM.0]\ntitle = \"Cessna 172\" ; default\n[FLTSIM.1]\ntitle=\"Cessna 172 Floats\"\n[FLTSIM.X]\ntitle=\"Not a variation\"\n");
+    folder.write("Community/livery-pack/SimObjects/Airplanes/C172_KLM/aircraft.cfg",
+        "[VARIATION]\nbase_container = \"..\\C172\"\n\n[fltsim.0]\ntitle = \"Cessna 172 KLM\"\n");
+    folder.write("Community/heli/SimObjects/Rotorcraft/R22/sim.cfg",
+        "[General]\nCategory = Helicopter\n[FLTSIM.0]\ntitle = Robinson R22\n");
+    folder.write("Community/empty-package/layout.json", "{}");
+}
+
+} // namespace
+
+
+// Scenario: Scanning package roots in parallel
+// Given two package roots with aircraft.cfg and sim.cfg files, one of which refers to its base container
+// When they are scanned on several threads
+// Then all FLTSIM.N titles are found under the category of their own file or of their base container
+TEST(MSFSScannerTests, ScansPackageRoots) {
+    PackageFolder folder("TestMSFSScanner_Scan");
+    fillPackages(folder);
+
+    MSFSScanner<> scanner(MSFSScanConfig{ .roots = { folder.path("Official"), folder.path("Community") }, .threads = 3 });
+    EXPECT_EQ(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT),
+              (std::vector<std::string>{ "Cessna 172", "Cessna 172 Floats", "Cessna 172 KLM" }));
+    EXPECT_EQ(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_HELICOPTER), (std::vector<std::string>{ "Robinson R22" }));
+    EXPECT_EQ(scanner.stats().packages, 4U);
+    EXPECT_EQ(scanner.stats().files, 3U);
+    EXPECT_EQ(scanner.stats().parsed, 3U);
+}
+
+
+// Scenario: Rescanning with a cache
+// Given a scan that wrote its cache file
+// When a new scanner scans the same packages, one file is changed, and one package is removed
+// Then unchanged files come from the cache, only the changed file is parsed, and the titles follow the changes
+TEST(MSFSScannerTests, RescansOnlyChangedFiles) {
+    PackageFolder folder("TestMSFSScanner_Cache");
+    fillPackages(folder);
+    const MSFSScanConfig config{ .roots = { folder.path("Official"), folder.path("Community") }, .cacheFile = folder.path("scanner.cache") };
+
+    {
+        MSFSScanner<> first(config);
+        first.rescan();
+        EXPECT_EQ(first.stats().parsed, 3U);
+    }
+    ASSERT_TRUE(std::filesystem::exists(folder.path("scanner.cache")));
+
+    MSFSScanner<> scanner(config);
+    EXPECT_EQ(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT),
+              (std::vector<std::string>{ "Cessna 172", "Cessna 172 Floats", "Cessna 172 KLM" }));
+    EXPECT_EQ(scanner.stats().parsed, 0U);
+    EXPECT_EQ(scanner.stats().cached, 3U);
+
+    folder.write("Community/livery-pack/SimObjects/Airplanes/C172_KLM/aircraft.cfg",
+        "[VARIATION]\nbase_container = \"..\\C172\"\n\n[fltsim.0]\ntitle = \"Cessna 172 KLM\"\n[fltsim.1]\ntitle = \"Cessna 172 Transavia\"\n");
+    std::filesystem::remove_all(folder.path("Community/heli"));
+    scanner.rescan();
+    EXPECT_EQ(scanner.stats().files, 2U);
+    EXPECT_EQ(scanner.stats().parsed, 1U);
+    EXPECT_EQ(scanner.stats().cached, 1U);
+    EXPECT_EQ(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT),
+              (std::vector<std::string>{ "Cessna 172", "Cessna 172 Floats", "Cessna 172 KLM", "Cessna 172 Transavia" }));
+    EXPECT_TRUE(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_HELICOPTER).empty());
+}
+
+
+// Scenario: A corrupt cache
+// Given a cache file with the right header, but numbers that are not numbers or do not fit
+// When a scanner loads it
+// Then the cache is ignored, and all files are parsed again
+TEST(MSFSScannerTests, IgnoresCorruptCache) {
+    PackageFolder folder("TestMSFSScanner_Corrupt");
+    fillPackages(folder);
+    const MSFSScanConfig config{ .roots = { folder.path("Official"), folder.path("Community") }, .cacheFile = folder.path("scanner.cache") };
+
+    for (const std::string_view entry : { "F 12x 34 ghost.cfg\nT Ghost\n", "F 12 99999999999999999999999 ghost.cfg\nT Ghost\n",
+                                          "F 12 34 ghost.cfg\nU -1\nT Ghost\n" }) {
+        folder.write("scanner.cache", std::string("MSFSScannerCache 1\n").append(entry));
+
+        MSFSScanner<> scanner(config);
+        EXPECT_NO_THROW(scanner.rescan());
+        EXPECT_EQ(scanner.stats().parsed, 3U);
+        EXPECT_EQ(titlesOf(scanner, SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_AIRCRAFT),
+                  (std::vector<std::string>{ "Cessna 172", "Cessna 172 Floats", "Cessna 172 KLM" }));
+    }
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
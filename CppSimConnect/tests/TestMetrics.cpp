@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/connection_metrics.hpp>
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/windows_event_connection.hpp>
+#include <simconnect/util/metrics.hpp>
+#include <simconnect/util/prometheus_writer.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Scenario: Metrics are found again by name and labels
+// Given A registry with a counter
+// When The same counter is requested again, with other labels, and as a gauge
+// Then The first request returns the same counter, the second a new one, and the third throws
+TEST(TestMetrics, RegistryFindsOrCreates) {
+    MetricsRegistry registry;
+
+    auto& first = registry.counter("requests_total", "Requests.", "kind=\"a\"");
+    first.inc(3);
+    EXPECT_EQ(&registry.counter("requests_total", "Requests.", "kind=\"a\""), &first);
+    EXPECT_EQ(registry.counter("requests_total", "Requests.", "kind=\"b\"").value(), 0);
+    EXPECT_THROW((void)registry.gauge("requests_total", "Requests."), SimConnectException);
+}
+
+
+// Scenario: The Prometheus writer renders counters, gauges, and cumulative histogram buckets
+// Given A registry with a labelled counter, a gauge, and a histogram with three observations
+// When It is rendered
+// Then The text has HELP and TYPE lines, the values, and cumulative buckets ending in +Inf
+TEST(TestMetrics, PrometheusText) {
+    MetricsRegistry registry;
+    registry.counter("calls_total", "Calls.", "op=\"x\"").inc(2);
+    registry.gauge("depth", "Depth.").set(-1);
+    auto& histogram = registry.histogram("latency_seconds", "Latency.", { 0.1, 1.0 });
+    histogram.observe(0.05);
+    histogram.observe(0.5);
+    histogram.observe(5.0);
+
+    const auto text = PrometheusWriter::render(registry);
+
+    EXPECT_NE(text.find("# HELP calls_total Calls.\n# TYPE calls_total counter\ncalls_total{op=\"x\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE depth gauge\ndepth -1\n"), std::string::npos);
+    EXPECT_NE(text.find("latency_seconds_bucket{le=\"0.1\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("latency_seconds_bucket{le=\"1\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("latency_seconds_bucket{le=\"+Inf\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("latency_seconds_sum 5.55\n"), std::string::npos);
+    EXPECT_NE(text.find("latency_seconds_count 3\n"), std::string::npos);
+}
+
+
+// Scenario: Connection metrics count messages per type, bytes, and exceptions
+// Given A fresh set of connection metrics
+// When Two open messages and an exception are recorded as dispatched
+// Then The per message counters, byte count, exception count, and dispatch histogram are rendered
+TEST(TestMetrics, ConnectionMetricsCountMessages) {
+    ConnectionMetrics metrics;
+
+    metrics.messageDispatched(Messages::open, 100, 20us);
+    metrics.messageDispatched(Messages::open, 100, 20us);
+    metrics.messageDispatched(Messages::exception, 28, 1ms);
+    metrics.callSent();
+    metrics.callFailed();
+
+    std::ostringstream out;
+    PrometheusWriter::write(metrics.registry(), out);
+    const auto text = out.str();
+
+    EXPECT_NE(text.find(std::format("simconnect_messages_received_total{{id=\"{}\"}} 2\n", static_cast<unsigned long>(Messages::open))), std::string::npos);
+    EXPECT_NE(text.find("simconnect_received_bytes_total 228\n"), std::string::npos);
+    EXPECT_NE(text.find("simconnect_exceptions_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("simconnect_calls_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("simconnect_call_failures_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("simconnect_dispatch_seconds_count 3\n"), std::string::npos);
+}
+
+
+// Scenario: Label values and help text are escaped in the exposition
+// Given A handler name with a backslash, double quotes, and a newline, and help text with a newline
+// When A gauge is registered with it and the registry is rendered
+// Then The label value and help text are escaped so the line stays valid
+TEST(TestMetrics, PrometheusEscapesLabels) {
+    ConnectionMetrics metrics;
+    metrics.correlationHandlers("C:\\Data \"A\"\nB").set(1);
+    metrics.registry().counter("odd_total", "First line\nsecond \\ line.").inc();
+
+    const auto text = PrometheusWriter::render(metrics.registry());
+
+    EXPECT_EQ(metricLabel("handler", "a\"b"), "handler=\"a\\\"b\"");
+    EXPECT_NE(text.find("simconnect_correlation_handlers{handler=\"C:\\\\Data \\\"A\\\"\\nB\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("# HELP odd_total First line\\nsecond \\\\ line.\n"), std::string::npos);
+}
+
+
+// Scenario: The connection state can be read through a derived connection type
+// Given A metrics enabled WindowsEventConnection that was never opened
+// When Its state is read
+// Then The public state() getter is reachable and reports success
+TEST(TestMetrics, ConnectionStateIsPublic) {
+    WindowsEventConnection<false, NullLogger, true, true> connection;
+
+    EXPECT_EQ(connection.state(), 0);
+    EXPECT_TRUE(connection.succeeded());
+    EXPECT_EQ(connection.metrics().registry().counter("simconnect_call_failures_total", "").value(), 0);
+}
+
+
+// Scenario: Metrics can be written to a file for a textfile collector
+// Given A registry with a gauge
+// When It is written to a file
+// Then The file holds the rendered text and no temporary file is left behind
+TEST(TestMetrics, WriteFile) {
+    MetricsRegistry registry;
+    registry.gauge("outstanding", "Outstanding requests.").set(7);
+    const auto path = std::filesystem::temp_directory_path() / "cppsimconnect_test_metrics.prom";
+
+    ASSERT_TRUE(PrometheusWriter::writeFile(registry, path));
+
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    in.close();
+    EXPECT_EQ(content.str(), PrometheusWriter::render(registry));
+
+    auto temp = path;
+    temp += ".tmp";
+    EXPECT_FALSE(std::filesystem::exists(temp));
+    std::filesystem::remove(path);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
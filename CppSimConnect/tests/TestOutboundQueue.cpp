@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/outbound_queue.hpp>
+
+using namespace SimConnect;
+using namespace std::chrono_literals;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Scenario: An SPSC queue hands elements from one thread to another in order
+// Given An SPSC outbound queue smaller than the number of elements
+// When A producer thread pushes with the block policy while the main thread pops
+// Then All elements arrive, in order, and the producer had to wait at least once
+TEST(TestOutboundQueue, SpscDeliversInOrder) {
+    SpscOutboundQueue<int> queue({ .capacity = 8, .overflow = OverflowPolicy::block });
+    constexpr int count{ 10000 };
+
+    std::jthread producer([&queue] {
+        for (int i = 0; i < count; ++i) {
+            queue.push(i);
+        }
+    });
+
+    std::vector<int> received;
+    while (received.size() < count) {
+        auto value = queue.pop(1s);
+        ASSERT_TRUE(value.has_value());
+        received.push_back(*value);
+    }
+    producer.join();
+
+    for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(received[i], i);
+    }
+    const auto stats = queue.stats();
+    EXPECT_EQ(stats.pushed, count);
+    EXPECT_EQ(stats.popped, count);
+    EXPECT_EQ(stats.dropped, 0);
+    EXPECT_LE(stats.maxDepth, queue.capacity());
+}
+
+
+// Scenario: A full queue drops new or old elements depending on its policy
+// Given Two queues of capacity 4, one dropping the newest and one (MPMC) dropping the oldest element
+// When Six elements are pushed into each without popping
+// Then The first keeps 0..3, the second keeps 2..5, and both report two drops
+TEST(TestOutboundQueue, OverflowPolicies) {
+    SpscOutboundQueue<int> newest({ .capacity = 4, .overflow = OverflowPolicy::dropNewest });
+    MpmcOutboundQueue<int> oldest({ .capacity = 4, .overflow = OverflowPolicy::dropOldest });
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(newest.push(i), i < 4);
+        EXPECT_TRUE(oldest.push(i));
+    }
+    EXPECT_DOUBLE_EQ(newest.stats().occupancy(), 1.0);
+
+    std::vector<int> keptNewest;
+    std::vector<int> keptOldest;
+    newest.drain([&keptNewest](int value) { keptNewest.push_back(value); });
+    oldest.drain([&keptOldest](int value) { keptOldest.push_back(value); });
+
+    EXPECT_EQ(keptNewest, (std::vector<int>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(keptOldest, (std::vector<int>{ 2, 3, 4, 5 }));
+    EXPECT_EQ(newest.stats().dropped, 2);
+    EXPECT_EQ(oldest.stats().dropped, 2);
+}
+
+
+// Scenario: Dropping the oldest element needs a queue that allows several consumers
+// Given The dropOldest policy
+// When An SPSC queue is created with it
+// Then The constructor throws
+TEST(TestOutboundQueue, SpscRejectsDropOldest) {
+    EXPECT_THROW(SpscOutboundQueue<int>({ .capacity = 4, .overflow = OverflowPolicy::dropOldest }), SimConnectException);
+}
+
+
+// Scenario: Several consumers share an MPMC queue, and closing it releases them
+// Given An MPMC queue with four consumer threads waiting on it
+// When One thread pushes 1000 elements and then closes the queue
+// Then Every element is received exactly once and all consumers return
+TEST(TestOutboundQueue, MpmcConsumersAndClose) {
+    MpmcOutboundQueue<int> queue({ .capacity = 64, .overflow = OverflowPolicy::block });
+    constexpr int count{ 1000 };
+    std::atomic<long> sum{ 0 };
+    std::atomic<int> received{ 0 };
+
+    std::vector<std::jthread> consumers;
+    for (int i = 0; i < 4; ++i) {
+        consumers.emplace_back([&] {
+            while (auto value = queue.pop(5s)) {
+                sum += *value;
+                ++received;
+            }
+        });
+    }
+    for (int i = 1; i <= count; ++i) {
+        queue.push(i);
+    }
+    while (queue.depth() > 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+    queue.close();
+    consumers.clear();
+
+    EXPECT_EQ(received.load(), count);
+    EXPECT_EQ(sum.load(), static_cast<long>(count) * (count + 1) / 2);
+    EXPECT_FALSE(queue.push(0));
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/data/data_definitions.hpp>
+#include <simconnect/quota_governor.hpp>
+#include <simconnect/requests/request.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Scenario: Requests beyond the admission limit wait, and start by priority as running requests end
+// Given A governor admitting two requests
+// When Five requests are submitted with different priorities, and the running ones are stopped one by one, each
+//      followed by a pump
+// Then Two start immediately, and the others start highest priority first, in submission order within a priority
+TEST(TestQuotaGovernor, QueuesByPriority) {
+    QuotaGovernor governor({ .requests = 2, .admissionThreshold = 1.0 });
+    std::vector<RequestId> startedIds;
+    std::vector<Request> running;
+
+    auto submit = [&](RequestId id, int priority) {
+        return governor.submit([id, &startedIds] { startedIds.push_back(id); return Request{ id }; },
+                               [&running](Request request) { running.push_back(std::move(request)); },
+                               priority);
+    };
+
+    EXPECT_EQ(submit(1, 0), Admission::started);
+    EXPECT_EQ(submit(2, 0), Admission::started);
+    EXPECT_EQ(submit(3, 0), Admission::queued);
+    EXPECT_EQ(submit(4, 5), Admission::queued);
+    EXPECT_EQ(submit(5, 0), Admission::queued);
+    EXPECT_EQ(governor.inUse(Quota::requests), 2);
+
+    while (!running.empty()) {
+        running.front().stop();
+        running.erase(running.begin());
+        governor.pump();
+    }
+
+    EXPECT_EQ(startedIds, (std::vector<RequestId>{ 1, 2, 4, 3, 5 }));
+    EXPECT_EQ(governor.inUse(Quota::requests), 0);
+    const auto stats = governor.stats();
+    EXPECT_EQ(stats.started, 5);
+    EXPECT_EQ(stats.deferred, 3);
+    EXPECT_EQ(stats.peak[static_cast<std::size_t>(Quota::requests)], 2);
+}
+
+
+// Scenario: Requests are rejected once the queue is full
+// Given A governor admitting one request with room for one queued request
+// When Three requests are submitted
+// Then The third is rejected
+TEST(TestQuotaGovernor, RejectsWhenQueueFull) {
+    QuotaGovernor governor({ .requests = 1, .admissionThreshold = 1.0, .maxQueued = 1 });
+    std::vector<Request> running;
+    auto keep = [&running](Request request) { running.push_back(std::move(request)); };
+
+    EXPECT_EQ(governor.submit([] { return Request{ 1 }; }, keep), Admission::started);
+    EXPECT_EQ(governor.submit([] { return Request{ 2 }; }, keep), Admission::queued);
+    EXPECT_EQ(governor.submit([] { return Request{ 3 }; }, keep), Admission::rejected);
+    EXPECT_EQ(governor.stats().rejected, 1);
+}
+
+
+// Scenario: A request that fails to start gives its slot back
+// Given A governor admitting one request, with one running and two queued, the first of which throws when started
+// When A request that throws is submitted directly, and the running request is stopped and the queue pumped
+// Then The exceptions are passed on, no slot stays taken, and the next pump starts the remaining queued request
+TEST(TestQuotaGovernor, FailedStartReleasesSlot) {
+    QuotaGovernor governor({ .requests = 1, .admissionThreshold = 1.0 });
+    std::vector<Request> running;
+    auto keep = [&running](Request request) { running.push_back(std::move(request)); };
+    auto failing = []() -> Request { throw std::runtime_error("start failed"); };
+
+    EXPECT_THROW((void)governor.submit(failing, keep), std::runtime_error);
+    EXPECT_EQ(governor.inUse(Quota::requests), 0);
+
+    EXPECT_EQ(governor.submit([] { return Request{ 1 }; }, keep), Admission::started);
+    EXPECT_EQ(governor.submit(failing, keep), Admission::queued);
+    EXPECT_EQ(governor.submit([] { return Request{ 3 }; }, keep), Admission::queued);
+
+    running.clear();
+    EXPECT_EQ(governor.inUse(Quota::requests), 0);
+    EXPECT_THROW((void)governor.pump(), std::runtime_error);
+    EXPECT_EQ(governor.inUse(Quota::requests), 0);
+
+    EXPECT_EQ(governor.pump(), 1);
+    ASSERT_EQ(running.size(), 1);
+    EXPECT_EQ(running.front().id(), 3);
+    EXPECT_EQ(governor.inUse(Quota::requests), 1);
+}
+
+
+// Scenario: Stopping a request does not start queued ones
+// Given A governor admitting one request, with one running and one queued whose callback keeps it in the same vector
+// When The vector is cleared, and later the queue is pumped
+// Then Clearing only gives the slot back, and the queued request starts from the pump
+TEST(TestQuotaGovernor, ReleaseDoesNotStart) {
+    QuotaGovernor governor({ .requests = 1, .admissionThreshold = 1.0 });
+    std::vector<Request> running;
+    auto keep = [&running](Request request) { running.push_back(std::move(request)); };
+
+    EXPECT_EQ(governor.submit([] { return Request{ 1 }; }, keep), Admission::started);
+    EXPECT_EQ(governor.submit([] { return Request{ 2 }; }, keep), Admission::queued);
+
+    running.clear();
+    EXPECT_TRUE(running.empty());
+    EXPECT_EQ(governor.inUse(Quota::requests), 0);
+    EXPECT_EQ(governor.stats().queued, 1);
+
+    EXPECT_EQ(governor.pump(), 1);
+    ASSERT_EQ(running.size(), 1);
+    EXPECT_EQ(running.front().id(), 2);
+}
+
+
+// Scenario: Each quota has its own queue
+// Given A governor admitting one group and two requests, with a group running and another queued
+// When Requests are submitted, and one of them is stopped and the queue pumped
+// Then The requests start while the group waits, and the queued request starts although the group is still full
+TEST(TestQuotaGovernor, QuotasQueueSeparately) {
+    QuotaGovernor governor({ .requests = 2, .groups = 1, .admissionThreshold = 1.0 });
+    std::vector<Request> running;
+    auto keep = [&running](Request request) { running.push_back(std::move(request)); };
+
+    EXPECT_EQ(governor.submit([] { return Request{ 1 }; }, keep, 0, Quota::groups), Admission::started);
+    EXPECT_EQ(governor.submit([] { return Request{ 2 }; }, keep, 9, Quota::groups), Admission::queued);
+    EXPECT_EQ(governor.submit([] { return Request{ 3 }; }, keep), Admission::started);
+    EXPECT_EQ(governor.submit([] { return Request{ 4 }; }, keep), Admission::started);
+    EXPECT_EQ(governor.submit([] { return Request{ 5 }; }, keep), Admission::queued);
+
+    running[1].stop();
+    EXPECT_EQ(governor.pump(), 1);
+    ASSERT_EQ(running.size(), 4);
+    EXPECT_EQ(running.back().id(), 5);
+    EXPECT_EQ(governor.inUse(Quota::requests), 2);
+    EXPECT_EQ(governor.inUse(Quota::groups), 1);
+    EXPECT_EQ(governor.stats().queued, 1);
+}
+
+
+// Scenario: Data definition IDs are handed out up to the limit, and come back when released
+// Given A governor allowing two data definitions
+// When Three are allocated, and then the first is released
+// Then The third allocation fails, and a new one succeeds after the release
+TEST(TestQuotaGovernor, DefinitionLeases) {
+    QuotaGovernor governor({ .dataDefinitions = 2 });
+    DataDefinitions definitions;
+
+    auto first = governor.allocate(definitions);
+    auto second = governor.allocate(definitions);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_NE(first->id(), second->id());
+    EXPECT_FALSE(governor.allocate(definitions).has_value());
+    EXPECT_EQ(governor.available(Quota::dataDefinitions), 0);
+
+    first.reset();
+    EXPECT_EQ(governor.inUse(Quota::dataDefinitions), 1);
+    EXPECT_TRUE(governor.allocate(definitions).has_value());
+    EXPECT_EQ(governor.stats().refused, 1);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <simconnect/connection.hpp>
+#include <simconnect/simple_handler.hpp>
+#include <simconnect/simconnect_message_handler.hpp>
+
+#include <simconnect/util/null_logger.hpp>
+
+using namespace SimConnect;
+
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
+
+// Stand-in for the auto-reset event SimConnect signals: setting it twice before a wait still wakes the loop only once.
+class ReadinessEvent {
+    bool signalled_{ false };
+
+public:
+    void set() noexcept { signalled_ = true; }
+
+    [[nodiscard]]
+    bool consume() noexcept {
+        const bool was = signalled_;
+        signalled_ = false;
+        return was;
+    }
+};
+
+
+// Mock connection that queues messages and signals its readiness event for each one.
+class ReactorConnection {
+public:
+    using mutex_type = NoMutex;
+    using guard_type = NoGuard;
+    using logger_type = NullLogger;
+
+private:
+    std::deque<SIMCONNECT_RECV> queue_;
+    SIMCONNECT_RECV current_{};
+    ReadinessEvent ready_;
+    bool isOpen_{ true };
+    std::size_t resignals_{ 0 };
+    NullLogger logger_;
+
+public:
+    void post(SIMCONNECT_RECV_ID msgType) {
+        SIMCONNECT_RECV msg{};
+        msg.dwID = static_cast<DWORD>(msgType);
+        msg.dwSize = sizeof(SIMCONNECT_RECV);
+        msg.dwVersion = 1;
+        queue_.push_back(msg);
+        ready_.set();
+    }
+
+    bool getNextDispatch(SIMCONNECT_RECV*& msg, DWORD& size) {
+        if (queue_.empty()) {
+            return false;
+        }
+        current_ = queue_.front();
+        queue_.pop_front();
+        msg = &current_;
+        size = sizeof(SIMCONNECT_RECV);
+        return true;
+    }
+
+    bool callDispatch(const std::function<void(const SIMCONNECT_RECV*, DWORD)>& dispatchFunc) {
+        SIMCONNECT_RECV* msg = nullptr;
+        DWORD size = 0;
+        if (isOpen() && getNextDispatch(msg, size)) {
+            dispatchFunc(msg, size);
+            return true;
+        }
+        return false;
+    }
+
+    ReadinessEvent& readinessHandle() noexcept { return ready_; }
+    void signalReady() noexcept { ++resignals_; ready_.set(); }
+
+    [[nodiscard]]
+    std::size_t resignals() const noexcept { return resignals_; }
+    [[nodiscard]]
+    std::size_t pending() const noexcept { return queue_.size(); }
+
+    [[nodiscard]]
+    bool isOpen() const { return isOpen_; }
+    void close() { isOpen_ = false; }
+
+    NullLogger& logger() noexcept { return logger_; }
+};
+
+
+// Scenario: Draining a bounded number of messages
+// Given a handler on a connection with five waiting messages
+// When I drain with a maximum of two messages at a time
+// Then each call dispatches at most two messages, without blocking when the queue is empty
+TEST(ReactorDrainTests, DrainIsBounded) {
+    ReactorConnection connection;
+    SimpleHandler<ReactorConnection> handler(connection);
+
+    std::vector<DWORD> received;
+    [[maybe_unused]] auto handlerId = handler.registerDefaultHandler([&received](const SIMCONNECT_RECV& msg) {
+        received.push_back(msg.dwID);
+    });
+
+    for (int i = 0; i < 5; ++i) {
+        connection.post(SIMCONNECT_RECV_ID_EVENT);
+    }
+
+    EXPECT_EQ(handler.drain(2), 2);
+    EXPECT_EQ(connection.pending(), 3);
+    EXPECT_EQ(handler.drain(2), 2);
+    EXPECT_EQ(handler.drain(2), 1);
+    EXPECT_EQ(handler.drain(2), 0);
+    EXPECT_EQ(received.size(), 5);
+    EXPECT_EQ(handler.drain(0), 0);
+}
+
+
+// Scenario: Running dispatch from an event loop
+// Given five messages that arrived before the loop woke up, so the readiness event was signalled once
+// When the loop drains two messages per wakeup
+// Then the handler re-signals readiness after each full drain, and all messages are dispatched in three wakeups
+TEST(ReactorDrainTests, EventLoopWakesUntilEmpty) {
+    ReactorConnection connection;
+    SimpleHandler<ReactorConnection> handler(connection);
+
+    std::size_t received{ 0 };
+    [[maybe_unused]] auto handlerId = handler.registerDefaultHandler([&received](const SIMCONNECT_RECV&) { ++received; });
+
+    for (int i = 0; i < 5; ++i) {
+        connection.post(SIMCONNECT_RECV_ID_EVENT);
+    }
+
+    std::size_t wakeups{ 0 };
+    while (connection.readinessHandle().consume()) {
+        ++wakeups;
+        [[maybe_unused]] auto count = handler.drain(2);
+    }
+
+    EXPECT_EQ(received, 5);
+    EXPECT_EQ(wakeups, 3);
+    EXPECT_EQ(connection.resignals(), 2);
+}
+
+
+// Scenario: Draining stops when the connection closes
+// Given an auto-closing handler and a QUIT message followed by other messages
+// When I drain
+// Then dispatching stops after the QUIT message and readiness is not re-signalled
+TEST(ReactorDrainTests, DrainStopsOnClose) {
+    ReactorConnection connection;
+    SimpleHandler<ReactorConnection> handler(connection);
+    handler.autoClosing(true);
+
+    connection.post(SIMCONNECT_RECV_ID_OPEN);
+    connection.post(SIMCONNECT_RECV_ID_QUIT);
+    connection.post(SIMCONNECT_RECV_ID_EVENT);
+
+    EXPECT_EQ(handler.drain(10), 2);
+    EXPECT_FALSE(connection.isOpen());
+    EXPECT_EQ(connection.pending(), 1);
+    EXPECT_EQ(handler.drain(10), 0);
+    EXPECT_EQ(connection.resignals(), 0);
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,misc-include-cleaner)
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/registration_batch.hpp>
+#include <simconnect/registration_journal.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Mock connection: remembers how many registrations each submit() was offered, and which actions ran.
+class JournalMockConnection {
+public:
+    std::vector<std::size_t> submitted;
+    std::vector<std::string> calls;
+
+    void submit(RegistrationBatch& batch) {
+        submitted.push_back(batch.pending());
+    }
+
+    void call(std::string name) {
+        calls.push_back(std::move(name));
+    }
+};
+
+
+// Scenario: apply() only sends actions added since the previous apply()
+// Given A journal with two actions that has been applied
+// When A third action is added and the journal is applied again
+// Then Only the third action runs the second time
+TEST(TestRegistrationJournal, ApplySendsOnlyNewActions) {
+    JournalMockConnection connection;
+    RegistrationJournal<JournalMockConnection> journal;
+
+    journal.add("first", [](JournalMockConnection& conn) { conn.call("first"); });
+    journal.add("second", [](JournalMockConnection& conn) { conn.call("second"); });
+    journal.apply(connection);
+    EXPECT_EQ(connection.calls, (std::vector<std::string>{ "first", "second" }));
+
+    journal.add("third", [](JournalMockConnection& conn) { conn.call("third"); });
+    journal.apply(connection);
+    EXPECT_EQ(connection.calls, (std::vector<std::string>{ "first", "second", "third" }));
+    EXPECT_EQ(journal.stats().replays, 0);
+}
+
+
+// Scenario: replay() sends the whole journal again, registrations first
+// Given A journal with three registrations and an action, applied on a first connection
+// When The journal is replayed on a second connection
+// Then All three registrations are offered in one batch and the action runs again
+TEST(TestRegistrationJournal, ReplaySendsEverything) {
+    JournalMockConnection first;
+    JournalMockConnection second;
+    RegistrationJournal<JournalMockConnection> journal;
+
+    journal.addDataDefinition(1, "PLANE ALTITUDE", "feet", DataTypes::float64)
+           .addDataDefinition(1, "PLANE LATITUDE", "degrees", DataTypes::float64)
+           .addToFacilityDefinition(2, "OPEN AIRPORT");
+    journal.add("request data", [](JournalMockConnection& conn) { conn.call("request data"); });
+    journal.apply(first);
+
+    EXPECT_EQ(journal.replay(second), 0);
+    EXPECT_EQ(second.submitted, (std::vector<std::size_t>{ 3 }));
+    EXPECT_EQ(second.calls, (std::vector<std::string>{ "request data" }));
+
+    const auto stats = journal.stats();
+    EXPECT_EQ(stats.registrations, 3);
+    EXPECT_EQ(stats.actions, 1);
+    EXPECT_EQ(stats.replays, 1);
+    EXPECT_EQ(journal.size(), 4);
+}
+
+
+// Scenario: Removed actions are not replayed
+// Given A journal with two applied actions
+// When The first action is removed and the journal is replayed
+// Then Only the second action runs, and removing an unknown ID fails
+TEST(TestRegistrationJournal, RemovedActionsAreNotReplayed) {
+    JournalMockConnection connection;
+    RegistrationJournal<JournalMockConnection> journal;
+
+    const auto first = journal.add("first", [](JournalMockConnection& conn) { conn.call("first"); });
+    journal.add("second", [](JournalMockConnection& conn) { conn.call("second"); });
+    journal.apply(connection);
+
+    EXPECT_TRUE(journal.remove(first));
+    EXPECT_FALSE(journal.remove(first));
+    EXPECT_EQ(journal.actionDescriptions(), (std::vector<std::string>{ "second" }));
+
+    connection.calls.clear();
+    journal.replay(connection);
+    EXPECT_EQ(connection.calls, (std::vector<std::string>{ "second" }));
+}
+
+// Scenario: An action that uses the journal itself
+// Given A journal with an action that records a follow-up action when it runs
+// When The journal is applied twice
+// Then The first apply runs the action without deadlocking, and the second apply runs the follow-up
+TEST(TestRegistrationJournal, ActionsMayReenterTheJournal) {
+    JournalMockConnection connection;
+    RegistrationJournal<JournalMockConnection> journal;
+
+    journal.add("subscribe", [&journal](JournalMockConnection& conn) {
+        conn.call("subscribe");
+        journal.add("follow-up", [](JournalMockConnection& c) { c.call("follow-up"); });
+    });
+    journal.apply(connection);
+    EXPECT_EQ(connection.calls, (std::vector<std::string>{ "subscribe" }));
+    EXPECT_EQ(journal.stats().actions, 2);
+
+    journal.apply(connection);
+    EXPECT_EQ(connection.calls, (std::vector<std::string>{ "subscribe", "follow-up" }));
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/connection.hpp>
+#include <simconnect/send_history.hpp>
+
+using namespace SimConnect;
+
+//NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Scenario: A recorded call can be found by its SendId
+// Given A send history
+// When A data definition call is recorded
+// Then Looking up its SendId returns the operation and arguments, and an exception message resolves to it too
+TEST(TestSendHistory, RecordAndFind) {
+    SendHistory history;
+
+    history.record(42, "SimConnect_AddToDataDefinition", 7, "PLANE ALTITUDE");
+
+    auto rec = history.find(42);
+    ASSERT_TRUE(rec.has_value());
+    EXPECT_EQ(std::string(rec->operation), "SimConnect_AddToDataDefinition");
+    EXPECT_EQ(rec->id, 7);
+    EXPECT_EQ(rec->requestId, unused);
+    EXPECT_EQ(rec->nameView(), "PLANE ALTITUDE");
+    EXPECT_EQ(rec->describe(), "SimConnect_AddToDataDefinition (sendId=42, id=7, 'PLANE ALTITUDE')");
+
+    Messages::ExceptionMsg msg{};
+    msg.dwSendID = 42;
+    EXPECT_TRUE(history.find(msg).has_value());
+    EXPECT_FALSE(history.find(43).has_value());
+    EXPECT_FALSE(history.find(noId).has_value());
+}
+
+
+// Scenario: Old calls are forgotten once their slot is reused
+// Given A send history with room for four calls
+// When Five calls are recorded
+// Then The first one can no longer be found, the last four can
+TEST(TestSendHistory, OverwritesOldest) {
+    SendHistory history(4);
+    ASSERT_EQ(history.capacity(), 4);
+
+    for (SendId id = 1; id <= 5; ++id) {
+        history.record(id, "SimConnect_RequestDataOnSimObject", 1, {}, id * 10);
+    }
+
+    EXPECT_FALSE(history.find(1).has_value());
+    for (SendId id = 2; id <= 5; ++id) {
+        auto rec = history.find(id);
+        ASSERT_TRUE(rec.has_value());
+        EXPECT_EQ(rec->requestId, id * 10);
+    }
+}
+
+
+// Scenario: Long names are truncated, and resizing forgets everything
+// Given A send history
+// When A call with a very long name is recorded, and then the history is resized
+// Then The name is truncated to the maximum length, and afterwards the call is gone
+TEST(TestSendHistory, TruncatesAndResizes) {
+    SendHistory history(8);
+    const std::string longName(200, 'x');
+
+    history.record(3, "SimConnect_AddToFacilityDefinition", 1, longName);
+    auto rec = history.find(3);
+    ASSERT_TRUE(rec.has_value());
+    EXPECT_EQ(rec->nameView().size(), SendRecord::maxNameLength);
+
+    history.resize(100);
+    EXPECT_EQ(history.capacity(), 128);
+    EXPECT_FALSE(history.find(3).has_value());
+}
+
+//NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,44 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+
+/**
+ * A clock for tests that only moves when the test says so. Each tag type gets its own time, so tests using different
+ * tags do not disturb each other.
+ *
+ * @code
+ * using FetchClock = ManualClock<struct FetchClockTag>;
+ * FetchClock::advance(10ms);
+ * @endcode
+ *
+ * @tparam Tag A type that only serves to give the clock its own identity.
+ */
+template <class Tag>
+struct ManualClock {
+    using duration = std::chrono::microseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<ManualClock>;
+    static constexpr bool is_steady = true;
+
+    static inline time_point current{ duration{ 1 } };
+
+    static time_point now() noexcept { return current; }
+    static void advance(duration amount) noexcept { current += amount; }
+};
@@ -15,12 +15,17 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string>
-#include <map>
-#include <iostream>
-#include <fstream>
+#include <string_view>
+#include <vector>
+
+#include <simconnect/util/mapped_file.hpp>
 
 
 namespace SimConnect::AI {
@@ -47,102 +52,226 @@ inline static std::string trim(std::string s, bool stripQuotes = false) {
 
 
 /**
- * Light-weight INI file representation.
- * - Sections map to key/value dictionaries
- * - Keys are stored case-insensitive (normalized to lowercase)
+ * Light-weight, read-only INI file representation.
+ * - The file is memory-mapped, and sections, keys, and values are views into the mapping
+ * - Sections and keys are compared case-insensitively, and kept in a single sorted vector
+ * - If a key occurs more than once in a section, the last value counts
+ *
+ * Loading a file allocates nothing per line; the only allocations are the two vectors, reserved up front.
+ * Views returned by the IniFile are valid until it is loaded again or destroyed.
  */
 class IniFile {
 public:
-    using Section = std::map<std::string, std::string>; // key(lowercase) -> value
+    struct Entry {
+        std::string_view section;
+        std::string_view key;
+        std::string_view value;
+    };
 
 
 private:
-    std::map<std::string, Section> sections_;
+    MappedFile file_;
+    std::vector<std::string_view> sections_;    ///< Sorted, without duplicates.
+    std::vector<Entry> entries_;                ///< Sorted by section and key, without duplicates.
 
 
-public:
-    IniFile() = default;
+    [[nodiscard]]
+    static constexpr char lower(char c) noexcept {
+        return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c - 'A' + 'a') : c;
+    }
 
+    [[nodiscard]]
+    static constexpr int compare(std::string_view a, std::string_view b) noexcept {
+        const auto length = std::min(a.size(), b.size());
+        for (std::size_t i = 0; i < length; ++i) {
+            const auto ca = lower(a[i]);
+            const auto cb = lower(b[i]);
+            if (ca != cb) {
+                return (static_cast<unsigned char>(ca) < static_cast<unsigned char>(cb)) ? -1 : 1;
+            }
+        }
+        return (a.size() == b.size()) ? 0 : ((a.size() < b.size()) ? -1 : 1);
+    }
 
-    /**
-     * Returns the sections in the INI file.
-     * 
-     * @returns The sections in the INI file.
-     */
-    const std::map<std::string, Section>& sections() const noexcept {
-        return sections_;
+    [[nodiscard]]
+    static constexpr int compare(const Entry& entry, std::string_view section, std::string_view key) noexcept {
+        const auto result = compare(entry.section, section);
+        return (result != 0) ? result : compare(entry.key, key);
+    }
+
+    [[nodiscard]]
+    static std::string_view trimmed(std::string_view text, bool stripQuotes = false) noexcept {
+        auto skip = [stripQuotes](char c) {
+            return (std::isspace(static_cast<unsigned char>(c)) != 0) || (stripQuotes && ((c == '"') || (c == '\'')));
+        };
+        while (!text.empty() && skip(text.front())) {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && skip(text.back())) {
+            text.remove_suffix(1);
+        }
+        return text;
     }
 
 
     /**
-     * Loads an INI file from the specified path.
-     * 
-     * @param path The path to the INI file.
+     * Sorts the entries and section names, dropping all but the last of duplicate keys and duplicate section names.
      */
-    void load(const std::filesystem::path& path) {
-        std::ifstream in(path);
+    void index() {
+        std::ranges::stable_sort(entries_, [](const Entry& a, const Entry& b) { return compare(a, b.section, b.key) < 0; });
+        auto out = entries_.begin();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            const auto next = std::next(it);
+            if ((next == entries_.end()) || (compare(*it, next->section, next->key) != 0)) {
+                *out++ = *it;
+            }
+        }
+        entries_.erase(out, entries_.end());
 
-        std::string currentSection;
+        std::ranges::stable_sort(sections_, [](std::string_view a, std::string_view b) { return compare(a, b) < 0; });
+        sections_.erase(std::unique(sections_.begin(), sections_.end(), [](std::string_view a, std::string_view b) { return compare(a, b) == 0; }),
+                        sections_.end());
+    }
 
-        for (std::string line{}; std::getline(in, line); ) {
-            line = trim(line);
-            auto endPos = line.size();
 
-            // Remove comments starting with ; or //
-            const auto posSemi = line.find(';');
-            if (posSemi != std::string::npos) {
-                endPos = posSemi;
-            }
+    [[nodiscard]]
+    const Entry* find(std::string_view section, std::string_view key) const noexcept {
+        const auto it = std::lower_bound(entries_.begin(), entries_.end(), 0, [section, key](const Entry& entry, int) {
+            return compare(entry, section, key) < 0;
+        });
+        return ((it != entries_.end()) && (compare(*it, section, key) == 0)) ? &*it : nullptr;
+    }
 
-            const auto posDbl = line.find("//");
-            if (posDbl != std::string::npos && posDbl < endPos) {
-                endPos = posDbl;
-            }
-            line = trim(line.substr(0, endPos));
 
+    void parseText(std::string_view text) {
+        sections_.clear();
+        entries_.clear();
+        entries_.reserve(static_cast<std::size_t>(std::count(text.begin(), text.end(), '=')));
+
+        std::string_view currentSection;
+        bool inSection{ false };
+        while (!text.empty()) {
+            const auto eol = text.find('\n');
+            auto line = text.substr(0, eol);
+            text.remove_prefix((eol == std::string_view::npos) ? text.size() : eol + 1);
+
+            // Remove comments starting with ; or //
+            line = trimmed(line.substr(0, std::min(line.find(';'), line.find("//"))));
             if (line.empty()) {
                 continue;
             }
 
             // check for a section header
-            if (line.front() == '[' && line.back() == ']') {
-                currentSection = toLower(trim(line.substr(1, line.size() - 2), true));
-
-                if (!sections_.contains(currentSection)) {
-                    sections_.emplace(currentSection, Section{});
-                }
+            if ((line.front() == '[') && (line.back() == ']')) {
+                currentSection = trimmed(line.substr(1, line.size() - 2), true);
+                sections_.push_back(currentSection);
+                inSection = true;
                 continue;
             }
             // Must be a key-value line
-            auto eq = line.find('=');
-
-            if (eq == std::string::npos) {
+            const auto eq = line.find('=');
+            if (eq == std::string_view::npos) {
                 continue;
             }
+            if (!inSection) {
+                sections_.push_back(currentSection);
+                inSection = true;
+            }
+            entries_.push_back(Entry{ .section = currentSection, .key = trimmed(line.substr(0, eq)), .value = trimmed(line.substr(eq + 1), true) });
+        }
+        index();
+    }
 
-            std::string key = toLower(trim(line.substr(0, eq)));
-            std::string value = trim(line.substr(eq + 1), true);
 
-            sections_[currentSection][key] = value;
-        }
+public:
+    IniFile() = default;
+
+
+    /**
+     * Returns the section names, sorted case-insensitively. Keys before the first section header are in a section
+     * with an empty name.
+     * 
+     * @returns The section names.
+     */
+    [[nodiscard]]
+    std::span<const std::string_view> sections() const noexcept {
+        return sections_;
     }
 
-    
+
     /**
-     * Gets a value from the INI file.
+     * Returns all keys with their sections and values, sorted by section and key.
+     */
+    [[nodiscard]]
+    std::span<const Entry> entries() const noexcept {
+        return entries_;
+    }
+
+
+    /**
+     * Loads an INI file from the specified path. A file that cannot be opened, or is empty, gives an empty IniFile.
      * 
+     * @param path The path to the INI file.
+     * @returns true if the file was read.
+     */
+    bool load(const std::filesystem::path& path) {
+        sections_.clear();
+        entries_.clear();
+        if (!file_.open(path)) {
+            return false;
+        }
+        const auto bytes = file_.bytes();
+        parseText({ reinterpret_cast<const char*>(bytes.data()), bytes.size() });
+        return true;
+    }
+
+
+    /**
+     * Parses INI text that is already in memory. The text must outlive this IniFile, or the next load() or parse().
+     *
+     * @param text The INI text.
+     */
+    void parse(std::string_view text) {
+        file_.close();
+        parseText(text);
+    }
+
+
+    /**
+     * Returns true if the INI file has the section.
+     */
+    [[nodiscard]]
+    bool contains(std::string_view section) const noexcept {
+        return std::binary_search(sections_.begin(), sections_.end(), section, [](std::string_view a, std::string_view b) { return compare(a, b) < 0; });
+    }
+
+
+    /**
+     * Gets a value from the INI file without copying it.
+     *
      * @param section The section name.
      * @param key The key name.
      * @return The optional value, or std::nullopt if not found.
      */
-    std::optional<std::string> get(std::string section, std::string key) const
+    [[nodiscard]]
+    std::optional<std::string_view> view(std::string_view section, std::string_view key) const noexcept
     {
-        if (!sections_.contains(section)) { return std::nullopt; }
+        const auto* entry = find(section, key);
+        return (entry != nullptr) ? std::optional<std::string_view>{ entry->value } : std::nullopt;
+    }
 
-        const auto& sec = sections_.at(section);
-        auto it = sec.find(toLower(key));
 
-        return (it != sec.end()) ? std::optional<std::string>{it->second} : std::nullopt;
+    /**
+     * Gets a value from the INI file.
+     * 
+     * @param section The section name.
+     * @param key The key name.
+     * @return The optional value, or std::nullopt if not found.
+     */
+    std::optional<std::string> get(std::string_view section, std::string_view key) const
+    {
+        const auto* entry = find(section, key);
+        return (entry != nullptr) ? std::optional<std::string>{ entry->value } : std::nullopt;
     }
 
 };
@@ -17,14 +17,26 @@
 
 #include <cstdlib>
 
+#include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <filesystem>
+#include <format>
+#include <fstream>
 #include <functional>
-#include <string>
-#include <string_view>
 #include <map>
 #include <set>
-#include <regex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <simconnect/simconnect.hpp>
 #include <simconnect/ai/simobjects/ini_file.hpp>
@@ -36,17 +48,69 @@
 namespace SimConnect::AI {
 
 
+/**
+ * Configuration for an MSFSScanner.
+ */
+struct MSFSScanConfig {
+    std::vector<std::filesystem::path> roots{};     ///< Package roots to scan, or empty for Official/OneStore and Community in the InstalledPackagesPath.
+    unsigned threads{ 0 };                          ///< Threads scanning packages, or 0 for one per hardware thread.
+    std::filesystem::path cacheFile{};              ///< File to keep the parsed configuration files in between runs, or empty for none.
+};
+
+
+/**
+ * Counters for the last scan of an MSFSScanner.
+ */
+struct MSFSScanStats {
+    std::size_t packages{ 0 };
+    std::size_t files{ 0 };             ///< SimObject configuration files found.
+    std::size_t parsed{ 0 };            ///< Files parsed, because they were new or had changed.
+    std::size_t cached{ 0 };            ///< Files taken from the cache.
+};
+
+
+/**
+ * What the scanner needs from one aircraft.cfg or sim.cfg, which is also what its cache keeps.
+ */
+struct SimObjectCfgInfo {
+    std::string path{};
+    std::int64_t modified{ 0 };         ///< The last write time, in the file clock's ticks.
+    std::uintmax_t size{ 0 };
+    std::string baseName{};             ///< The name of the SimObject's directory.
+    std::string category{};             ///< GENERAL.category, if present.
+    std::string baseContainer{};        ///< VARIATION.base_container, if there is no category.
+    std::vector<std::string> titles{};  ///< The titles of the FLTSIM.N sections.
+    std::size_t untitled{ 0 };          ///< FLTSIM.N sections without a title.
+};
+
+
+/**
+ * Finds the SimObjects installed in MSFS by reading their configuration files, for when SimConnect cannot enumerate
+ * them.
+ *
+ * The packages are divided over a number of threads, each walking its packages' SimObjects folders and parsing the
+ * aircraft.cfg or sim.cfg files it finds. The results are then merged on the calling thread, in package order, so the
+ * outcome does not depend on the threads. A file whose path, size, and last write time are unchanged since the
+ * previous scan is not parsed again, and with a cache file configured this also holds across runs.
+ *
+ * @tparam L The logger type.
+ */
 template <class L = SimConnect::NullLogger>
 class MSFSScanner {
 public:
     using logger_type = L;
 
 private:
+    static constexpr std::string_view cacheMagic{ "MSFSScannerCache 1" };
+
     logger_type logger_;
+    MSFSScanConfig config_;
     std::atomic<bool> scanDone_{ false };
+    bool cacheLoaded_{ false };
     std::map<std::string, std::string> baseCategories_;
-    std::map<std::string, std::string> unresolvedChildren_;
     std::map<SimObjectType, std::set<std::string>> titles_;
+    std::unordered_map<std::string, SimObjectCfgInfo> cache_;   ///< Keyed by path.
+    MSFSScanStats stats_;
 
 
     /**
@@ -73,12 +137,16 @@ private:
             type = SimObjectType::SIMCONNECT_SIMOBJECT_TYPE_GROUND;
         } else if (category == "viewer") {
             logger_.trace("Skipping viewer  '{}'", title);
+            return;
         } else if (category == "staticobject") {
             logger_.trace("Skipping static object '{}'", title);
+            return;
         } else if ((category == "flyinganimal") || (category == "animal")) {
             logger_.trace("Skipping animal '{}' (MSFS 2024 feature)", title);
+            return;
         } else if ((category == "aircraftpilot") || (category == "human")) {
             logger_.trace("Skipping human '{}' (MSFS 2024 feature)", title);
+            return;
         } else {
             logger_.error("Unknown category '{}' for SimObject '{}'", category, title);
             return;
@@ -87,124 +155,322 @@ private:
         logger_.debug("Found SimObject: '{}' (category='{}')", title, category);
     }
 
-    // package/SimObjects/Airplanes/xyz/aircraft.cfg
-    // package/SimObjects/Misc/xyz/sim.cfg
+
+    /**
+     * Returns true for FLTSIM.N section names, ignoring case.
+     */
+    [[nodiscard]]
+    static bool isFltsimSection(std::string_view name) noexcept {
+        constexpr std::string_view prefix{ "fltsim." };
+        if (name.size() <= prefix.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < prefix.size(); ++i) {
+            if (std::tolower(static_cast<unsigned char>(name[i])) != prefix[i]) {
+                return false;
+            }
+        }
+        return std::all_of(name.begin() + prefix.size(), name.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+    }
 
 
     /**
-     * Processes a SimObject's configuration file.
-     * 
-     * @param cfgPath The path to the configuration file.
+     * Parses a number that fills the whole text.
+     *
+     * @returns True if the text is a number that fits in the value.
+     */
+    template <class T>
+    [[nodiscard]]
+    static bool parseNumber(std::string_view text, T& value) noexcept {
+        const auto* end = text.data() + text.size();
+        const auto [ptr, ec] = std::from_chars(text.data(), end, value);
+        return (ec == std::errc{}) && (ptr == end);
+    }
+
+
+    /**
+     * Reads a SimObject's configuration file.
+     *
+     * @param info The file's path, size, and last write time, to be completed.
      */
-    void processSimObjectCfg(const std::filesystem::path& cfgPath, std::string baseName)
+    static void parseSimObjectCfg(SimObjectCfgInfo& info)
     {
-        logger_.trace("Processing {}", cfgPath.string());
         IniFile ini;
-        ini.load(cfgPath);
+        ini.load(info.path);
 
-        // Read GENERAL.category once per file as default category
-        std::string category{};
-        std::string baseContainer{};
-
-        if (auto cat = ini.get("general", "category")) {
-            category = *cat;
-            baseCategories_.emplace(baseName, category);
-        } else if (auto base = ini.get("variation", "base_container")) {
-            baseContainer = std::filesystem::path(*base).filename().string();
+        if (auto cat = ini.view("general", "category")) {
+            info.category = *cat;
+        } else if (auto base = ini.view("variation", "base_container")) {
+            // The value is a relative path such as "..\C172", with either kind of separator on any platform.
+            info.baseContainer = base->substr(base->find_last_of("/\\") + 1);
         } else {
-            logger_.warn("No \"category\" found in section \"general\" of {}", cfgPath.string());
             return;
         }
-
-        // Iterate all sections and pick those matching fltsim.N
-        std::regex fltsimRe(R"(^fltsim\.\d+$)", std::regex::icase);
-        for (const auto& [secName, sec] : ini.sections()) {
-            if (!std::regex_match(secName, fltsimRe)) {
+        for (const auto section : ini.sections()) {
+            if (!isFltsimSection(section)) {
                 continue;
             }
+            if (auto title = ini.view(section, "title")) {
+                info.titles.emplace_back(*title);
+            } else {
+                ++info.untitled;
+            }
+        }
+    }
 
-            // Required: title
-            if (!sec.contains("title")) {
-                logger_.warn("Missing title in {}", cfgPath.string());
+
+    // package/SimObjects/Airplanes/xyz/aircraft.cfg
+    // package/SimObjects/Misc/xyz/sim.cfg
+
+    /**
+     * Finds the SimObject configuration files in a package, taking unchanged ones from the cache. This runs on the
+     * scanning threads, so it only reads the cache and writes to its own result.
+     *
+     * @param package The package directory.
+     * @param found Receives the configuration files.
+     * @param parsed Counts the files that were parsed.
+     * @returns An error message, or an empty string.
+     */
+    std::string scanPackage(const std::filesystem::path& package, std::vector<SimObjectCfgInfo>& found, std::atomic<std::size_t>& parsed) const
+    {
+        std::error_code ec;
+        const auto simObjectPath = package / "SimObjects";
+        if (!std::filesystem::is_directory(simObjectPath, ec)) {
+            return {};
+        }
+        std::filesystem::directory_iterator categories(simObjectPath, ec);
+        if (ec) {
+            return std::format("Error iterating directory {}: {}", simObjectPath.string(), ec.message());
+        }
+        for (const auto& categoryEntry : categories) {
+            if (!categoryEntry.is_directory(ec)) {
                 continue;
             }
-
-            const auto& title = sec.at("title");
-            if (!category.empty()) {
-                // Use the category from GENERAL
-                addTitle(category, title);
-                logger_.trace("Added {} '{}'", category, title);
-            } else if (!baseContainer.empty()) {
-                // Try to resolve category via base container
-                if (baseCategories_.contains(baseContainer)) {
-                    const auto& resolvedCategory = baseCategories_.at(baseContainer);
-                    addTitle(resolvedCategory, title);
-                    logger_.trace("Added {} '{}'", resolvedCategory, title);
+            std::filesystem::directory_iterator simObjects(categoryEntry.path(), ec);
+            if (ec) {
+                return std::format("Error iterating directory {}: {}", categoryEntry.path().string(), ec.message());
+            }
+            for (const auto& entry : simObjects) {
+                if (!entry.is_directory(ec)) {
+                    continue;
+                }
+                auto cfgPath = entry.path() / "aircraft.cfg";
+                if (!std::filesystem::is_regular_file(cfgPath, ec)) {
+                    cfgPath = entry.path() / "sim.cfg";
+                    if (!std::filesystem::is_regular_file(cfgPath, ec)) {
+                        continue;
+                    }
+                }
+                SimObjectCfgInfo info{
+                    .path = cfgPath.string(),
+                    .modified = static_cast<std::int64_t>(std::filesystem::last_write_time(cfgPath, ec).time_since_epoch().count()),
+                    .size = std::filesystem::file_size(cfgPath, ec),
+                    .baseName = entry.path().filename().string(),
+                };
+                if (auto it = cache_.find(info.path); (it != cache_.end()) && (it->second.modified == info.modified) && (it->second.size == info.size)) {
+                    found.push_back(it->second);
                 } else {
-                    // Store for later resolution
-                    unresolvedChildren_.emplace(title, baseContainer);
-                    logger_.trace("Stored unresolved '{}' with base container '{}'", title, baseContainer);
+                    parseSimObjectCfg(info);
+                    found.push_back(std::move(info));
+                    ++parsed;
                 }
-            } else {
-                logger_.warn("No category or base_container found for title '{}' in {}", title, cfgPath.string());
             }
         }
+        return {};
     }
 
 
     /**
-     * Scans a package for SimObjects.
-     * 
-     * @param categoryRoot The root path of the SimObjects in the package.
+     * Lists the package directories in the roots, sorted per root.
      */
-    void scanCategory(const std::filesystem::path& categoryRoot)
-    {
-        logger_.debug("Scanning category root: {}", categoryRoot.string());
-
-        std::error_code ec;
-        for (const auto& entry : std::filesystem::directory_iterator(categoryRoot, ec)) {
+    std::vector<std::filesystem::path> listPackages(const std::vector<std::filesystem::path>& roots) {
+        std::vector<std::filesystem::path> packages;
+        for (const auto& root : roots) {
+            logger_.debug("Scanning root: {}", root.string());
+
+            std::error_code ec;
+            const auto first = packages.size();
+            for (const auto& entry : std::filesystem::directory_iterator(root, ec)) {
+                if (entry.is_directory(ec)) {
+                    packages.push_back(entry.path());
+                }
+            }
             if (ec) {
-                logger_.error("Error iterating directory {}: {}", categoryRoot.string(), ec.message());
-                return;
+                logger_.error("Error iterating directory {}: {}", root.string(), ec.message());
             }
+            std::sort(packages.begin() + static_cast<std::ptrdiff_t>(first), packages.end());
+        }
+        return packages;
+    }
 
-            if (entry.is_directory()) {
-                const auto simObjectDir = entry.path();
-                logger_.debug("Checking SimObject directory: {}", simObjectDir.string());
-                if (const auto aircraftCfg = entry.path() / "aircraft.cfg"; std::filesystem::exists(aircraftCfg) && std::filesystem::is_regular_file(aircraftCfg)) {
-                    processSimObjectCfg(aircraftCfg, entry.path().filename().string());
-                } else if (const auto simCfg = entry.path() / "sim.cfg"; std::filesystem::exists(simCfg) && std::filesystem::is_regular_file(simCfg)) {
-                    processSimObjectCfg(simCfg, entry.path().filename().string());
-                } else {
-                    logger_.trace("No SimObject configuration found in {}", entry.path().string());
+
+    /**
+     * Scans the packages on the configured number of threads, and merges the results.
+     */
+    void scanPackages(const std::vector<std::filesystem::path>& roots) {
+        const auto packages = listPackages(roots);
+        std::vector<std::vector<SimObjectCfgInfo>> found(packages.size());
+        std::vector<std::string> problems(packages.size());
+        std::atomic<std::size_t> next{ 0 };
+        std::atomic<std::size_t> parsed{ 0 };
+
+        auto work = [&]() {
+            for (auto index = next++; index < packages.size(); index = next++) {
+                try {
+                    problems[index] = scanPackage(packages[index], found[index], parsed);
+                } catch (const std::exception& e) {
+                    problems[index] = std::format("Error scanning package {}: {}", packages[index].string(), e.what());
                 }
             }
+        };
+        const auto threads = std::min<std::size_t>((config_.threads != 0) ? config_.threads : std::max(std::thread::hardware_concurrency(), 1U),
+                                                   std::max<std::size_t>(packages.size(), 1));
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+            for (std::size_t i = 1; i < threads; ++i) {
+                workers.emplace_back(work);
+            }
+            work();
+        }
+
+        for (const auto& problem : problems) {
+            if (!problem.empty()) {
+                logger_.error("{}", problem);
+            }
         }
+        merge(found);
+
+        stats_ = MSFSScanStats{ .packages = packages.size(), .files = cache_.size(), .parsed = parsed };
+        stats_.cached = stats_.files - stats_.parsed;
+        logger_.debug("Scanned {} packages with {} SimObject files, {} parsed and {} cached.", stats_.packages, stats_.files, stats_.parsed, stats_.cached);
     }
 
 
     /**
-     * Scans a root directory for packages containing SimObjects.
-     * 
-     * @param root The root directory to scan.
+     * Collects the titles from the scanned files, and replaces the cache with them.
      */
-    void scanTree(const std::filesystem::path& root) {
-        logger_.debug("Scanning root: {}", root.string());
-        for (const auto& entry : std::filesystem::directory_iterator(root)) {
-            if (entry.is_directory()) {
-                const auto simObjectPath = entry.path() / "SimObjects";
-                if (std::filesystem::exists(simObjectPath) && std::filesystem::is_directory(simObjectPath)) {
-                    // Scan the SimObject categories in this package
-                    for (const auto& categoryEntry : std::filesystem::directory_iterator(simObjectPath)) {
-                        if (categoryEntry.is_directory()) {
-                            scanCategory(categoryEntry.path());
+    void merge(std::vector<std::vector<SimObjectCfgInfo>>& found) {
+        baseCategories_.clear();
+        titles_.clear();
+        cache_.clear();
+
+        for (const auto& package : found) {
+            for (const auto& info : package) {
+                if (!info.category.empty()) {
+                    baseCategories_.emplace(info.baseName, info.category);
+                }
+            }
+        }
+        for (auto& package : found) {
+            for (auto& info : package) {
+                logger_.trace("Processing {}", info.path);
+                if (info.untitled > 0) {
+                    logger_.warn("Missing title in {} FLTSIM sections of {}", info.untitled, info.path);
+                }
+                if (!info.category.empty()) {
+                    for (const auto& title : info.titles) {
+                        addTitle(info.category, title);
+                    }
+                } else if (!info.baseContainer.empty()) {
+                    const auto base = baseCategories_.find(info.baseContainer);
+                    for (const auto& title : info.titles) {
+                        if (base != baseCategories_.end()) {
+                            addTitle(base->second, title);
+                            logger_.trace("Resolved and added {} '{}'", base->second, title);
+                        } else {
+                            logger_.warn("No base container '{}' with a category for title '{}'", info.baseContainer, title);
                         }
                     }
+                } else {
+                    logger_.warn("No \"category\" found in section \"general\" of {}", info.path);
+                }
+                auto path = info.path;
+                cache_.insert_or_assign(std::move(path), std::move(info));
+            }
+        }
+    }
+
+
+    void loadCache() {
+        cacheLoaded_ = true;
+        std::ifstream in(config_.cacheFile);
+        std::string line;
+        if (!in || !std::getline(in, line) || (line != cacheMagic)) {
+            return;
+        }
+        SimObjectCfgInfo* info{ nullptr };
+        bool corrupt{ false };
+        while (!corrupt && std::getline(in, line)) {
+            if (line.size() < 2) {
+                continue;
+            }
+            const auto value = line.substr(2);
+            switch (line[0]) {
+            case 'F':
+            {
+                SimObjectCfgInfo entry;
+                const auto sizeStart = value.find(' ');
+                const auto pathStart = (sizeStart == std::string::npos) ? std::string::npos : value.find(' ', sizeStart + 1);
+                const std::string_view text{ value };
+                if ((pathStart == std::string::npos) ||
+                    !parseNumber(text.substr(0, sizeStart), entry.modified) ||
+                    !parseNumber(text.substr(sizeStart + 1, pathStart - sizeStart - 1), entry.size))
+                {
+                    corrupt = true;
+                    break;
+                }
+                entry.path = value.substr(pathStart + 1);
+                auto path = entry.path;
+                info = &cache_.insert_or_assign(std::move(path), std::move(entry)).first->second;
+            }
+                break;
+            case 'B': if (info != nullptr) { info->baseName = value; } break;
+            case 'C': if (info != nullptr) { info->category = value; } break;
+            case 'K': if (info != nullptr) { info->baseContainer = value; } break;
+            case 'U': if ((info != nullptr) && !parseNumber(value, info->untitled)) { corrupt = true; } break;
+            case 'T': if (info != nullptr) { info->titles.push_back(value); } break;
+            default: break;
+            }
+        }
+        if (corrupt) {
+            logger_.warn("Ignoring corrupt SimObject cache {}", config_.cacheFile.string());
+            cache_.clear();
+            return;
+        }
+        logger_.debug("Loaded {} SimObject files from cache {}", cache_.size(), config_.cacheFile.string());
+    }
+
+
+    void saveCache() {
+        auto tmpPath = config_.cacheFile;
+        tmpPath += ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::trunc);
+            out << cacheMagic << '\n';
+            for (const auto& [path, info] : cache_) {
+                out << "F " << info.modified << ' ' << info.size << ' ' << info.path << '\n';
+                out << "B " << info.baseName << '\n';
+                if (!info.category.empty()) { out << "C " << info.category << '\n'; }
+                if (!info.baseContainer.empty()) { out << "K " << info.baseContainer << '\n'; }
+                if (info.untitled > 0) { out << "U " << info.untitled << '\n'; }
+                for (const auto& title : info.titles) {
+                    out << "T " << title << '\n';
                 }
             }
+            if (!out) {
+                logger_.error("Failed to write SimObject cache {}", tmpPath.string());
+                return;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, config_.cacheFile, ec);
+        if (ec) {
+            logger_.error("Failed to replace SimObject cache {}: {}", config_.cacheFile.string(), ec.message());
         }
     }
 
+
 #pragma warning(push)
 #pragma warning(disable : 4996)
 
@@ -308,6 +574,11 @@ public:
     {
     }
 
+    MSFSScanner(MSFSScanConfig config, std::string loggerName = "SimConnect::ai::MSFSScanner", LogLevel logLevel = LogLevel::Info)
+        : logger_(loggerName, logLevel), config_(std::move(config))
+    {
+    }
+
     ~MSFSScanner() = default;
 
 
@@ -320,43 +591,54 @@ public:
 
 
     /**
-     * Scans for SimObjects of the specified type and invokes the callback for each found title and livery.
-     * 
-     * @param type The type of SimObject to scan for.
-     * @param callback The callback to invoke for each found title and livery.
+     * Returns the counters of the last scan.
      */
-    void scan(SimObjectType type, std::function<void (std::string_view title, std::string_view livery)> callback) {
-        if (!scanDone_) {
+    [[nodiscard]]
+    const MSFSScanStats& stats() const noexcept { return stats_; }
+
+
+    /**
+     * Scans the packages again. Only configuration files that are new or have changed since the previous scan are
+     * parsed, and the cache file, if configured, is updated.
+     */
+    void rescan() {
+        auto roots = config_.roots;
+        if (roots.empty()) {
             const auto installed = installedPackagesPath();
             if (installed.empty()) {
                 logger_.error("Cannot scan SimObjects: InstalledPackagesPath not found");
                 return;
             }
-
-            // Official packages
-            const auto official = installed / "Official" / "OneStore";
-            if (std::filesystem::exists(official) && std::filesystem::is_directory(official)) {
-                scanTree(official);
+            for (const auto& root : { installed / "Official" / "OneStore", installed / "Community" }) {
+                if (std::error_code ec; std::filesystem::is_directory(root, ec)) {
+                    roots.push_back(root);
+                }
             }
+        }
+        if (!config_.cacheFile.empty() && !cacheLoaded_) {
+            loadCache();
+        }
+        const auto previous = cache_.size();
 
-            // Community packages
-            const auto community = installed / "Community";
-            if (std::filesystem::exists(community) && std::filesystem::is_directory(community)) {
-                scanTree(community);
-            }
+        scanPackages(roots);
+
+        if (!config_.cacheFile.empty() && ((stats_.parsed > 0) || (stats_.files != previous))) {
+            saveCache();
+        }
+        scanDone_ = true;
+    }
 
-            // Resolve any unresolved children
-            for (const auto& [title, baseContainer] : unresolvedChildren_) {
-                if (baseCategories_.contains(baseContainer)) {
-                    const auto& resolvedCategory = baseCategories_.at(baseContainer);
-                    addTitle(resolvedCategory, title);
-                    logger_.trace("Resolved and added {} '{}'", resolvedCategory, title);
-                } else {
-                    logger_.warn("No base container '{}' with a category for title '{}'", baseContainer, title);
-                }
-            }
 
-            scanDone_ = true;
+    /**
+     * Scans for SimObjects of the specified type and invokes the callback for each found title and livery. The
+     * packages are scanned on the first call only; use rescan() to pick up changes.
+     * 
+     * @param type The type of SimObject to scan for.
+     * @param callback The callback to invoke for each found title and livery.
+     */
+    void scan(SimObjectType type, std::function<void (std::string_view title, std::string_view livery)> callback) {
+        if (!scanDone_) {
+            rescan();
         }
 
         if (titles_.contains(type)) {
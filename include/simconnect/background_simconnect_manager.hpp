@@ -20,9 +20,11 @@
 #include <simconnect/windows_event_connection.hpp>
 #include <simconnect/windows_event_handler.hpp>
 
+#include <simconnect/registration_journal.hpp>
 #include <simconnect/requests/system_state_handler.hpp>
 #include <simconnect/events/system_events.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -102,6 +104,9 @@ struct VoidResult {
  * Background thread manager for SimConnect connections.
  * Handles automatic connection, reconnection, and message dispatching on a background thread.
  *
+ * All handlers run on the worker thread. To hand decoded data to other threads without sharing a lock with the
+ * worker, push it into an OutboundQueue from the handler and let the consumers pop it on their own schedule.
+ *
  * @tparam C The connection type to use
  * @tparam H The handler type for SimConnect message processing
  */
@@ -121,6 +126,8 @@ private:
 
     bool autoConnect_{ true };
     std::chrono::milliseconds reconnectDelay_{ 3000 };
+    std::chrono::milliseconds maxReconnectDelay_{ 60000 };
+    double reconnectBackoff_{ 1.0 }; // Factor applied to the delay after each failed attempt; 1.0 = fixed delay
     std::chrono::milliseconds messageCheckInterval_{ 50 };
     std::chrono::milliseconds initialConnectDelay_{ 0 };
     std::chrono::milliseconds openHandshakeTimeout_{ 10000 }; // 10 seconds timeout for OPEN message
@@ -158,6 +165,10 @@ private:
     EventHandler<handler_type> eventHandler_;
 	SystemEvents<handler_type> systemEvents_;
 
+    // Registrations and requests restored after every (re)connect
+    RegistrationJournal<connection_type> journal_;
+    std::atomic<bool> journalPending_{ false };
+
     // Simulator information
     std::string simName_{};
     std::string simVersion_{};
@@ -202,6 +213,14 @@ public:
     BackgroundSimConnectManager<C,H>& reconnectDelay(std::chrono::milliseconds delay) noexcept { reconnectDelay_ = delay; return *this; }
 
 
+    std::chrono::milliseconds maxReconnectDelay() const noexcept { return maxReconnectDelay_; }
+    BackgroundSimConnectManager<C,H>& maxReconnectDelay(std::chrono::milliseconds delay) noexcept { maxReconnectDelay_ = delay; return *this; }
+
+
+    double reconnectBackoff() const noexcept { return reconnectBackoff_; }
+    BackgroundSimConnectManager<C,H>& reconnectBackoff(double factor) noexcept { reconnectBackoff_ = std::max(factor, 1.0); return *this; }
+
+
     std::chrono::milliseconds messageCheckInterval() const noexcept { return messageCheckInterval_; }
     BackgroundSimConnectManager<C,H>& messageCheckInterval(std::chrono::milliseconds interval) noexcept { messageCheckInterval_ = interval; return *this; }
 
@@ -272,6 +291,18 @@ public:
         return systemEvents_;
     }
 
+
+    /**
+     * Return the registration journal. Registrations and requests recorded here are sent again, in one batch, every
+     * time the connection is (re)opened. Call applyJournal() to send new entries on the current connection.
+     *
+     * @returns The registration journal.
+     */
+    [[nodiscard]]
+    RegistrationJournal<connection_type>& journal() noexcept {
+        return journal_;
+    }
+
 #pragma endregion
 
 #pragma region Control methods
@@ -353,6 +384,15 @@ public:
         cv_.notify_all();
     }
 
+    /**
+     * Have the worker thread send the journal entries added since the last replay, if connected. Entries added while
+     * disconnected are sent with the replay after the next connect.
+     */
+    void applyJournal() noexcept {
+        journalPending_ = true;
+        cv_.notify_all();
+    }
+
     /**
      * Request disconnection (disables auto-reconnect until connect() is called).
      */
@@ -382,6 +422,27 @@ public:
         return state_.load() == State::Connected;
     }
 
+    /**
+     * Get the number of failed connection attempts since the last successful one.
+     */
+    [[nodiscard]]
+    int reconnectAttempts() const noexcept {
+        return reconnectAttempts_.load();
+    }
+
+    /**
+     * Get the delay before the next connection attempt, which grows with the number of failed attempts when a
+     * reconnect backoff factor above 1 is set.
+     */
+    [[nodiscard]]
+    std::chrono::milliseconds nextReconnectDelay() const noexcept {
+        auto delay = static_cast<double>(reconnectDelay_.count());
+        for (int i = 1; i < reconnectAttempts_.load() && delay < static_cast<double>(maxReconnectDelay_.count()); ++i) {
+            delay *= reconnectBackoff_;
+        }
+        return std::min(std::chrono::milliseconds(static_cast<long long>(delay)), std::max(reconnectDelay_, maxReconnectDelay_));
+    }
+
     /**
      * Get last error information.
      */
@@ -399,6 +460,33 @@ public:
         return lastErrorMessage_;
     }
 
+    /**
+     * Get the name of the simulator, as reported when the connection was opened. Empty until the first connect.
+     */
+    [[nodiscard]]
+    std::string simulatorName() const {
+        std::lock_guard lock(mutex_);
+        return simName_;
+    }
+
+    /**
+     * Get the simulator version, as "major.minor".
+     */
+    [[nodiscard]]
+    std::string simulatorVersion() const {
+        std::lock_guard lock(mutex_);
+        return simVersion_;
+    }
+
+    /**
+     * Get the simulator build, as "major.minor". Data cached per simulator, such as facilities, should be keyed on it.
+     */
+    [[nodiscard]]
+    std::string simulatorBuild() const {
+        std::lock_guard lock(mutex_);
+        return simBuild_;
+    }
+
     /**
      * Get the underlying connection.
      * The connection object always exists, its methods handle disconnected state gracefully.
@@ -512,17 +600,21 @@ private:
         logger_.trace("Registering OPEN handler");
         // Register essential handlers for connection state management
         handler_.template registerHandler<Messages::OpenMsg>(Messages::open, [this](const Messages::OpenMsg& msg) {
-            simName_ = msg.szApplicationName;
-            simVersion_ = version(msg.dwApplicationVersionMajor, msg.dwApplicationVersionMinor);
-            simBuild_ = version(msg.dwApplicationBuildMajor, msg.dwApplicationBuildMinor);
-            simConnectVersion_ = version(msg.dwSimConnectVersionMajor, msg.dwSimConnectVersionMinor);
-            simConnectBuild_ = version(msg.dwSimConnectBuildMajor, msg.dwSimConnectBuildMinor);
+            {
+                std::lock_guard lock(mutex_);
+                simName_ = msg.szApplicationName;
+                simVersion_ = version(msg.dwApplicationVersionMajor, msg.dwApplicationVersionMinor);
+                simBuild_ = version(msg.dwApplicationBuildMajor, msg.dwApplicationBuildMinor);
+                simConnectVersion_ = version(msg.dwSimConnectVersionMajor, msg.dwSimConnectVersionMinor);
+                simConnectBuild_ = version(msg.dwSimConnectBuildMajor, msg.dwSimConnectBuildMinor);
+            }
 
             logger_.info("Connected to simulator: {} (version {}, build {}) via SimConnect version {} (build {})", 
                 simName_, simVersion_, simBuild_, simConnectVersion_, simConnectBuild_);
             
             // Apply any pending handler registrations now that we're fully connected
             applyPendingHandlerRegistrations();
+            replayJournal();
             
             transitionState(State::Connected);
         });
@@ -590,8 +682,9 @@ private:
 
             // Wait before retry
             {
+                const auto delay = nextReconnectDelay();
                 std::unique_lock lock(mutex_);
-                cv_.wait_for(lock, reconnectDelay_, [&] { return shouldStop(); });
+                cv_.wait_for(lock, delay, [&] { return shouldStop(); });
             }
             if (!shouldContinueRunning()) {
                 logger_.trace("Giving up trying to connect, because we were asked to stop.");
@@ -664,6 +757,10 @@ private:
             return;
         }
 
+        if (journalPending_.exchange(false)) {
+            journal_.apply(connection_);
+        }
+
 		logger_.trace("Processing messages...");
         // Process messages continuously with short timeout
         auto result = processMessages();
@@ -675,7 +772,7 @@ private:
         
         // Wait for state change or timeout instead of blocking sleep
         std::unique_lock lock(mutex_);
-        cv_.wait_for(lock, messageCheckInterval_, [&] { return shouldStop(); });
+        cv_.wait_for(lock, messageCheckInterval_, [&] { return shouldStop() || journalPending_.load(); });
     }
 
 
@@ -794,6 +891,18 @@ private:
         }
     }
 
+    void replayJournal() noexcept {
+        try {
+            journalPending_ = false;
+            const auto failures = journal_.replay(connection_);
+            const auto stats = journal_.stats();
+            logger_.info("Replayed {} registration(s) and {} request(s) in {} us ({} failed)",
+                stats.registrations, stats.actions, stats.lastReplayDuration.count(), failures);
+        } catch (const std::exception& e) {
+            setError(ErrorCode::ResourceInitializationFailed, std::string("Journal replay failed: ") + e.what());
+        }
+    }
+
     void cleanupConnection() noexcept {
         try {
             if (connection_.isOpen()) {
@@ -0,0 +1,535 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/comm_bus_handler.hpp>
+#include <simconnect/requests/request.hpp>
+
+
+namespace SimConnect {
+
+
+#if MSFS_2024_SDK
+
+/**
+ * Settings for a CommBusChannel.
+ *
+ * @note Flow control only works if the peer acknowledges chunks. Set window to 0 when talking to a
+ * peer that does not send acknowledgements, otherwise the sender stalls after the first window.
+ */
+struct CommBusChannelConfig {
+    std::size_t chunkSize{ 4096 };              ///< Maximum number of payload bytes per CommBus broadcast, excluding the chunk header.
+    std::size_t window{ 8 };                    ///< Maximum number of unacknowledged chunks in flight. 0 disables flow control and acknowledgements.
+    std::size_t poolSize{ 4 };                  ///< Maximum number of idle reassembly buffers kept for reuse.
+    std::size_t bufferCapacity{ 64 * 1024 };    ///< Capacity reserved up-front for every new reassembly buffer.
+    std::size_t maxMessageSize{ 16 * 1024 * 1024 }; ///< Largest payload accepted for reassembly. Chunks of larger messages are dropped.
+    std::size_t maxIncoming{ 4 };               ///< Maximum number of partially received messages. Beyond this, the least recently updated one is dropped.
+    CommBusBroadcastToFlag broadcastTo{ CommBusBroadcastTo::defaultFlag }; ///< Target(s) for both data chunks and acknowledgements.
+};
+
+
+/**
+ * The header prefixed to every chunk sent over a CommBusChannel, in text form: "<sequence>:<index>:<count>:".
+ * A text header keeps the frames readable for JavaScript peers, which can split on the first three colons.
+ */
+struct CommBusChunkHeader {
+    std::uint32_t sequence{ 0 };    ///< Sequence number of the message this chunk belongs to.
+    std::uint32_t index{ 0 };       ///< Zero-based index of this chunk within the message.
+    std::uint32_t count{ 1 };       ///< Total number of chunks in the message.
+
+    static constexpr std::size_t maxLength{ 3 * 10 + 3 };  ///< Three 32-bit decimals plus separators.
+
+
+    /**
+     * Appends the text form of this header to the given string.
+     *
+     * @param out The string to append to.
+     */
+    void appendTo(std::string& out) const {
+        std::array<char, maxLength> buf{};
+        char* pos = buf.data();
+        char* const end = buf.data() + buf.size();
+        for (const auto value : { sequence, index, count }) {
+            pos = std::to_chars(pos, end, value).ptr;
+            *pos++ = ':';
+        }
+        out.append(buf.data(), pos);
+    }
+
+
+    /**
+     * Splits a received frame into its header and payload.
+     *
+     * @param frame The frame as received.
+     * @returns The header and the payload that follows it, or std::nullopt if the frame has no valid header.
+     */
+    [[nodiscard]]
+    static std::optional<std::pair<CommBusChunkHeader, std::string_view>> parse(std::string_view frame) noexcept {
+        CommBusChunkHeader header;
+        const char* pos = frame.data();
+        const char* const end = frame.data() + frame.size();
+        for (auto* field : { &header.sequence, &header.index, &header.count }) {
+            auto [ptr, ec] = std::from_chars(pos, end, *field);
+            if (ec != std::errc{} || ptr == end || *ptr != ':') {
+                return std::nullopt;
+            }
+            pos = ptr + 1;
+        }
+        if (header.count == 0 || header.index >= header.count) {
+            return std::nullopt;
+        }
+        return std::make_pair(header, std::string_view{ pos, static_cast<std::size_t>(end - pos) });
+    }
+};
+
+
+/**
+ * A pool of reusable string buffers. Buffers handed back keep their capacity, so once the pool has warmed up
+ * reassembling messages no larger than the reserved capacity does not allocate.
+ */
+class CommBusBufferPool {
+    std::vector<std::string> free_;
+    std::size_t maxIdle_;
+    std::size_t capacity_;
+
+public:
+    CommBusBufferPool(std::size_t maxIdle, std::size_t capacity) : maxIdle_(maxIdle), capacity_(capacity) {
+        free_.reserve(maxIdle_);
+        for (std::size_t i = 0; i < maxIdle_; ++i) {
+            free_.emplace_back().reserve(capacity_);
+        }
+    }
+
+
+    /**
+     * Takes an empty buffer from the pool, or creates a new pre-sized one if the pool is empty.
+     *
+     * @param sizeHint The expected size of the content, used to grow the buffer in one step.
+     * @returns An empty buffer with at least the configured capacity.
+     */
+    [[nodiscard]]
+    std::string acquire(std::size_t sizeHint = 0) {
+        std::string buffer;
+        if (!free_.empty()) {
+            buffer = std::move(free_.back());
+            free_.pop_back();
+        }
+        buffer.reserve((std::max)(capacity_, sizeHint));
+        return buffer;
+    }
+
+
+    /**
+     * Returns a buffer to the pool. If the pool already holds its maximum of idle buffers, the buffer is dropped.
+     *
+     * @param buffer The buffer to return.
+     */
+    void release(std::string&& buffer) {
+        if (free_.size() < maxIdle_) {
+            buffer.clear();
+            free_.push_back(std::move(buffer));
+        }
+    }
+
+
+    /**
+     * Returns the number of idle buffers in the pool.
+     */
+    [[nodiscard]]
+    std::size_t idle() const noexcept { return free_.size(); }
+};
+
+
+/**
+ * A CommBusChannel streams payloads of arbitrary size over a single CommBus event name. Outgoing payloads are split
+ * into chunks that each carry a CommBusChunkHeader, and at most `window` chunks are kept in flight until the peer
+ * acknowledges them on the event "<name>.ack" with "<sequence>:<index>". Incoming chunks are reassembled into buffers
+ * taken from a CommBusBufferPool and acknowledged in the same way.
+ *
+ * @note Chunks are sent by whichever thread finds the channel idle, and never while the channel's own lock is held, so
+ * send() may be called from any thread, including from inside a message handler.
+ * @note Payloads are carried as C strings by CommBus, so they must not contain NUL characters.
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ */
+template <class M>
+class CommBusChannel
+{
+public:
+    using comm_bus_handler_type = CommBusHandler<M>;
+    using connection_type = typename M::connection_type;
+    using mutex_type = typename connection_type::mutex_type;
+    using guard_type = typename connection_type::guard_type;
+
+
+private:
+    struct Outgoing {
+        std::uint32_t sequence;
+        std::uint32_t nextIndex;
+        std::uint32_t count;
+        std::string payload;
+    };
+
+    struct Incoming {
+        std::uint32_t sequence;
+        std::uint32_t nextIndex;
+        std::uint32_t count;
+        std::uint64_t lastChunk;    ///< Value of chunksReceived_ when this message last received a chunk.
+        std::string buffer;
+    };
+
+    comm_bus_handler_type& commBusHandler_;
+    std::string name_;
+    std::string ackName_;
+    CommBusChannelConfig config_;
+
+    mutable mutex_type mutex_;
+    std::uint32_t nextSequence_{ 1 };
+    std::deque<Outgoing> outgoing_;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> inFlight_;   ///< (sequence, index) of unacknowledged chunks.
+    bool pumping_{ false };
+    std::string frame_;                                                 ///< Only touched by the pumping thread.
+    std::optional<Request> ackSubscription_;
+
+    std::vector<Incoming> incoming_;
+    CommBusBufferPool pool_;
+    std::uint64_t chunksReceived_{ 0 };
+    std::size_t droppedChunks_{ 0 };
+    std::size_t evictedMessages_{ 0 };
+    std::size_t sentChunks_{ 0 };
+
+
+    // No copies or moves
+    CommBusChannel(const CommBusChannel&) = delete;
+    CommBusChannel(CommBusChannel&&) = delete;
+    CommBusChannel& operator=(const CommBusChannel&) = delete;
+    CommBusChannel& operator=(CommBusChannel&&) = delete;
+
+
+    [[nodiscard]]
+    connection_type& connection() const noexcept {
+        return commBusHandler_.simConnectMessageHandler().connection();
+    }
+
+
+    [[nodiscard]]
+    bool windowOpen() const noexcept {
+        return (config_.window == 0) || (inFlight_.size() < config_.window);
+    }
+
+
+    /**
+     * Sends queued chunks while the window allows it. Only one thread pumps at a time, which keeps the chunks
+     * of a message in order without holding our lock while calling into the connection.
+     */
+    void pump() {
+        {
+            guard_type lock(mutex_);
+            if (pumping_) {
+                return;
+            }
+            pumping_ = true;
+        }
+        while (true) {
+            {
+                guard_type lock(mutex_);
+                if (outgoing_.empty() || !windowOpen()) {
+                    pumping_ = false;
+                    return;
+                }
+                auto& msg = outgoing_.front();
+                const CommBusChunkHeader header{ msg.sequence, msg.nextIndex, msg.count };
+                const std::size_t offset = static_cast<std::size_t>(msg.nextIndex) * config_.chunkSize;
+                const auto chunk = std::string_view{ msg.payload }.substr((std::min)(offset, msg.payload.size()), config_.chunkSize);
+
+                frame_.clear();
+                header.appendTo(frame_);
+                frame_.append(chunk);
+
+                if (config_.window != 0) {
+                    inFlight_.emplace_back(msg.sequence, msg.nextIndex);
+                }
+                if (++msg.nextIndex == msg.count) {
+                    outgoing_.pop_front();
+                }
+                ++sentChunks_;
+            }
+            connection().callCommBusEvent(name_, frame_, config_.broadcastTo);
+        }
+    }
+
+
+    /**
+     * Handles an acknowledgement from the peer, opening the window by one chunk.
+     */
+    void onAck(std::string_view ack) {
+        std::uint32_t sequence{ 0 };
+        std::uint32_t index{ 0 };
+        const char* const end = ack.data() + ack.size();
+        auto [ptr, ec] = std::from_chars(ack.data(), end, sequence);
+        if (ec != std::errc{} || ptr == end || *ptr != ':') {
+            return;
+        }
+        if (std::from_chars(ptr + 1, end, index).ec != std::errc{}) {
+            return;
+        }
+        {
+            guard_type lock(mutex_);
+            auto it = std::find(inFlight_.begin(), inFlight_.end(), std::make_pair(sequence, index));
+            if (it == inFlight_.end()) {
+                return;
+            }
+            inFlight_.erase(it);
+        }
+        pump();
+    }
+
+
+    /**
+     * Drops a partially received message, returning its buffer to the pool.
+     */
+    void dropIncoming(typename std::vector<Incoming>::iterator it) {
+        pool_.release(std::move(it->buffer));
+        incoming_.erase(it);
+    }
+
+
+    /**
+     * Makes room for a new partially received message by dropping the one that has been waiting longest for its next
+     * chunk. Without this, every message that lost a chunk would keep its buffer forever.
+     */
+    void evictIncoming() {
+        while (!incoming_.empty() && incoming_.size() >= (std::max<std::size_t>)(1, config_.maxIncoming)) {
+            dropIncoming(std::min_element(incoming_.begin(), incoming_.end(),
+                [](const Incoming& lhs, const Incoming& rhs) { return lhs.lastChunk < rhs.lastChunk; }));
+            ++evictedMessages_;
+        }
+    }
+
+
+    /**
+     * Handles a received chunk, delivering the payload once its last chunk arrives.
+     */
+    void onChunk(std::string_view frame, const std::function<void(std::string_view)>& handler) {
+        const auto parsed = CommBusChunkHeader::parse(frame);
+        if (!parsed) {
+            guard_type lock(mutex_);
+            ++droppedChunks_;
+            return;
+        }
+        const auto& [header, chunk] = *parsed;
+
+        if (config_.window != 0) {
+            const auto ack = std::to_string(header.sequence) + ':' + std::to_string(header.index);
+            connection().callCommBusEvent(ackName_, ack, config_.broadcastTo);
+        }
+        if (header.count == 1) {
+            handler(chunk);
+            return;
+        }
+
+        std::string payload;
+        {
+            guard_type lock(mutex_);
+            ++chunksReceived_;
+            auto it = std::find_if(incoming_.begin(), incoming_.end(), [&header](const Incoming& in) { return in.sequence == header.sequence; });
+
+            // Every chunk but the last is full, so the first one tells us roughly how large the message will be.
+            // The count comes from the peer, so refuse anything that would not fit rather than reserving it.
+            const auto expectedSize = static_cast<std::uint64_t>(chunk.size()) * header.count;
+            if (header.index == 0 && expectedSize > config_.maxMessageSize) {
+                ++droppedChunks_;
+                if (it != incoming_.end()) {
+                    dropIncoming(it);
+                }
+                return;
+            }
+            if (header.index == 0) {
+                if (it == incoming_.end()) {
+                    evictIncoming();
+                    it = incoming_.insert(incoming_.end(), Incoming{ header.sequence, 0, header.count, chunksReceived_,
+                                                                     pool_.acquire(static_cast<std::size_t>(expectedSize)) });
+                } else {
+                    // A restarted sequence number; drop what we had.
+                    ++droppedChunks_;
+                    it->buffer.clear();
+                    it->nextIndex = 0;
+                    it->count = header.count;
+                }
+            } else if (it == incoming_.end() || it->nextIndex != header.index || it->count != header.count ||
+                       it->buffer.size() + chunk.size() > config_.maxMessageSize) {
+                ++droppedChunks_;
+                if (it != incoming_.end()) {
+                    dropIncoming(it);
+                }
+                return;
+            }
+            it->lastChunk = chunksReceived_;
+            it->buffer.append(chunk);
+            if (++it->nextIndex < it->count) {
+                return;
+            }
+            payload = std::move(it->buffer);
+            incoming_.erase(it);
+        }
+        handler(std::string_view{ payload });
+
+        guard_type lock(mutex_);
+        pool_.release(std::move(payload));
+    }
+
+
+public:
+    CommBusChannel(comm_bus_handler_type& commBusHandler, std::string_view name, CommBusChannelConfig config = {})
+        : commBusHandler_(commBusHandler), name_(name), ackName_(std::string(name) + ".ack"), config_(config),
+          pool_(config.poolSize, config.bufferCapacity)
+    {
+        if (config_.chunkSize == 0) {
+            config_.chunkSize = 1;
+        }
+        frame_.reserve(CommBusChunkHeader::maxLength + config_.chunkSize);
+    }
+    ~CommBusChannel() = default;
+
+
+    /**
+     * Returns the CommBus event name of this channel.
+     */
+    [[nodiscard]]
+    const std::string& name() const noexcept { return name_; }
+
+
+    /**
+     * Queues a payload for sending, and sends as many of its chunks as the flow-control window allows.
+     * The remaining chunks go out as acknowledgements arrive.
+     *
+     * @param payload The payload to send.
+     * @returns The sequence number assigned to the payload.
+     */
+    std::uint32_t send(std::string_view payload) {
+        std::uint32_t sequence{ 0 };
+        {
+            guard_type lock(mutex_);
+            if (config_.window != 0 && !ackSubscription_) {
+                ackSubscription_.emplace(commBusHandler_.subscribeToEvent(ackName_, [this](std::string_view ack) { onAck(ack); }));
+            }
+            sequence = nextSequence_++;
+            const auto count = static_cast<std::uint32_t>((std::max<std::size_t>)(1, (payload.size() + config_.chunkSize - 1) / config_.chunkSize));
+            outgoing_.push_back(Outgoing{ sequence, 0, count, std::string(payload) });
+        }
+        pump();
+        return sequence;
+    }
+
+
+    /**
+     * Subscribes to the payloads arriving on this channel. A channel keeps a single reassembly state, so it
+     * supports a single subscription.
+     *
+     * @param handler The handler to call with every completely reassembled payload. The view is only valid during the call.
+     * @returns A Request that unsubscribes when destroyed or stopped.
+     */
+    [[nodiscard]]
+    Request subscribe(std::function<void(std::string_view)> handler) {
+        return commBusHandler_.subscribeToEvent(name_, [this, handler = std::move(handler)](std::string_view frame) {
+            onChunk(frame, handler);
+        });
+    }
+
+
+    /**
+     * Forgets all unacknowledged chunks, for example after the peer was reloaded. Queued chunks are sent again
+     * as far as the window allows.
+     */
+    void resetWindow() {
+        {
+            guard_type lock(mutex_);
+            inFlight_.clear();
+        }
+        pump();
+    }
+
+
+    /**
+     * Returns the number of chunks sent but not yet acknowledged.
+     */
+    [[nodiscard]]
+    std::size_t inFlight() const {
+        guard_type lock(mutex_);
+        return inFlight_.size();
+    }
+
+
+    /**
+     * Returns the number of payloads that still have chunks waiting to be sent.
+     */
+    [[nodiscard]]
+    std::size_t pending() const {
+        guard_type lock(mutex_);
+        return outgoing_.size();
+    }
+
+
+    /**
+     * Returns the total number of chunks sent.
+     */
+    [[nodiscard]]
+    std::size_t sentChunks() const {
+        guard_type lock(mutex_);
+        return sentChunks_;
+    }
+
+
+    /**
+     * Returns the number of received chunks that were dropped because they were malformed, out of order, or part of
+     * a message larger than CommBusChannelConfig::maxMessageSize.
+     */
+    [[nodiscard]]
+    std::size_t droppedChunks() const {
+        guard_type lock(mutex_);
+        return droppedChunks_;
+    }
+
+
+    /**
+     * Returns the number of partially received messages dropped to stay within CommBusChannelConfig::maxIncoming.
+     */
+    [[nodiscard]]
+    std::size_t evictedMessages() const {
+        guard_type lock(mutex_);
+        return evictedMessages_;
+    }
+};
+
+#else
+#error "comm_bus_channel.hpp requires the MSFS 2024 SDK (CommBus is not available in earlier SDK versions)."
+#endif // MSFS_2024_SDK
+
+} // namespace SimConnect
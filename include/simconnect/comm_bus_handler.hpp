@@ -169,6 +169,7 @@ public:
     /**
      * Broadcasts a CommBus event with a string payload.
      *
+     * @note The payload is sent as-is, in a single broadcast. Use a CommBusChannel to stream large payloads in chunks.
      * @param eventName The CommBus event name to broadcast.
      * @param data The payload to send.
      * @param broadcastTo The target platform(s) to broadcast the event to. Defaults to CommBusBroadcastTo::defaultFlag (JS + WASM + other SimConnect clients).
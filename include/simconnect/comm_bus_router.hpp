@@ -0,0 +1,380 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/comm_bus_handler.hpp>
+#include <simconnect/messaging/registration.hpp>
+#include <simconnect/requests/request.hpp>
+
+
+namespace SimConnect {
+
+
+#if MSFS_2024_SDK
+
+/**
+ * A character trie of topic patterns. A pattern is either an exact CommBus event name, or a prefix followed by
+ * a single trailing '*', which matches every event name starting with that prefix. A lone "*" matches everything.
+ */
+class CommBusTopicTrie {
+public:
+    using subscriber_id_type = std::uint32_t;
+
+
+private:
+    static constexpr std::size_t noNode{ static_cast<std::size_t>(-1) };
+
+    struct Node {
+        std::vector<std::pair<char, std::size_t>> children;
+        std::vector<subscriber_id_type> exact;     ///< Subscribers for the name ending at this node.
+        std::vector<subscriber_id_type> prefix;    ///< Subscribers for all names passing through this node.
+    };
+
+    std::vector<Node> nodes_{ 1 };
+
+
+    std::size_t nodeFor(std::string_view path, bool create) {
+        std::size_t node{ 0 };
+        for (const char c : path) {
+            auto& children = nodes_[node].children;
+            auto it = std::find_if(children.begin(), children.end(), [c](const auto& child) { return child.first == c; });
+            if (it != children.end()) {
+                node = it->second;
+            } else if (create) {
+                const auto next = nodes_.size();
+                children.emplace_back(c, next);
+                nodes_.emplace_back();
+                node = next;
+            } else {
+                return noNode;
+            }
+        }
+        return node;
+    }
+
+
+public:
+
+    /**
+     * Returns true if the pattern is a prefix pattern, that is, ends in a '*'.
+     */
+    [[nodiscard]]
+    static constexpr bool isPrefixPattern(std::string_view pattern) noexcept {
+        return !pattern.empty() && pattern.back() == '*';
+    }
+
+
+    /**
+     * Adds a subscriber for the given pattern.
+     *
+     * @param pattern The exact event name or prefix pattern.
+     * @param id The subscriber ID.
+     */
+    void insert(std::string_view pattern, subscriber_id_type id) {
+        if (isPrefixPattern(pattern)) {
+            nodes_[nodeFor(pattern.substr(0, pattern.size() - 1), true)].prefix.push_back(id);
+        } else {
+            nodes_[nodeFor(pattern, true)].exact.push_back(id);
+        }
+    }
+
+
+    /**
+     * Removes a subscriber for the given pattern. Unknown subscribers are ignored.
+     *
+     * @param pattern The exact event name or prefix pattern the subscriber was added with.
+     * @param id The subscriber ID.
+     */
+    void erase(std::string_view pattern, subscriber_id_type id) {
+        const bool prefix = isPrefixPattern(pattern);
+        const auto node = nodeFor(prefix ? pattern.substr(0, pattern.size() - 1) : pattern, false);
+        if (node != noNode) {
+            std::erase(prefix ? nodes_[node].prefix : nodes_[node].exact, id);
+        }
+    }
+
+
+    /**
+     * Collects the subscribers whose pattern matches the given event name, in ascending ID order.
+     *
+     * @param name The event name.
+     * @param out The vector to append the matching subscriber IDs to.
+     */
+    void match(std::string_view name, std::vector<subscriber_id_type>& out) const {
+        const auto start = out.size();
+        std::size_t node{ 0 };
+        out.insert(out.end(), nodes_[node].prefix.begin(), nodes_[node].prefix.end());
+        for (const char c : name) {
+            const auto& children = nodes_[node].children;
+            auto it = std::find_if(children.begin(), children.end(), [c](const auto& child) { return child.first == c; });
+            if (it == children.end()) {
+                node = noNode;
+                break;
+            }
+            node = it->second;
+            out.insert(out.end(), nodes_[node].prefix.begin(), nodes_[node].prefix.end());
+        }
+        if (node != noNode) {
+            out.insert(out.end(), nodes_[node].exact.begin(), nodes_[node].exact.end());
+        }
+        std::sort(out.begin() + static_cast<std::ptrdiff_t>(start), out.end());
+    }
+};
+
+
+/**
+ * The CommBusRouter multiplexes CommBus events to any number of in-process subscribers. It holds a single
+ * CommBusHandler subscription per event name, so each broadcast is received and reassembled once, and then
+ * handed to every subscriber whose topic pattern matches.
+ *
+ * Topic patterns are matched with a CommBusTopicTrie. The list of subscribers for each event name is recomputed
+ * whenever subscriptions change, so delivering a message is a lookup of a precomputed list.
+ *
+ * @note CommBus has no wildcard subscriptions of its own, so prefix patterns only match event names the router
+ * already receives, either through an exact subscription or through listen().
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ */
+template <class M>
+class CommBusRouter
+{
+public:
+    using comm_bus_handler_type = CommBusHandler<M>;
+    using connection_type = typename M::connection_type;
+    using mutex_type = typename connection_type::mutex_type;
+    using guard_type = typename connection_type::guard_type;
+    using subscriber_id_type = CommBusTopicTrie::subscriber_id_type;
+    using registration_type = Registration<subscriber_id_type>;
+    using handler_type = std::function<void(std::string_view eventName, std::string_view payload)>;
+
+
+private:
+    using handler_list = std::vector<handler_type>;
+
+    struct Topic {
+        std::string name;
+        std::shared_ptr<const handler_list> handlers;
+        std::size_t exactCount{ 0 };
+        Request subscription;
+    };
+
+    struct Subscriber {
+        std::string pattern;
+        handler_type handler;
+    };
+
+    comm_bus_handler_type& commBusHandler_;
+
+    mutable mutex_type mutex_;
+    CommBusTopicTrie trie_;
+    subscriber_id_type nextId_{ 1 };
+    std::map<subscriber_id_type, Subscriber> subscribers_;
+    std::map<std::string, std::shared_ptr<Topic>, std::less<>> topics_;
+    std::vector<subscriber_id_type> matches_;
+
+
+    // No copies or moves
+    CommBusRouter(const CommBusRouter&) = delete;
+    CommBusRouter(CommBusRouter&&) = delete;
+    CommBusRouter& operator=(const CommBusRouter&) = delete;
+    CommBusRouter& operator=(CommBusRouter&&) = delete;
+
+
+    /**
+     * Recomputes the handler list of a single topic. Requires the mutex to be held.
+     */
+    void rebuild(Topic& topic) {
+        matches_.clear();
+        trie_.match(topic.name, matches_);
+
+        auto handlers = std::make_shared<handler_list>();
+        handlers->reserve(matches_.size());
+        for (const auto id : matches_) {
+            const auto& handler = subscribers_.at(id).handler;
+            if (handler) {
+                handlers->push_back(handler);
+            }
+        }
+        topic.handlers = std::move(handlers);
+    }
+
+
+    /**
+     * Hands a received payload to the topic's subscribers, without holding the lock while calling them.
+     */
+    void deliver(const std::shared_ptr<Topic>& topic, std::string_view payload) {
+        std::shared_ptr<const handler_list> handlers;
+        {
+            guard_type lock(mutex_);
+            handlers = topic->handlers;
+        }
+        for (const auto& handler : *handlers) {
+            handler(topic->name, payload);
+        }
+    }
+
+
+    void unsubscribe(subscriber_id_type id) {
+        Request subscription;
+        {
+            guard_type lock(mutex_);
+            auto it = subscribers_.find(id);
+            if (it == subscribers_.end()) {
+                return;
+            }
+            const auto pattern = std::move(it->second.pattern);
+            subscribers_.erase(it);
+            trie_.erase(pattern, id);
+
+            if (!CommBusTopicTrie::isPrefixPattern(pattern)) {
+                auto topicIt = topics_.find(pattern);
+                if (topicIt != topics_.end() && --topicIt->second->exactCount == 0) {
+                    subscription = std::move(topicIt->second->subscription);
+                    topics_.erase(topicIt);
+                }
+            }
+            for (auto& [name, topic] : topics_) {
+                rebuild(*topic);
+            }
+        }
+        subscription.stop();
+    }
+
+
+public:
+    CommBusRouter(comm_bus_handler_type& commBusHandler) : commBusHandler_(commBusHandler) {}
+
+    /**
+     * Unsubscribes from every event the router still receives, so no message is delivered to it after destruction.
+     */
+    ~CommBusRouter() {
+        std::vector<Request> subscriptions;
+        {
+            guard_type lock(mutex_);
+            subscriptions.reserve(topics_.size());
+            for (auto& [name, topic] : topics_) {
+                subscriptions.push_back(std::move(topic->subscription));
+            }
+            topics_.clear();
+        }
+        for (auto& subscription : subscriptions) {
+            subscription.stop();
+        }
+    }
+
+
+    /**
+     * Subscribes to all CommBus events matching the pattern. An exact event name makes sure the router
+     * receives that event, subscribing to it at the simulator if this is its first subscriber.
+     *
+     * @param pattern An exact event name, or a prefix followed by '*'.
+     * @param handler The handler to call with the event name and the fully reassembled payload.
+     * @returns A registration that removes the subscriber when stopped or destroyed, and unsubscribes from the
+     *          simulator if it was the last exact subscriber for its event.
+     */
+    [[nodiscard]]
+    registration_type subscribe(std::string_view pattern, handler_type handler) {
+        const bool prefix = CommBusTopicTrie::isPrefixPattern(pattern);
+        std::shared_ptr<Topic> newTopic;
+        subscriber_id_type id{ 0 };
+        {
+            guard_type lock(mutex_);
+            id = nextId_++;
+            subscribers_.emplace(id, Subscriber{ std::string(pattern), std::move(handler) });
+            trie_.insert(pattern, id);
+
+            if (!prefix) {
+                auto it = topics_.find(pattern);
+                if (it == topics_.end()) {
+                    newTopic = std::make_shared<Topic>();
+                    newTopic->name = pattern;
+                    it = topics_.emplace(newTopic->name, newTopic).first;
+                }
+                ++it->second->exactCount;
+            }
+            for (auto& [name, topic] : topics_) {
+                rebuild(*topic);
+            }
+        }
+        if (newTopic) {
+            // The topic owns the subscription, so the handler must not keep the topic alive.
+            auto subscription = commBusHandler_.subscribeToEvent(newTopic->name,
+                [this, weakTopic = std::weak_ptr<Topic>(newTopic)](std::string_view payload) {
+                    if (auto topic = weakTopic.lock()) {
+                        deliver(topic, payload);
+                    }
+                });
+            guard_type lock(mutex_);
+            auto it = topics_.find(newTopic->name);
+            if (it != topics_.end() && it->second == newTopic) {
+                newTopic->subscription = std::move(subscription);
+            }
+            // Otherwise the last exact subscriber left while we were subscribing, and 'subscription' unsubscribes again here.
+        }
+        return registration_type(id, [this, id]() { unsubscribe(id); });
+    }
+
+
+    /**
+     * Makes the router receive the given event without adding a handler of its own, so that prefix
+     * subscribers can pick it up.
+     *
+     * @param eventName The exact event name.
+     * @returns A registration that stops listening when stopped or destroyed.
+     */
+    [[nodiscard]]
+    registration_type listen(std::string_view eventName) {
+        return subscribe(eventName, nullptr);
+    }
+
+
+    /**
+     * Returns the number of simulator-side CommBus subscriptions held by the router.
+     */
+    [[nodiscard]]
+    std::size_t topicCount() const {
+        guard_type lock(mutex_);
+        return topics_.size();
+    }
+
+
+    /**
+     * Returns the number of in-process subscribers, including listen() registrations.
+     */
+    [[nodiscard]]
+    std::size_t subscriberCount() const {
+        guard_type lock(mutex_);
+        return subscribers_.size();
+    }
+};
+
+#else
+#error "comm_bus_router.hpp requires the MSFS 2024 SDK (CommBus is not available in earlier SDK versions)."
+#endif // MSFS_2024_SDK
+
+} // namespace SimConnect
@@ -0,0 +1,357 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/util/mpsc_queue.hpp>
+#include <simconnect/util/scope_exit.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * The outcome of a queued command, filled in by the thread that executed it.
+ */
+class CommandCompletion {
+    std::atomic<bool> done_{ false };
+    long result_{ 0 };
+    SendId sendId_{ noId };
+    std::exception_ptr exception_;
+
+    template <class C> friend class CommandQueue;
+
+
+    void complete(long result, SendId sendId) noexcept {
+        result_ = result;
+        sendId_ = sendId;
+        done_.store(true, std::memory_order_release);
+        done_.notify_all();
+    }
+
+
+    void completeWithException(long result, std::exception_ptr exception) noexcept {
+        exception_ = std::move(exception);
+        complete(result, noId);
+    }
+
+
+public:
+    /**
+     * Returns true once the command has been executed.
+     */
+    [[nodiscard]]
+    bool ready() const noexcept { return done_.load(std::memory_order_acquire); }
+
+
+    /**
+     * Blocks until the command has been executed.
+     */
+    void wait() const noexcept { done_.wait(false, std::memory_order_acquire); }
+
+
+    /**
+     * Returns the connection's state after the command, which is the HRESULT of its last SimConnect call.
+     *
+     * @pre ready() returns true.
+     */
+    [[nodiscard]]
+    long result() const noexcept { return result_; }
+
+
+    /**
+     * Returns true if the command's SimConnect call failed, or the command threw an exception.
+     *
+     * @pre ready() returns true.
+     */
+    [[nodiscard]]
+    bool failed() const noexcept { return (result_ < 0) || exception_; }
+
+
+    /**
+     * Returns the exception the command threw, or an empty pointer if it did not throw.
+     *
+     * @pre ready() returns true.
+     */
+    [[nodiscard]]
+    std::exception_ptr exception() const noexcept { return exception_; }
+
+
+    /**
+     * Returns the SendId of the command's last SimConnect call, or noId if it failed.
+     *
+     * @pre ready() returns true.
+     */
+    [[nodiscard]]
+    SendId sendId() const noexcept { return sendId_; }
+};
+
+
+/**
+ * Configuration for a CommandQueue.
+ */
+struct CommandQueueConfig {
+    std::size_t capacity{ 1024 };           ///< The maximum number of queued commands, rounded up to a power of two.
+    std::function<void()> onSubmit{};       ///< Called after each accepted command, e.g. to wake up the owner thread.
+};
+
+
+/**
+ * Counters describing a CommandQueue. All durations are from submission to the start of execution.
+ */
+struct CommandQueueStats {
+    std::size_t submitted{ 0 };
+    std::size_t rejected{ 0 };              ///< Commands refused because the queue was full.
+    std::size_t executed{ 0 };
+    std::size_t failed{ 0 };                ///< Executed commands that left the connection in a failed state.
+    std::size_t depth{ 0 };                 ///< The approximate number of commands waiting now.
+    std::size_t maxDepth{ 0 };
+    std::chrono::nanoseconds totalLatency{ 0 };
+    std::chrono::nanoseconds maxLatency{ 0 };
+
+
+    /**
+     * Returns the average queueing latency of the executed commands.
+     */
+    [[nodiscard]]
+    std::chrono::nanoseconds averageLatency() const noexcept {
+        return (executed == 0) ? std::chrono::nanoseconds{ 0 } : (totalLatency / static_cast<std::chrono::nanoseconds::rep>(executed));
+    }
+};
+
+
+/**
+ * A lock-free queue of SimConnect operations, executed by a single owner thread.
+ *
+ * Producer threads submit commands, which are callables that make one or more calls on the connection with their
+ * arguments already captured. Submitting never blocks: if the queue is full the command is refused and the producer
+ * decides what to do. The owner thread, usually the one that also dispatches messages, calls drain() to execute the
+ * queued commands in order, so it is the only thread using the connection's handle and the connection's lock is never
+ * contended.
+ *
+ * A typical owner loop:
+ * @code
+ * while (connection.isOpen()) {
+ *     handler.handleFor(10ms);
+ *     commands.drain();
+ * }
+ * @endcode
+ *
+ * @tparam C The connection type.
+ */
+template <class C>
+class CommandQueue {
+public:
+    using connection_type = C;
+    using operation_type = std::function<void(C&)>;
+    using clock_type = std::chrono::steady_clock;
+
+
+private:
+    struct Command {
+        operation_type operation;
+        clock_type::time_point submitted;
+        std::shared_ptr<CommandCompletion> completion;
+    };
+
+    C& connection_;
+    MpscQueue<Command> queue_;
+    std::function<void()> onSubmit_;
+    std::atomic_flag draining_;
+
+    std::atomic<std::size_t> submitted_{ 0 };
+    std::atomic<std::size_t> rejected_{ 0 };
+    std::atomic<std::size_t> maxDepth_{ 0 };
+    std::atomic<std::size_t> executed_{ 0 };
+    std::atomic<std::size_t> failed_{ 0 };
+    std::atomic<std::int64_t> totalLatency_{ 0 };
+    std::atomic<std::int64_t> maxLatency_{ 0 };
+
+
+    bool push(operation_type&& operation, std::shared_ptr<CommandCompletion> completion) {
+        Command command{ std::move(operation), clock_type::now(), std::move(completion) };
+        if (!queue_.tryPush(command)) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+
+        const auto depth = queue_.sizeApprox();
+        auto max = maxDepth_.load(std::memory_order_relaxed);
+        while (depth > max && !maxDepth_.compare_exchange_weak(max, depth, std::memory_order_relaxed)) {
+        }
+        if (onSubmit_) {
+            onSubmit_();
+        }
+        return true;
+    }
+
+
+public:
+    CommandQueue(C& connection, CommandQueueConfig config = {})
+        : connection_(connection), queue_(config.capacity), onSubmit_(std::move(config.onSubmit))
+    {
+    }
+
+    // No copies or moves
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue(CommandQueue&&) = delete;
+    CommandQueue& operator=(const CommandQueue&) = delete;
+    CommandQueue& operator=(CommandQueue&&) = delete;
+    ~CommandQueue() = default;
+
+
+    /**
+     * Returns the connection the commands are executed on.
+     */
+    [[nodiscard]]
+    C& connection() noexcept { return connection_; }
+
+
+    /**
+     * Queues a command without a way to see its outcome. Safe to call from any thread.
+     *
+     * @param operation The operation to execute on the connection.
+     * @returns false if the queue is full.
+     */
+    bool submit(operation_type operation) {
+        return push(std::move(operation), nullptr);
+    }
+
+
+    /**
+     * Queues a command and returns a completion that receives its result and SendId. Safe to call from any thread.
+     *
+     * @param operation The operation to execute on the connection.
+     * @returns The completion, or an empty pointer if the queue is full.
+     */
+    [[nodiscard]]
+    std::shared_ptr<CommandCompletion> submitWithCompletion(operation_type operation) {
+        auto completion = std::make_shared<CommandCompletion>();
+        if (!push(std::move(operation), completion)) {
+            return {};
+        }
+        return completion;
+    }
+
+
+    /**
+     * Executes queued commands, in the order they were submitted. Must only be called from the owner thread; a
+     * concurrent call from another thread returns immediately.
+     *
+     * If a command throws, the exception is stored in its completion and draining continues with the next command.
+     * A command submitted without a completion has nowhere to report to, so its exception is rethrown from drain()
+     * after the counters are updated. The remaining commands stay queued for the next call.
+     *
+     * @param maxCommands The maximum number of commands to execute.
+     * @returns The number of commands executed.
+     */
+    std::size_t drain(std::size_t maxCommands = std::numeric_limits<std::size_t>::max()) {
+        if (draining_.test_and_set(std::memory_order_acquire)) {
+            return 0;
+        }
+        std::size_t count{ 0 };
+        std::int64_t latencySum{ 0 };
+        std::int64_t latencyMax{ 0 };
+        std::size_t failures{ 0 };
+
+        ScopeExit done([&]() {
+            executed_.fetch_add(count, std::memory_order_relaxed);
+            failed_.fetch_add(failures, std::memory_order_relaxed);
+            totalLatency_.fetch_add(latencySum, std::memory_order_relaxed);
+            if (latencyMax > maxLatency_.load(std::memory_order_relaxed)) {
+                maxLatency_.store(latencyMax, std::memory_order_relaxed);
+            }
+            draining_.clear(std::memory_order_release);
+        });
+
+        while (count < maxCommands) {
+            auto command = queue_.tryPop();
+            if (!command) {
+                break;
+            }
+            const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - command->submitted).count();
+            latencySum += latency;
+            latencyMax = std::max(latencyMax, latency);
+
+            ++count;
+            connection_.resetState();
+            try {
+                command->operation(connection_);
+            }
+            catch (...) {
+                ++failures;
+                if (!command->completion) {
+                    throw;
+                }
+                command->completion->completeWithException(connection_.state(), std::current_exception());
+                continue;
+            }
+            if (connection_.failed()) {
+                ++failures;
+            }
+            if (command->completion) {
+                command->completion->complete(connection_.state(), connection_.fetchSendId());
+            }
+        }
+        return count;
+    }
+
+
+    /**
+     * Returns the approximate number of commands waiting to be executed.
+     */
+    [[nodiscard]]
+    std::size_t depth() const noexcept { return queue_.sizeApprox(); }
+
+
+    /**
+     * Returns the maximum number of commands that can wait at the same time.
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept { return queue_.capacity(); }
+
+
+    /**
+     * Returns a snapshot of the queue's counters. Safe to call from any thread.
+     */
+    [[nodiscard]]
+    CommandQueueStats stats() const noexcept {
+        return CommandQueueStats{
+            .submitted = submitted_.load(std::memory_order_relaxed),
+            .rejected = rejected_.load(std::memory_order_relaxed),
+            .executed = executed_.load(std::memory_order_relaxed),
+            .failed = failed_.load(std::memory_order_relaxed),
+            .depth = queue_.sizeApprox(),
+            .maxDepth = maxDepth_.load(std::memory_order_relaxed),
+            .totalLatency = std::chrono::nanoseconds{ totalLatency_.load(std::memory_order_relaxed) },
+            .maxLatency = std::chrono::nanoseconds{ maxLatency_.load(std::memory_order_relaxed) },
+        };
+    }
+};
+
+} // namespace SimConnect
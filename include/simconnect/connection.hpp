@@ -21,22 +21,28 @@
 #include <simconnect/simconnect_error.hpp>
 
 #include <simconnect/events/events.hpp>
+#include <simconnect/events/key_events.hpp>
 #include <simconnect/events/notification_group.hpp>
 #include <simconnect/requests/requests.hpp>
 
 #include <simconnect/data/client_data_definitions.hpp>
 #include <simconnect/data/data_definitions.hpp>
 #include <simconnect/data/init_position.hpp>
+#include <simconnect/connection_metrics.hpp>
 #include <simconnect/data_frequency.hpp>
+#include <simconnect/registration_batch.hpp>
+#include <simconnect/send_history.hpp>
 
 #include <simconnect/util/null_logger.hpp>
 #include <simconnect/util/statefull_object.hpp>
 
+#include <bitset>
 #include <map>
-#include <set>
 #include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <type_traits>
 #include <mutex>
@@ -73,6 +79,32 @@ public:
 class Nothing
 { };
 
+/// The set of mapped client event IDs. Key Event catalog IDs are tracked in a bitset, all others in a hash set.
+class MappedEventSet
+{
+    std::bitset<KeyEvents::count> keyEvents_;
+    std::unordered_set<EventId> others_;
+
+public:
+    [[nodiscard]]
+    bool contains(EventId id) const {
+        return KeyEvents::contains(id) ? keyEvents_.test(KeyEvents::indexOf(id)) : others_.contains(id);
+    }
+
+    void insert(EventId id) {
+        if (KeyEvents::contains(id)) {
+            keyEvents_.set(KeyEvents::indexOf(id));
+        } else {
+            others_.insert(id);
+        }
+    }
+
+    void clear() noexcept {
+        keyEvents_.reset();
+        others_.clear();
+    }
+};
+
 
 /**
  * A SimConnect connection.
@@ -81,8 +113,9 @@ class Nothing
  * @tparam ThreadSafe Whether to make the connection thread-safe.
  * @tparam L The logger type.
  * @tparam TrackMappedEvents Whether to track mapped events to prevent duplicate event mappings.
+ * @tparam Metrics Whether to keep ConnectionMetrics. When false, no metrics code is compiled in at all.
  */
-template <class Derived, bool ThreadSafe = false, class L = NullLogger, bool TrackMappedEvents = true>
+template <class Derived, bool ThreadSafe = false, class L = NullLogger, bool TrackMappedEvents = true, bool Metrics = false>
 class Connection : public StateFullObject
 {
 public:
@@ -91,7 +124,8 @@ public:
     using guard_type = std::conditional_t<ThreadSafe, std::lock_guard<mutex_type>, NoGuard>;
     using lock_type = std::conditional_t<ThreadSafe, std::unique_lock<mutex_type>, NoGuard>;
     using cv_type = std::conditional_t<ThreadSafe, std::condition_variable, Nothing>;
-    using mappedevents_set = std::conditional_t<TrackMappedEvents, std::set<EventId>, Nothing>;
+    using mappedevents_set = std::conditional_t<TrackMappedEvents, MappedEventSet, Nothing>;
+    using metrics_type = std::conditional_t<Metrics, ConnectionMetrics, Nothing>;
 
 
     /**
@@ -115,7 +149,9 @@ private:
     cv_type dispatchCv_;                                ///< The condition variable for dispatch waiting.
 
     mappedevents_set mappedEvents_;                     ///< The set of mapped event IDs.
-    std::map<EventId, std::string> eventRegistry_;      ///< Per-connection registry of event IDs to names.
+    std::unordered_map<EventId, std::string> eventRegistry_;    ///< Per-connection registry of event IDs to names, for names not in the Key Event catalog.
+    SendHistory sendHistory_;                           ///< The most recently sent calls, for resolving exceptions.
+    metrics_type metrics_;                              ///< The connection's metrics, if enabled.
 
 
 protected:
@@ -211,6 +247,43 @@ protected:
     }
 
 
+    /**
+     * Fetch the send ID of the last sent packet, and record it with the call's details in the send history.
+     *
+     * @pre The mutex must be locked.
+     * @param operation The SimConnect function called, as a string literal.
+     * @param id The main ID argument, or unused.
+     * @param name The main name argument, if any.
+     * @param requestId The request ID, or unused.
+     * @returns The send ID of the last sent packet.
+     */
+    SendId fetchSendIdInternal(const char* operation, unsigned long id = unused, std::string_view name = {},
+                               unsigned long requestId = unused) {
+        const auto sendId = fetchSendIdInternal();
+        sendHistory_.record(sendId, operation, id, name, requestId);
+        if constexpr (Metrics) {
+            metrics_.callSent();
+        }
+        return sendId;
+    }
+
+
+    /**
+     * Sets the state, counting failed calls if metrics are enabled.
+     *
+     * @param state The new state, usually the HRESULT of a SimConnect call.
+     * @returns The new state.
+     */
+    long state(long state) noexcept {
+        if constexpr (Metrics) {
+            if (state < 0) {
+                metrics_.callFailed();
+            }
+        }
+        return StateFullObject::state(state);
+    }
+
+
     /**
 	 * Assure we close the connection to SimConnect cleanly.
 	 */
@@ -229,6 +302,9 @@ public:
 	Connection& operator=(const Connection&) = delete;
 	Connection& operator=(Connection&&) = delete;
 
+    /// The state getter stays public; only setting it goes through the protected overload above.
+    using StateFullObject::state;
+
 
 #pragma region General
 
@@ -255,6 +331,38 @@ public:
 	}
 
 
+    /**
+     * Returns the history of recently sent calls, which an exception handler can use to find the call that failed:
+     * @code
+     * if (auto call = connection.sendHistory().find(msg)) {
+     *     logger.error("Exception {} caused by {}", msg.dwException, call->describe());
+     * }
+     * @endcode
+     *
+     * @returns The send history.
+     */
+    [[nodiscard]]
+    SendHistory& sendHistory() noexcept { return sendHistory_; }
+
+    [[nodiscard]]
+    const SendHistory& sendHistory() const noexcept { return sendHistory_; }
+
+
+    /**
+     * Returns the connection's metrics. Render them with PrometheusWriter:
+     * @code
+     * PrometheusWriter::writeFile(connection.metrics().registry(), "simconnect.prom");
+     * @endcode
+     *
+     * @returns The metrics.
+     */
+    [[nodiscard]]
+    ConnectionMetrics& metrics() noexcept requires(Metrics) { return metrics_; }
+
+    [[nodiscard]]
+    const ConnectionMetrics& metrics() const noexcept requires(Metrics) { return metrics_; }
+
+
     /**
      * Request IDs are managed by the Requests class.
      * 
@@ -288,7 +396,9 @@ public:
             notifyDispatchers();
 
             // Clear all mapped event flags to allow re-mapping on reconnect
-            mappedEvents_.clear();
+            if constexpr (TrackMappedEvents) {
+                mappedEvents_.clear();
+            }
             eventRegistry_.clear();
 		}
         return *static_cast<Derived*>(this);
@@ -306,11 +416,12 @@ public:
 	bool getNextDispatch(Messages::MsgBase*& msgPtr, unsigned long& size) {
         guard_type guard(mutex_);
 
+        // An empty queue is not a failed call, so this bypasses the failure count.
         if (!isOpen()) {
-            state(E_FAIL);
+            StateFullObject::state(E_FAIL);
             return false;
         }
-		state(SimConnect_GetNextDispatch(hSimConnect_, &msgPtr, &size));
+		StateFullObject::state(SimConnect_GetNextDispatch(hSimConnect_, &msgPtr, &size));
 
 		return succeeded();
 	}
@@ -370,7 +481,7 @@ public:
         state(SimConnect_RequestSystemState(hSimConnect_, requestId, stateName.c_str()));
 
         if (succeeded()) {
-            logger_.debug("Requested system state '{}' (requestId={}, sendId={})", stateName, requestId, fetchSendIdInternal());
+            logger_.debug("Requested system state '{}' (requestId={}, sendId={})", stateName, requestId, fetchSendIdInternal("SimConnect_RequestSystemState", unused, stateName, requestId));
         } else {
             logger_.error("SimConnect_RequestSystemState failed with error code 0x{:08X}.", state());
         }
@@ -393,7 +504,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestSystemState failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested system state '{}' (requestId={}, sendId={})", stateName, requestId, fetchSendIdInternal());
+            logger_.debug("Requested system state '{}' (requestId={}, sendId={})", stateName, requestId, fetchSendIdInternal("SimConnect_RequestSystemState", unused, stateName, requestId));
         }
 
         return *static_cast<Derived*>(this);
@@ -417,7 +528,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetNotificationGroupPriority failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Set notification group {} priority to {} (sendId={})", groupId, priority, fetchSendIdInternal());
+            logger_.debug("Set notification group {} priority to {} (sendId={})", groupId, priority, fetchSendIdInternal("SimConnect_SetNotificationGroupPriority", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -438,7 +549,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AddClientEventToNotificationGroup failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Added event '{}' to notification group {} (maskable={}, sendId={})", evt.name(), groupId, maskable, fetchSendIdInternal());
+            logger_.debug("Added event '{}' to notification group {} (maskable={}, sendId={})", evt.name(), groupId, maskable, fetchSendIdInternal("SimConnect_AddClientEventToNotificationGroup", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -458,7 +569,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RemoveClientEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Removed event '{}' from notification group {} (sendId={})", evt.name(), groupId, fetchSendIdInternal());
+            logger_.debug("Removed event '{}' from notification group {} (sendId={})", evt.name(), groupId, fetchSendIdInternal("SimConnect_RemoveClientEvent", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -477,7 +588,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_ClearNotificationGroup failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Cleared notification group {} (sendId={})", groupId, fetchSendIdInternal());
+            logger_.debug("Cleared notification group {} (sendId={})", groupId, fetchSendIdInternal("SimConnect_ClearNotificationGroup", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -496,7 +607,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestNotificationGroup failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested notification group {} (sendId={})", groupId, fetchSendIdInternal());
+            logger_.debug("Requested notification group {} (sendId={})", groupId, fetchSendIdInternal("SimConnect_RequestNotificationGroup", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -507,8 +618,18 @@ public:
 
 
 public:
+    /**
+     * Returns the client event for a name. Names in the KeyEvents catalog always get their fixed ID, without touching
+     * the registry; other names get a newly allocated ID.
+     *
+     * @param name The name of the event.
+     * @returns The event.
+     */
     [[nodiscard]]
     SimConnect::event event(std::string_view name) {
+        if (const auto keyEventId = KeyEvents::find(name)) {
+            return SimConnect::event(*keyEventId, name, SimConnect::event::Key{});
+        }
         auto id = SimConnect::event::Key::allocate();
         guard_type guard(mutex_);
         eventRegistry_.emplace(id, std::string(name));
@@ -517,6 +638,9 @@ public:
 
     [[nodiscard]]
     std::string eventName(EventId id) const {
+        if (KeyEvents::contains(id)) {
+            return std::string(KeyEvents::name(id));
+        }
         auto it = eventRegistry_.find(id);
         return it != eventRegistry_.end() ? it->second : std::string{};
     }
@@ -545,7 +669,7 @@ public:
             if constexpr (TrackMappedEvents) {
                 mappedEvents_.insert(evt.id());
             }
-            logger_.debug("Mapped client event ID {} to sim event '{}' (sendId={})", evt.id(), evt.name(), fetchSendIdInternal());
+            logger_.debug("Mapped client event ID {} to sim event '{}' (sendId={})", evt.id(), evt.name(), fetchSendIdInternal("SimConnect_MapClientEventToSimEvent", evt.id(), evt.name()));
         } else {
             logger_.error("SimConnect_MapClientEventToSimEvent failed with error code 0x{:08X}.", state());
         }
@@ -571,7 +695,7 @@ public:
             logger_.error("SimConnect_TransmitClientEvent failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Transmitted client event '{}' to object {} in group {} with data {} (sendId={})",
-                evt.name(), objectId, groupId, data, fetchSendIdInternal());
+                evt.name(), objectId, groupId, data, fetchSendIdInternal("SimConnect_TransmitClientEvent", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -594,7 +718,7 @@ public:
             logger_.error("SimConnect_TransmitClientEvent failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Transmitted client event '{}' to object {} with priority {} and data {} (sendId={})",
-                evt.name(), objectId, priority, data, fetchSendIdInternal());
+                evt.name(), objectId, priority, data, fetchSendIdInternal("SimConnect_TransmitClientEvent", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -621,7 +745,7 @@ public:
             logger_.error("SimConnect_TransmitClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Transmitted client event '{}' to object {} in group {} with data [{}, {}, {}, {}, {}] (sendId={})",
-                evt.name(), objectId, groupId, data0, data1, data2, data3, data4, fetchSendIdInternal());
+                evt.name(), objectId, groupId, data0, data1, data2, data3, data4, fetchSendIdInternal("SimConnect_TransmitClientEvent_EX1", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -648,7 +772,7 @@ public:
             logger_.error("SimConnect_TransmitClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Transmitted client event '{}' to object {} with priority {} and data [{}, {}, {}, {}, {}] (sendId={})",
-                evt.name(), objectId, priority, data0, data1, data2, data3, data4, fetchSendIdInternal());
+                evt.name(), objectId, priority, data0, data1, data2, data3, data4, fetchSendIdInternal("SimConnect_TransmitClientEvent_EX1", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -669,7 +793,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SubscribeToSystemEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Subscribed to system event '{}' (sendId={})", evt.name(), fetchSendIdInternal());
+            logger_.debug("Subscribed to system event '{}' (sendId={})", evt.name(), fetchSendIdInternal("SimConnect_SubscribeToSystemEvent", evt.id(), evt.name()));
         }
         return static_cast<Derived&>(*this);
 	}
@@ -687,7 +811,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_UnsubscribeFromSystemEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Unsubscribed from system event '{}' (sendId={})", evt.name(), fetchSendIdInternal());
+            logger_.debug("Unsubscribed from system event '{}' (sendId={})", evt.name(), fetchSendIdInternal("SimConnect_UnsubscribeFromSystemEvent", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -707,7 +831,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetSystemEventState failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("{} system event '{}' (sendId={})", enabled ? "Enabled" : "Disabled", evt.name(), fetchSendIdInternal());
+            logger_.debug("{} system event '{}' (sendId={})", enabled ? "Enabled" : "Disabled", evt.name(), fetchSendIdInternal("SimConnect_SetSystemEventState", evt.id()));
         }
         return static_cast<Derived&>(*this);
     }
@@ -731,7 +855,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SubscribeToFlowEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Subscribed to flow events (sendId={})", fetchSendIdInternal());
+            logger_.debug("Subscribed to flow events (sendId={})", fetchSendIdInternal("SimConnect_SubscribeToFlowEvent"));
         }
 #else
         static_assert(dependent_false<Derived>, "subscribeToFlowEvents requires the MSFS 2024 SDK.");
@@ -754,7 +878,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_UnsubscribeToFlowEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Unsubscribed from flow events (sendId={})", fetchSendIdInternal());
+            logger_.debug("Unsubscribed from flow events (sendId={})", fetchSendIdInternal("SimConnect_UnsubscribeToFlowEvent"));
         }
 #else
         static_assert(dependent_false<Derived>, "unsubscribeFromFlowEvents requires the MSFS 2024 SDK.");
@@ -792,7 +916,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SubscribeToCommBusEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Subscribed to CommBus event '{}' (sendId={})", name, fetchSendIdInternal());
+            logger_.debug("Subscribed to CommBus event '{}' (sendId={})", name, fetchSendIdInternal("SimConnect_SubscribeToCommBusEvent", id, name));
         }
 #else
         static_assert(dependent_false<Derived>, "subscribeToCommBusEvent requires the MSFS 2024 SDK.");
@@ -817,7 +941,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_UnsubscribeToCommBusEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Unsubscribed from CommBus event ID {} (sendId={})", id, fetchSendIdInternal());
+            logger_.debug("Unsubscribed from CommBus event ID {} (sendId={})", id, fetchSendIdInternal("SimConnect_UnsubscribeToCommBusEvent", id));
         }
 #else
         static_assert(dependent_false<Derived>, "unsubscribeFromCommBusEvent requires the MSFS 2024 SDK.");
@@ -854,7 +978,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_CallCommBusEvent failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Called CommBus event '{}' with {} byte(s) of data (sendId={})", name, bufferSize, fetchSendIdInternal());
+            logger_.debug("Called CommBus event '{}' with {} byte(s) of data (sendId={})", name, bufferSize, fetchSendIdInternal("SimConnect_CallCommBusEvent", unused, name));
         }
 #else
         static_assert(dependent_false<Derived>, "callCommBusEvent requires the MSFS 2024 SDK.");
@@ -880,7 +1004,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetInputGroupPriority failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Set input group {} priority to {} (sendId={})", groupId, priority, fetchSendIdInternal());
+            logger_.debug("Set input group {} priority to {} (sendId={})", groupId, priority, fetchSendIdInternal("SimConnect_SetInputGroupPriority", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -900,7 +1024,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetInputGroupState failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Set input group {} state to {} (sendId={})", groupId, groupState, fetchSendIdInternal());
+            logger_.debug("Set input group {} state to {} (sendId={})", groupId, groupState, fetchSendIdInternal("SimConnect_SetInputGroupState", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -935,7 +1059,7 @@ public:
             logger_.error("SimConnect_MapInputEventToClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Mapped input event '{}' to client event '{}' in group {} (sendId={})",
-                inputEvent, evt.name(), groupId, fetchSendIdInternal());
+                inputEvent, evt.name(), groupId, fetchSendIdInternal("SimConnect_MapInputEventToClientEvent_EX1", evt.id(), inputEvent));
         }
         return static_cast<Derived&>(*this);
     }
@@ -960,7 +1084,7 @@ public:
             logger_.error("SimConnect_MapInputEventToClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Mapped input event '{}' to client event {} for DOWN and {} for UP, in group {} (sendId={})",
-                inputEvent, downEvent.id(), upEvent.id(), groupId, fetchSendIdInternal());
+                inputEvent, downEvent.id(), upEvent.id(), groupId, fetchSendIdInternal("SimConnect_MapInputEventToClientEvent_EX1", downEvent.id(), inputEvent));
         }
         return static_cast<Derived&>(*this);
     }
@@ -984,7 +1108,7 @@ public:
             logger_.error("SimConnect_MapInputEventToClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Mapped input event '{}' to client event {} with value {} in group {} (sendId={})",
-                inputEvent, evt.id(), value, groupId, fetchSendIdInternal());
+                inputEvent, evt.id(), value, groupId, fetchSendIdInternal("SimConnect_MapInputEventToClientEvent_EX1", evt.id(), inputEvent));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1011,7 +1135,7 @@ public:
             logger_.error("SimConnect_MapInputEventToClientEvent_EX1 failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Mapped input event '{}' to client event {} with value {} for DOWN and {} with value {} for UP, in group {} (sendId={})",
-                inputEvent, downEvent.id(), downValue, upEvent.id(), upValue, groupId, fetchSendIdInternal());
+                inputEvent, downEvent.id(), downValue, upEvent.id(), upValue, groupId, fetchSendIdInternal("SimConnect_MapInputEventToClientEvent_EX1", downEvent.id(), inputEvent));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1032,7 +1156,7 @@ public:
             logger_.error("SimConnect_RemoveInputEvent failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Removed input event '{}' from input group {} (sendId={})",
-                inputEvent, groupId, fetchSendIdInternal());
+                inputEvent, groupId, fetchSendIdInternal("SimConnect_RemoveInputEvent", groupId, inputEvent));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1051,7 +1175,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_ClearInputGroup failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Cleared input group {} (sendId={})", groupId, fetchSendIdInternal());
+            logger_.debug("Cleared input group {} (sendId={})", groupId, fetchSendIdInternal("SimConnect_ClearInputGroup", groupId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1094,7 +1218,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AddToDataDefinition failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Added to data definition {}: simVar '{}' (sendId={})", dataDef, itemName, fetchSendIdInternal());
+            logger_.debug("Added to data definition {}: simVar '{}' (sendId={})", dataDef, itemName, fetchSendIdInternal("SimConnect_AddToDataDefinition", dataDef, itemName));
         }
         return static_cast<Derived&>(*this);
 	}
@@ -1136,7 +1260,7 @@ public:
             logger_.error("SimConnect_RequestDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Requested untagged data on object {} (requestId={}, dataDef={}, sendId={})",
-                objectId, requestId, dataDef, fetchSendIdInternal());
+                objectId, requestId, dataDef, fetchSendIdInternal("SimConnect_RequestDataOnSimObject", dataDef, {}, requestId));
         }
 		return static_cast<Derived&>(*this);
 	}
@@ -1172,7 +1296,7 @@ public:
             logger_.error("SimConnect_RequestDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Requested tagged data on object {} (requestId={}, dataDef={}, sendId={})",
-                objectId, requestId, dataDef, fetchSendIdInternal());
+                objectId, requestId, dataDef, fetchSendIdInternal("SimConnect_RequestDataOnSimObject", dataDef, {}, requestId));
         }
 		return static_cast<Derived&>(*this);
     }
@@ -1201,7 +1325,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestDataOnSimObjectType failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested data by type (dataDef={}, requestId={}, radius={}, type={}, sendId={})", dataDef, requestId, radiusInMeters, static_cast<std::underlying_type_t<SimObjectType>>(objectType), fetchSendIdInternal());
+            logger_.debug("Requested data by type (dataDef={}, requestId={}, radius={}, type={}, sendId={})", dataDef, requestId, radiusInMeters, static_cast<std::underlying_type_t<SimObjectType>>(objectType), fetchSendIdInternal("SimConnect_RequestDataOnSimObjectType", dataDef, {}, requestId));
         }
         return static_cast<Derived&>(*this);
 	}
@@ -1227,7 +1351,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent data to SimObject (dataDef={}, objectId={}, size={}, sendId={})", dataDef, objectId, sizeof(T), fetchSendIdInternal());
+            logger_.debug("Sent data to SimObject (dataDef={}, objectId={}, size={}, sendId={})", dataDef, objectId, sizeof(T), fetchSendIdInternal("SimConnect_SetDataOnSimObject", dataDef));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1260,7 +1384,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent data to SimObject (dataDef={}, objectId={}, size={}, count={}, blockSize={}, sendId={})", dataDef, objectId, data.size(), count, blockSize, fetchSendIdInternal());
+            logger_.debug("Sent data to SimObject (dataDef={}, objectId={}, size={}, count={}, blockSize={}, sendId={})", dataDef, objectId, data.size(), count, blockSize, fetchSendIdInternal("SimConnect_SetDataOnSimObject", dataDef));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1293,7 +1417,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent tagged data to SimObject (dataDef={}, objectId={}, size={}, count={}, blockSize={}, sendId={})", dataDef, objectId, data.size(), count, blockSize, fetchSendIdInternal());
+            logger_.debug("Sent tagged data to SimObject (dataDef={}, objectId={}, size={}, count={}, blockSize={}, sendId={})", dataDef, objectId, data.size(), count, blockSize, fetchSendIdInternal("SimConnect_SetDataOnSimObject", dataDef));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1318,7 +1442,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestDataOnSimObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Stopped data request (dataDef={}, requestId={}, objectId={}, sendId={})", dataDef, requestId, objectId, fetchSendIdInternal());
+            logger_.debug("Stopped data request (dataDef={}, requestId={}, objectId={}, sendId={})", dataDef, requestId, objectId, fetchSendIdInternal("SimConnect_RequestDataOnSimObject", dataDef, {}, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1345,7 +1469,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_MapClientDataNameToID failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Mapped client data name '{}' to ID {} (sendId={})", name, clientDataId, fetchSendIdInternal());
+            logger_.debug("Mapped client data name '{}' to ID {} (sendId={})", name, clientDataId, fetchSendIdInternal("SimConnect_MapClientDataNameToID", clientDataId, name));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1365,7 +1489,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_CreateClientData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created {} client data with ID {} and size {} (sendId={})", isWritable ? "writable" : "read-only", clientDataId, dataSize, fetchSendIdInternal());
+            logger_.debug("Created {} client data with ID {} and size {} (sendId={})", isWritable ? "writable" : "read-only", clientDataId, dataSize, fetchSendIdInternal("SimConnect_CreateClientData", clientDataId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1403,7 +1527,7 @@ public:
             logger_.error("SimConnect_AddToClientDataDefinition failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Added to client data definition {}: offset={}, size={}, datumId={} (sendId={})",
-                defId, offset, size, itemDatumId, fetchSendIdInternal());
+                defId, offset, size, itemDatumId, fetchSendIdInternal("SimConnect_AddToClientDataDefinition", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1430,7 +1554,7 @@ public:
             logger_.error("SimConnect_AddToClientDataDefinition failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Added typed field to client data definition {}: offset={}, type={}, epsilon={}, datumId={} (sendId={})",
-                defId, offset, static_cast<DWORD>(type), epsilon, itemDatumId, fetchSendIdInternal());
+                defId, offset, static_cast<DWORD>(type), epsilon, itemDatumId, fetchSendIdInternal("SimConnect_AddToClientDataDefinition", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1449,7 +1573,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_ClearClientDataDefinition failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Cleared client data definition {} (sendId={})", defId, fetchSendIdInternal());
+            logger_.debug("Cleared client data definition {} (sendId={})", defId, fetchSendIdInternal("SimConnect_ClearClientDataDefinition", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1487,7 +1611,7 @@ public:
             logger_.error("SimConnect_RequestClientData failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Requested client data {} (defId={}, requestId={}, period={}, interval={}, sendOnlyWhenChanged={}, sendId={})",
-                clientDataId, defId, requestId, static_cast<int>(frequency.getPeriod()), static_cast<int>(frequency.getInterval()), sendOnlyWhenChanged, fetchSendIdInternal());
+                clientDataId, defId, requestId, static_cast<int>(frequency.getPeriod()), static_cast<int>(frequency.getInterval()), sendOnlyWhenChanged, fetchSendIdInternal("SimConnect_RequestClientData", defId, {}, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1537,7 +1661,7 @@ public:
             logger_.error("SimConnect_RequestClientData (tagged) failed with error code 0x{:08X}.", state());
         } else {
             logger_.debug("Requested tagged client data {} (defId={}, requestId={}, period={}, interval={}, sendOnlyWhenChanged={}, sendId={})",
-                clientDataId, defId, requestId, static_cast<int>(frequency.getPeriod()), static_cast<int>(frequency.getInterval()), sendOnlyWhenChanged, fetchSendIdInternal());
+                clientDataId, defId, requestId, static_cast<int>(frequency.getPeriod()), static_cast<int>(frequency.getInterval()), sendOnlyWhenChanged, fetchSendIdInternal("SimConnect_RequestClientData", defId, {}, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1580,7 +1704,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetClientData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, sizeof(T), fetchSendIdInternal());
+            logger_.debug("Sent data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, sizeof(T), fetchSendIdInternal("SimConnect_SetClientData", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1602,7 +1726,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetClientData (tagged) failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent tagged data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, sizeof(T), fetchSendIdInternal());
+            logger_.debug("Sent tagged data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, sizeof(T), fetchSendIdInternal("SimConnect_SetClientData", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1634,7 +1758,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetClientData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent data to client data {} (defId={}, size={}, count={}, blockSize={}, sendId={})", clientDataId, defId, data.size(), count, blockSize, fetchSendIdInternal());
+            logger_.debug("Sent data to client data {} (defId={}, size={}, count={}, blockSize={}, sendId={})", clientDataId, defId, data.size(), count, blockSize, fetchSendIdInternal("SimConnect_SetClientData", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1658,7 +1782,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_SetClientData (tagged) failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Sent tagged data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, data.size(), fetchSendIdInternal());
+            logger_.debug("Sent tagged data to client data {} (defId={}, size={}, sendId={})", clientDataId, defId, data.size(), fetchSendIdInternal("SimConnect_SetClientData", defId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1682,7 +1806,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestClientData (stop) failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Stopped client data request for client data {} (dataDef={}, requestId={}, sendId={})", clientDataId, dataDef, requestId, fetchSendIdInternal());
+            logger_.debug("Stopped client data request for client data {} (dataDef={}, requestId={}, sendId={})", clientDataId, dataDef, requestId, fetchSendIdInternal("SimConnect_RequestClientData", dataDef, {}, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1708,7 +1832,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_EnumerateSimObjectsAndLiveries failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested enumeration of SimObject titles and liveries for type {} (requestId={}, sendId={})", static_cast<std::underlying_type_t<SimObjectType>>(simObjectType), requestId, fetchSendIdInternal());
+            logger_.debug("Requested enumeration of SimObject titles and liveries for type {} (requestId={}, sendId={})", static_cast<std::underlying_type_t<SimObjectType>>(simObjectType), requestId, fetchSendIdInternal("SimConnect_EnumerateSimObjectsAndLiveries", unused, {}, requestId));
         }
 #else
         state(-1);
@@ -1739,7 +1863,7 @@ public:
             if (failed()) {
                 logger_.error("SimConnect_RequestAllFacilities failed with error code 0x{:08X}.", state());
             } else {
-                logger_.debug("Requested listing of all facilities (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal());
+                logger_.debug("Requested listing of all facilities (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal("SimConnect_RequestAllFacilities", unused, {}, requestId));
             }
 #else
             state(-1);
@@ -1752,7 +1876,7 @@ public:
             if (failed()) {
                 logger_.error("SimConnect_RequestFacilitiesList failed with error code 0x{:08X}.", state());
             } else {
-                logger_.debug("Requested listing of all facilities in cache (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal());
+                logger_.debug("Requested listing of all facilities in cache (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal("SimConnect_RequestFacilitiesList", unused, {}, requestId));
             }
             break;
 
@@ -1761,7 +1885,7 @@ public:
             if (failed()) {
                 logger_.error("SimConnect_RequestFacilitiesList_EX1 failed with error code 0x{:08X}.", state());
             } else {
-                logger_.debug("Requested listing of all facilities in bubble (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal());
+                logger_.debug("Requested listing of all facilities in bubble (type={}, requestId={}, sendId={})", static_cast<std::underlying_type_t<FacilityListType>>(type), requestId, fetchSendIdInternal("SimConnect_RequestFacilitiesList_EX1", unused, {}, requestId));
             }
             break;
         }
@@ -1782,7 +1906,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AddToFacilityDefinition failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Added field '{}' to facility definition {} (sendId={})", fieldName, facilityDefId, fetchSendIdInternal());
+            logger_.debug("Added field '{}' to facility definition {} (sendId={})", fieldName, facilityDefId, fetchSendIdInternal("SimConnect_AddToFacilityDefinition", facilityDefId, fieldName));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1803,7 +1927,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AddFacilityDataDefinitionFilter failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Added filter '{}' to facility definition {} (sendId={})", filterPath, facilityDefId, fetchSendIdInternal());
+            logger_.debug("Added filter '{}' to facility definition {} (sendId={})", filterPath, facilityDefId, fetchSendIdInternal("SimConnect_AddFacilityDataDefinitionFilter", facilityDefId, filterPath));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1823,7 +1947,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AddFacilityDataDefinitionFilter failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Removed filter '{}' from facility definition {} (sendId={})", filterPath, facilityDefId, fetchSendIdInternal());
+            logger_.debug("Removed filter '{}' from facility definition {} (sendId={})", filterPath, facilityDefId, fetchSendIdInternal("SimConnect_AddFacilityDataDefinitionFilter", facilityDefId, filterPath));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1842,7 +1966,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_ClearFacilityDataDefinitionFilters failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Cleared filters from facility definition {} (sendId={})", facilityDefId, fetchSendIdInternal());
+            logger_.debug("Cleared filters from facility definition {} (sendId={})", facilityDefId, fetchSendIdInternal("SimConnect_ClearAllFacilityDataDefinitionFilters", facilityDefId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1865,7 +1989,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestFacilityData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested facility data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal());
+            logger_.debug("Requested facility data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal("SimConnect_RequestFacilityData", facilityDefId, icaoCode, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1887,7 +2011,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestFacilityData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested VOR data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal());
+            logger_.debug("Requested VOR data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal("SimConnect_RequestFacilityData_EX1", facilityDefId, icaoCode, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1909,7 +2033,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestFacilityData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested NDB data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal());
+            logger_.debug("Requested NDB data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal("SimConnect_RequestFacilityData_EX1", facilityDefId, icaoCode, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1931,7 +2055,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestFacilityData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested Waypoints data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal());
+            logger_.debug("Requested Waypoints data for definition {} (requestId={}, sendId={})", facilityDefId, requestId, fetchSendIdInternal("SimConnect_RequestFacilityData_EX1", facilityDefId, icaoCode, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1952,7 +2076,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestJetwayData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested Jetway data for airport {}, jetway index {} (sendId={})", icaoCode, jetwayIndex, fetchSendIdInternal());
+            logger_.debug("Requested Jetway data for airport {}, jetway index {} (sendId={})", icaoCode, jetwayIndex, fetchSendIdInternal("SimConnect_RequestJetwayData", unused, icaoCode));
         }
         return static_cast<Derived&>(*this);
     }
@@ -1973,13 +2097,81 @@ public:
         if (failed()) {
             logger_.error("SimConnect_RequestJetwayData failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Requested Jetway data for airport {}, multiple jetway indices (sendId={})", icaoCode, fetchSendIdInternal());
+            logger_.debug("Requested Jetway data for airport {}, multiple jetway indices (sendId={})", icaoCode, fetchSendIdInternal("SimConnect_RequestJetwayData", unused, icaoCode));
         }
         return static_cast<Derived&>(*this);
     }
 
 #pragma endregion
 
+#pragma region Registration Batches
+
+    /**
+     * Submits the pending entries of a registration batch, taking the lock once for all of them. Each entry gets
+     * its result and SendId recorded, so exceptions can be attributed with RegistrationBatch::find().
+     * Event mappings that are already tracked as mapped are skipped, as with mapClientEvent().
+     *
+     * @param batch The batch to submit.
+     * @returns A reference to the derived connection for chaining. The state is the result of the last failed
+     *          call, or S_OK if none failed.
+     */
+    Derived& submit(RegistrationBatch& batch) {
+        guard_type guard(mutex_);
+
+        const auto pending = batch.unsubmitted();
+        const auto failedBefore = batch.failed();
+        HRESULT lastFailure{ S_OK };
+        for (auto& entry : pending) {
+            HRESULT result{ S_OK };
+            const char* operation{ nullptr };
+            switch (entry.kind) {
+            case RegistrationBatch::Kind::mapClientEvent:
+                if constexpr (TrackMappedEvents) {
+                    if (mappedEvents_.contains(entry.id)) {
+                        batch.record(S_OK, noId);
+                        continue;
+                    }
+                }
+                operation = "SimConnect_MapClientEventToSimEvent";
+                result = SimConnect_MapClientEventToSimEvent(hSimConnect_, entry.id, entry.name.c_str());
+                if constexpr (TrackMappedEvents) {
+                    if (SUCCEEDED(result)) {
+                        mappedEvents_.insert(entry.id);
+                    }
+                }
+                break;
+            case RegistrationBatch::Kind::dataDefinition:
+                operation = "SimConnect_AddToDataDefinition";
+                result = SimConnect_AddToDataDefinition(hSimConnect_, entry.id,
+                    entry.name.c_str(), entry.units.empty() ? nullptr : entry.units.c_str(),
+                    entry.dataType, entry.epsilon, entry.datumId);
+                break;
+            case RegistrationBatch::Kind::clientDataDefinition:
+                operation = "SimConnect_AddToClientDataDefinition";
+                result = SimConnect_AddToClientDataDefinition(hSimConnect_, entry.id,
+                    static_cast<DWORD>(entry.offset), entry.sizeOrType, entry.epsilon, entry.datumId);
+                break;
+            case RegistrationBatch::Kind::facilityDefinition:
+                operation = "SimConnect_AddToFacilityDefinition";
+                result = SimConnect_AddToFacilityDefinition(hSimConnect_, entry.id, entry.name.c_str());
+                break;
+            }
+            if (FAILED(result)) {
+                lastFailure = result;
+                logger_.error("{} failed with error code 0x{:08X}.", entry.describe(), result);
+                batch.record(result, noId);
+            } else {
+                batch.record(result, fetchSendIdInternal(operation, entry.id, entry.name));
+            }
+        }
+        state(lastFailure);
+        logger_.debug("Submitted {} registration(s), {} failed", pending.size(), batch.failed() - failedBefore);
+
+        return static_cast<Derived&>(*this);
+    }
+
+#pragma endregion
+
 #pragma region AI
 
     /**
@@ -2001,7 +2193,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateNonATCAircraft failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created non-ATC aircraft '{}' with tail '{}' (requestId={}, sendId={})", title, tailNumber, requestId, fetchSendIdInternal());
+            logger_.debug("Created non-ATC aircraft '{}' with tail '{}' (requestId={}, sendId={})", title, tailNumber, requestId, fetchSendIdInternal("SimConnect_AICreateNonATCAircraft", unused, title, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -2033,7 +2225,7 @@ public:
             livery,
             tailNumber,
             requestId,
-            fetchSendIdInternal());
+            fetchSendIdInternal("SimConnect_AICreateNonATCAircraft_EX1", unused, title, requestId));
         }
 #else
         state(SimConnect_AICreateNonATCAircraft(
@@ -2045,7 +2237,7 @@ public:
             title,
             tailNumber,
             requestId,
-            fetchSendIdInternal(),
+            fetchSendIdInternal("SimConnect_AICreateNonATCAircraft", unused, title, requestId),
             livery);
         }
 #endif
@@ -2070,7 +2262,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateParkedATCAircraft failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created parked aircraft '{}' with tail '{}' at '{}' (requestId={}, sendId={})", title, tailNumber, airportIcao, requestId, fetchSendIdInternal());
+            logger_.debug("Created parked aircraft '{}' with tail '{}' at '{}' (requestId={}, sendId={})", title, tailNumber, airportIcao, requestId, fetchSendIdInternal("SimConnect_AICreateParkedATCAircraft", unused, title, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -2095,7 +2287,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateParkedATCAircraft_EX1 failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created parked aircraft '{}' with livery '{}' and tail '{}' at '{}' (requestId={}, sendId={})", title, livery, tailNumber, airportIcao, requestId, fetchSendIdInternal());
+            logger_.debug("Created parked aircraft '{}' with livery '{}' and tail '{}' at '{}' (requestId={}, sendId={})", title, livery, tailNumber, airportIcao, requestId, fetchSendIdInternal("SimConnect_AICreateParkedATCAircraft_EX1", unused, title, requestId));
         }
 #else
         state(SimConnect_AICreateParkedATCAircraft(
@@ -2103,7 +2295,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateParkedATCAircraft failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created parked aircraft '{}' with livery '{}' and tail '{}' at '{}' (requestId={}, sendId={})", title, livery, tailNumber, airportIcao, requestId, fetchSendIdInternal());
+            logger_.debug("Created parked aircraft '{}' with livery '{}' and tail '{}' at '{}' (requestId={}, sendId={})", title, livery, tailNumber, airportIcao, requestId, fetchSendIdInternal("SimConnect_AICreateParkedATCAircraft", unused, title, requestId));
         }
 #endif
         return static_cast<Derived&>(*this);
@@ -2126,7 +2318,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateSimulatedObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created simulated object '{}' (requestId={}, sendId={})", title, requestId, fetchSendIdInternal());
+            logger_.debug("Created simulated object '{}' (requestId={}, sendId={})", title, requestId, fetchSendIdInternal("SimConnect_AICreateSimulatedObject", unused, title, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -2150,14 +2342,14 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AICreateSimulatedObject_EX1 failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created simulated object '{}' with livery '{}' (requestId={}, sendId={})", title, livery, requestId, fetchSendIdInternal());
+            logger_.debug("Created simulated object '{}' with livery '{}' (requestId={}, sendId={})", title, livery, requestId, fetchSendIdInternal("SimConnect_AICreateSimulatedObject_EX1", unused, title, requestId));
         }
 #else
         state(SimConnect_AICreateSimulatedObject(hSimConnect_, title.c_str(), initPos, requestId));
         if (failed()) {
             logger_.error("SimConnect_AICreateSimulatedObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Created simulated object '{}' with livery '{}' (requestId={}, sendId={})", title, livery, requestId, fetchSendIdInternal());
+            logger_.debug("Created simulated object '{}' with livery '{}' (requestId={}, sendId={})", title, livery, requestId, fetchSendIdInternal("SimConnect_AICreateSimulatedObject", unused, title, requestId));
         }
 #endif
         return static_cast<Derived&>(*this);
@@ -2179,7 +2371,7 @@ public:
         if (failed()) {
             logger_.error("SimConnect_AIRemoveObject failed with error code 0x{:08X}.", state());
         } else {
-            logger_.debug("Removed SimObject (objectId={}, requestId={}, sendId={})", objectId, requestId, fetchSendIdInternal());
+            logger_.debug("Removed SimObject (objectId={}, requestId={}, sendId={})", objectId, requestId, fetchSendIdInternal("SimConnect_AIRemoveObject", objectId, {}, requestId));
         }
         return static_cast<Derived&>(*this);
     }
@@ -0,0 +1,141 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/util/metrics.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * The metrics kept by a Connection that was instantiated with metrics enabled, and by the message handlers using it.
+ *
+ * The fixed metrics are created up front. Per message type counters are created on first use and then cached, so the
+ * dispatch path only does atomic increments.
+ */
+class ConnectionMetrics {
+    static constexpr std::size_t maxCachedMessageId{ 127 };
+
+    MetricsRegistry registry_;
+
+    MetricCounter& callsSent_;
+    MetricCounter& callsFailed_;
+    MetricCounter& bytesReceived_;
+    MetricCounter& exceptions_;
+    MetricHistogram& dispatchSeconds_;
+    std::array<std::atomic<MetricCounter*>, maxCachedMessageId + 1> messages_{};
+
+
+    MetricCounter& messageCounter(MessageId id) {
+        const auto index = static_cast<std::size_t>(id);
+        if (index <= maxCachedMessageId) {
+            if (auto* counter = messages_[index].load(std::memory_order_acquire)) {
+                return *counter;
+            }
+        }
+        auto& counter = registry_.counter("simconnect_messages_received_total", "Messages received from SimConnect, by message ID.",
+                                          std::format("id=\"{}\"", static_cast<unsigned long>(id)));
+        if (index <= maxCachedMessageId) {
+            messages_[index].store(&counter, std::memory_order_release);
+        }
+        return counter;
+    }
+
+
+public:
+    ConnectionMetrics()
+        : callsSent_(registry_.counter("simconnect_calls_total", "SimConnect calls that were sent."))
+        , callsFailed_(registry_.counter("simconnect_call_failures_total", "SimConnect calls that returned a failure immediately."))
+        , bytesReceived_(registry_.counter("simconnect_received_bytes_total", "Bytes of messages received from SimConnect."))
+        , exceptions_(registry_.counter("simconnect_exceptions_total", "Exception messages received from SimConnect."))
+        , dispatchSeconds_(registry_.histogram("simconnect_dispatch_seconds", "Time spent in the handlers of a single message.",
+                                               { 0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1 }))
+    {
+    }
+
+    // No copies or moves
+    ConnectionMetrics(const ConnectionMetrics&) = delete;
+    ConnectionMetrics(ConnectionMetrics&&) = delete;
+    ConnectionMetrics& operator=(const ConnectionMetrics&) = delete;
+    ConnectionMetrics& operator=(ConnectionMetrics&&) = delete;
+    ~ConnectionMetrics() = default;
+
+
+    /**
+     * Returns the registry, for rendering or for adding application metrics next to the connection's.
+     */
+    [[nodiscard]]
+    MetricsRegistry& registry() noexcept { return registry_; }
+
+    [[nodiscard]]
+    const MetricsRegistry& registry() const noexcept { return registry_; }
+
+
+    void callSent() noexcept { callsSent_.inc(); }
+    void callFailed() noexcept { callsFailed_.inc(); }
+
+
+    /**
+     * Records a message that was received and dispatched.
+     *
+     * @param id The message ID.
+     * @param size The size of the message in bytes.
+     * @param duration The time its handlers took.
+     */
+    void messageDispatched(MessageId id, unsigned long size, std::chrono::steady_clock::duration duration) {
+        messageCounter(id).inc();
+        bytesReceived_.inc(size);
+        if (id == Messages::exception) {
+            exceptions_.inc();
+        }
+        dispatchSeconds_.observe(std::chrono::duration<double>(duration).count());
+    }
+
+
+    /**
+     * Returns the gauge counting the correlation IDs, such as outstanding request IDs, that a handler is waiting on.
+     * SimConnect allows about a thousand outstanding requests per client.
+     *
+     * @param handler The name of the handler, used as label.
+     */
+    [[nodiscard]]
+    MetricGauge& correlationHandlers(std::string_view handler) {
+        return registry_.gauge("simconnect_correlation_handlers", "Correlation IDs, such as request IDs, that handlers are waiting on.",
+                               metricLabel("handler", handler));
+    }
+};
+
+
+/**
+ * Satisfied by connections that keep metrics, which are Connection instantiations with the Metrics flag set.
+ */
+template <class C>
+concept MetricsConnection = requires(C& connection) {
+    { connection.metrics() } -> std::same_as<ConnectionMetrics&>;
+};
+
+} // namespace SimConnect
@@ -0,0 +1,513 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/windows_event_connection.hpp>
+#include <simconnect/windows_event_handler.hpp>
+
+#include <simconnect/requests/request.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Configuration for a ConnectionPool.
+ */
+struct ConnectionPoolConfig {
+    std::size_t connections{ 4 };                       ///< The number of client connections to open.
+    std::size_t maxInFlight{ 8 };                       ///< The maximum number of unfinished jobs per connection.
+    std::chrono::milliseconds pollInterval{ 10 };       ///< How long a worker waits for messages or work at a time.
+    int configIndex{ 0 };                               ///< The SimConnect.cfg section to connect with.
+};
+
+
+/**
+ * A pool of client connections for bulk request-style work, such as fetching facility data for thousands of airports.
+ *
+ * SimConnect limits the number of outstanding requests per client, so a single connection serialises bulk jobs. The
+ * pool opens a number of connections, named "<name>-0", "<name>-1", and so on, each with its own handler and worker
+ * thread. Submitted jobs are spread over the workers' queues; a worker that runs out of work steals from the back of
+ * another worker's queue, so a slow or failed connection does not hold up the rest.
+ *
+ * A job starts one request on the worker it is given and returns its Request. When the request is finished, for
+ * example in its "end" callback, the job calls the JobDone it received. Callbacks run on the worker's thread; use
+ * deliver() to merge their results into a single stream:
+ * @code
+ * pool.submit([&](auto& worker, auto done) {
+ *     return worker.template requestHandler<FacilityHandler>().requestFacilityData(defIds[worker.index()], icao, "",
+ *         [&](const Messages::FacilityDataMsg& msg) { pool.deliver([&]() { collect(msg); }); },
+ *         done);
+ * });
+ * @endcode
+ *
+ * Definitions such as facility definitions belong to a single client, so create them in the onConnected() callback,
+ * which runs on each worker after its connection is opened.
+ *
+ * A job that throws while starting its request is counted as abandoned, and a callback that throws while messages are
+ * dispatched leaves its request running; both exceptions are passed to the onError() callback, and the worker goes on.
+ *
+ * @tparam C The connection type. Each connection is only used by its own worker, so it need not be thread-safe.
+ * @tparam H The handler type, which must use a MultiHandlerPolicy if more than one request handler is used.
+ */
+template <class C = WindowsEventConnection<false, NullLogger>, class H = WindowsEventHandler<false, NullLogger>>
+class ConnectionPool {
+public:
+    using connection_type = C;
+    using handler_type = H;
+
+    class Worker;
+
+
+    /**
+     * Passed to each job, to be called once its request is finished. Must be called from a callback of the request,
+     * or otherwise on the worker's thread.
+     */
+    class JobDone {
+        Worker* worker_;
+        std::uint64_t serial_;
+
+    public:
+        JobDone(Worker* worker, std::uint64_t serial) : worker_(worker), serial_(serial) {}
+
+        void operator()() const { worker_->finished_.push_back(serial_); }
+    };
+
+    using job_type = std::function<Request(Worker&, JobDone)>;
+
+
+    /**
+     * A single connection of the pool, with its handler, request handlers, and job queue.
+     */
+    class Worker {
+        friend class ConnectionPool;
+        friend class JobDone;
+
+        ConnectionPool& pool_;
+        std::size_t index_;
+        connection_type connection_;
+        handler_type handler_;
+
+        std::unordered_map<std::type_index, std::shared_ptr<void>> requestHandlers_;
+
+        std::mutex queueMutex_;
+        std::deque<job_type> queue_;
+
+        std::unordered_map<std::uint64_t, Request> inFlight_;    ///< Only touched by the worker's thread.
+        std::vector<std::uint64_t> finished_;                   ///< Only touched by the worker's thread.
+        std::uint64_t nextSerial_{ 0 };
+
+        std::atomic<bool> connected_{ false };
+        std::atomic<std::size_t> completed_{ 0 };
+        std::atomic<std::size_t> stolen_{ 0 };
+
+        std::jthread thread_;   ///< Declared last, so it is joined before anything it uses is destroyed.
+
+
+        void releaseFinished() {
+            for (const auto serial : finished_) {
+                if (inFlight_.erase(serial) > 0) {
+                    completed_.fetch_add(1, std::memory_order_relaxed);
+                    pool_.jobFinished(true);
+                }
+            }
+            finished_.clear();
+        }
+
+
+        void run(const std::stop_token& stopToken) {
+            if (!connection_.open(pool_.config_.configIndex).isOpen()) {
+                pool_.workerStopped();
+                return;
+            }
+            connected_ = true;
+            if (pool_.onConnected_) {
+                pool_.onConnected_(*this);
+            }
+
+            while (!stopToken.stop_requested() && connection_.isOpen()) {
+                while (inFlight_.size() < pool_.config_.maxInFlight) {
+                    auto job = pool_.take(index_);
+                    if (!job) {
+                        break;
+                    }
+                    const auto serial = nextSerial_++;
+                    try {
+                        inFlight_.emplace(serial, (*job)(*this, JobDone{ this, serial }));
+                    }
+                    catch (...) {
+                        pool_.jobFinished(false);
+                        pool_.reportError(*this, std::current_exception());
+                    }
+                }
+                releaseFinished();      // Jobs that finished while being started.
+
+                if (inFlight_.empty()) {
+                    pool_.waitForWork(pool_.config_.pollInterval);
+                }
+                else {
+                    try {
+                        handler_.handleFor(pool_.config_.pollInterval);
+                    }
+                    catch (...) {
+                        pool_.reportError(*this, std::current_exception());
+                    }
+                    releaseFinished();
+                }
+            }
+            for (std::size_t i = 0; i < inFlight_.size(); ++i) {
+                pool_.jobFinished(false);
+            }
+            inFlight_.clear();
+            connected_ = false;
+            connection_.close();
+            pool_.workerStopped();
+        }
+
+
+    public:
+        Worker(ConnectionPool& pool, std::size_t index, const std::string& name)
+            : pool_(pool), index_(index), connection_(name), handler_(connection_)
+        {
+        }
+
+        // No copies or moves
+        Worker(const Worker&) = delete;
+        Worker(Worker&&) = delete;
+        Worker& operator=(const Worker&) = delete;
+        Worker& operator=(Worker&&) = delete;
+        ~Worker() = default;
+
+
+        [[nodiscard]]
+        std::size_t index() const noexcept { return index_; }
+
+        [[nodiscard]]
+        connection_type& connection() noexcept { return connection_; }
+
+        [[nodiscard]]
+        handler_type& handler() noexcept { return handler_; }
+
+        [[nodiscard]]
+        ConnectionPool& pool() noexcept { return pool_; }
+
+
+        /**
+         * Returns this worker's request handler of the given kind, such as FacilityHandler, FacilityListHandler, or
+         * SimObjectAndLiveryHandler, creating it on first use.
+         *
+         * @tparam R The request handler template.
+         */
+        template <template <class> class R>
+        [[nodiscard]]
+        R<H>& requestHandler() {
+            auto& entry = requestHandlers_[std::type_index(typeid(R<H>))];
+            if (!entry) {
+                entry = std::make_shared<R<H>>(handler_);
+            }
+            return *std::static_pointer_cast<R<H>>(entry);
+        }
+
+
+        /**
+         * Returns true while the worker's connection is open.
+         */
+        [[nodiscard]]
+        bool isConnected() const noexcept { return connected_.load(); }
+
+        /**
+         * Returns the number of jobs this worker finished.
+         */
+        [[nodiscard]]
+        std::size_t completed() const noexcept { return completed_.load(std::memory_order_relaxed); }
+
+        /**
+         * Returns the number of jobs this worker took from another worker's queue.
+         */
+        [[nodiscard]]
+        std::size_t stolen() const noexcept { return stolen_.load(std::memory_order_relaxed); }
+    };
+
+
+private:
+    std::string name_;
+    ConnectionPoolConfig config_;
+    std::function<void(Worker&)> onConnected_;
+    std::function<void(Worker&, std::exception_ptr)> onError_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::atomic<std::size_t> nextQueue_{ 0 };
+    std::atomic<std::size_t> queued_{ 0 };      ///< Jobs waiting in any queue.
+    std::atomic<std::size_t> running_{ 0 };     ///< Workers still running.
+
+    std::mutex mutex_;
+    std::condition_variable workCv_;
+    std::condition_variable idleCv_;
+    std::size_t outstanding_{ 0 };              ///< Jobs submitted and not yet finished or abandoned.
+    std::size_t abandoned_{ 0 };
+    std::size_t errors_{ 0 };
+
+    std::mutex deliverMutex_;
+
+
+    // No copies or moves
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool(ConnectionPool&&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(ConnectionPool&&) = delete;
+
+
+    /**
+     * Takes a job for the given worker: from the front of its own queue, or else from the back of another's.
+     */
+    std::optional<job_type> take(std::size_t index) {
+        const auto count = workers_.size();
+        for (std::size_t offset = 0; offset < count; ++offset) {
+            auto& worker = *workers_[(index + offset) % count];
+            std::lock_guard lock(worker.queueMutex_);
+
+            if (worker.queue_.empty()) {
+                continue;
+            }
+            job_type job;
+            if (offset == 0) {
+                job = std::move(worker.queue_.front());
+                worker.queue_.pop_front();
+            } else {
+                job = std::move(worker.queue_.back());
+                worker.queue_.pop_back();
+                workers_[index]->stolen_.fetch_add(1, std::memory_order_relaxed);
+            }
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+        return std::nullopt;
+    }
+
+
+    void waitForWork(std::chrono::milliseconds timeout) {
+        std::unique_lock lock(mutex_);
+        workCv_.wait_for(lock, timeout, [this]() { return queued_.load(std::memory_order_relaxed) > 0; });
+    }
+
+
+    void jobFinished(bool completed) {
+        std::lock_guard lock(mutex_);
+        --outstanding_;
+        if (!completed) {
+            ++abandoned_;
+        }
+        if (outstanding_ == 0) {
+            idleCv_.notify_all();
+        }
+    }
+
+
+    void reportError(Worker& worker, std::exception_ptr error) {
+        {
+            std::lock_guard lock(mutex_);
+            ++errors_;
+        }
+        if (onError_) {
+            onError_(worker, std::move(error));
+        }
+    }
+
+
+    void workerStopped() {
+        std::lock_guard lock(mutex_);
+        if (running_.fetch_sub(1) == 1) {
+            idleCv_.notify_all();   // Nobody is left to run the remaining jobs.
+        }
+    }
+
+
+public:
+    /**
+     * Creates a pool. No connections are opened until start() is called.
+     *
+     * @param name The base name of the client connections.
+     * @param config The pool's configuration.
+     */
+    ConnectionPool(std::string name, ConnectionPoolConfig config = {})
+        : name_(std::move(name)), config_(config)
+    {
+        for (std::size_t i = 0; i < config_.connections; ++i) {
+            workers_.push_back(std::make_unique<Worker>(*this, i, std::format("{}-{}", name_, i)));
+        }
+    }
+
+    ~ConnectionPool() {
+        stop();
+    }
+
+
+    /**
+     * Sets the callback run on each worker's thread once its connection is open, before it takes any jobs.
+     *
+     * @param callback The callback.
+     */
+    ConnectionPool& onConnected(std::function<void(Worker&)> callback) {
+        onConnected_ = std::move(callback);
+        return *this;
+    }
+
+
+    /**
+     * Sets the callback run on a worker's thread when a job, or a callback of its request, throws. The callback must
+     * not throw itself.
+     *
+     * @param callback The callback, which receives the worker and the exception.
+     */
+    ConnectionPool& onError(std::function<void(Worker&, std::exception_ptr)> callback) {
+        onError_ = std::move(callback);
+        return *this;
+    }
+
+
+    /**
+     * Opens the connections and starts the worker threads.
+     */
+    void start() {
+        for (auto& worker : workers_) {
+            if (!worker->thread_.joinable()) {
+                running_.fetch_add(1);
+                worker->thread_ = std::jthread([w = worker.get()](std::stop_token stopToken) { w->run(stopToken); });
+            }
+        }
+    }
+
+
+    /**
+     * Stops the worker threads and closes the connections. Jobs still in progress are abandoned.
+     */
+    void stop() {
+        for (auto& worker : workers_) {
+            worker->thread_.request_stop();
+        }
+        workCv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker->thread_.joinable()) {
+                worker->thread_.join();
+            }
+        }
+    }
+
+
+    /**
+     * Queues a job. Safe to call from any thread, including from job callbacks.
+     *
+     * @param job The job, which starts a request on the worker it is given and returns it.
+     */
+    void submit(job_type job) {
+        {
+            std::lock_guard lock(mutex_);
+            ++outstanding_;
+        }
+        auto& worker = *workers_[nextQueue_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+        {
+            std::lock_guard lock(worker.queueMutex_);
+            worker.queue_.push_back(std::move(job));
+        }
+        queued_.fetch_add(1, std::memory_order_relaxed);
+        workCv_.notify_one();
+    }
+
+
+    /**
+     * Runs a callback while holding the pool's delivery lock, so results coming from different workers form a single
+     * stream without further locking by the caller.
+     *
+     * @param callback The callback.
+     */
+    template <class F>
+    void deliver(F&& callback) {
+        std::lock_guard lock(deliverMutex_);
+        std::forward<F>(callback)();
+    }
+
+
+    /**
+     * Waits until all submitted jobs are finished, or no worker is left to run them.
+     *
+     * @param timeout The maximum time to wait.
+     * @returns true if all jobs finished.
+     */
+    bool waitIdle(std::chrono::milliseconds timeout) {
+        std::unique_lock lock(mutex_);
+        idleCv_.wait_for(lock, timeout, [this]() { return outstanding_ == 0 || running_.load() == 0; });
+        return outstanding_ == 0;
+    }
+
+
+    /**
+     * Returns the number of workers.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept { return workers_.size(); }
+
+    [[nodiscard]]
+    Worker& worker(std::size_t index) { return *workers_.at(index); }
+
+
+    /**
+     * Returns the number of jobs waiting in the queues.
+     */
+    [[nodiscard]]
+    std::size_t queued() const noexcept { return queued_.load(std::memory_order_relaxed); }
+
+
+    /**
+     * Returns the number of jobs abandoned because their connection was stopped or lost.
+     */
+    [[nodiscard]]
+    std::size_t abandoned() {
+        std::lock_guard lock(mutex_);
+        return abandoned_;
+    }
+
+    /**
+     * Returns the number of exceptions thrown by jobs and their callbacks.
+     */
+    [[nodiscard]]
+    std::size_t errors() {
+        std::lock_guard lock(mutex_);
+        return errors_;
+    }
+};
+
+} // namespace SimConnect
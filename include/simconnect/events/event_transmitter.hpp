@@ -0,0 +1,271 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/events/events.hpp>
+#include <simconnect/events/event_handler.hpp>
+#include <simconnect/events/system_events.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Configuration for an EventTransmitter.
+ */
+struct EventTransmitterConfig {
+    std::chrono::microseconds minInterval{ 0 };         ///< Minimum time between flushes; 0 flushes on every frame.
+    std::optional<NotificationGroupId> group{};         ///< The notification group to send in, if any.
+    Events::Priority priority{ Events::highestPriority };   ///< The priority to send with when no group is set.
+    bool flushOnFrame{ true };                          ///< Subscribe to the "Frame" system event to drive flush().
+};
+
+
+/**
+ * The EventTransmitter sends client events at most once per simulator frame for each (object, event) pair.
+ *
+ * Level events, such as axis positions and "_SET" events, are coalesced: only the latest value queued since the
+ * previous flush is transmitted. Edge events, such as toggles and increments, are queued and all transmitted in
+ * order, as each one matters. Queuing only takes the transmitter's own lock, so high-rate producers like hardware
+ * polling loops do not contend for the connection.
+ *
+ * Flushing is driven by the "Frame" system event, optionally limited to a minimum interval, or done explicitly with
+ * flush().
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ */
+template <class M>
+class EventTransmitter
+{
+public:
+    using simconnect_message_handler_type = M;
+    using connection_type = typename M::connection_type;
+    using mutex_type = typename connection_type::mutex_type;
+    using guard_type = typename connection_type::guard_type;
+    using clock_type = std::chrono::steady_clock;
+
+
+private:
+    struct Pending {
+        SimObjectId objectId;
+        event evt;
+        unsigned long data;
+    };
+
+    EventHandler<M>& eventHandler_;
+    SystemEvents<M> systemEvents_;
+    EventTransmitterConfig config_;
+
+    mutable mutex_type mutex_;
+    std::vector<Pending> pending_;
+    std::unordered_map<std::uint64_t, std::size_t> slots_;  ///< (object, event) to index in pending_, for coalesced events.
+    clock_type::time_point lastFlush_{};                    ///< Zero until the first flush.
+
+    std::size_t queued_{ 0 };
+    std::size_t transmitted_{ 0 };
+    std::size_t suppressed_{ 0 };
+
+
+    // No copies or moves
+    EventTransmitter(const EventTransmitter&) = delete;
+    EventTransmitter(EventTransmitter&&) = delete;
+    EventTransmitter& operator=(const EventTransmitter&) = delete;
+    EventTransmitter& operator=(EventTransmitter&&) = delete;
+
+
+    static constexpr std::uint64_t slotKey(SimObjectId objectId, EventId eventId) noexcept {
+        return (static_cast<std::uint64_t>(objectId) << 32) | static_cast<std::uint32_t>(eventId);
+    }
+
+
+    void transmit(const Pending& entry) {
+        if (config_.group) {
+            eventHandler_.connection().transmitClientEvent(entry.objectId, entry.evt, *config_.group, entry.data);
+        } else {
+            eventHandler_.connection().transmitClientEventWithPriority(entry.objectId, entry.evt, config_.priority, entry.data);
+        }
+    }
+
+
+public:
+    EventTransmitter(EventHandler<M>& eventHandler, EventTransmitterConfig config = {})
+        : eventHandler_(eventHandler), systemEvents_(eventHandler), config_(std::move(config))
+    {
+        if (config_.flushOnFrame) {
+            systemEvents_.onFrame([this](float, float) { flushIfDue(); });
+        }
+    }
+    ~EventTransmitter() = default;
+
+
+    /**
+     * Returns true if an event is a level event by name: an "AXIS_" event or one ending in "_SET". The latest value of
+     * a level event replaces earlier ones; all other events are treated as edges.
+     *
+     * @param name The event name.
+     */
+    [[nodiscard]]
+    static constexpr bool isLevelEvent(std::string_view name) noexcept {
+        return name.starts_with("AXIS_") || name.ends_with("_SET");
+    }
+
+
+    /**
+     * Queues a level event. If a value for the same object and event is still queued, it is replaced.
+     *
+     * @param evt The event.
+     * @param data The value.
+     * @param objectId The object to send the event to.
+     */
+    void set(const event& evt, unsigned long data, SimObjectId objectId = SimObject::user) {
+        guard_type lock(mutex_);
+
+        ++queued_;
+        auto [it, inserted] = slots_.try_emplace(slotKey(objectId, evt.id()), pending_.size());
+        if (inserted) {
+            pending_.push_back(Pending{ objectId, evt, data });
+        } else {
+            pending_[it->second].data = data;
+            ++suppressed_;
+        }
+    }
+
+
+    /**
+     * Queues an edge event. Edge events are never coalesced; each one is transmitted.
+     *
+     * @param evt The event.
+     * @param data The value.
+     * @param objectId The object to send the event to.
+     */
+    void trigger(const event& evt, unsigned long data = 0, SimObjectId objectId = SimObject::user) {
+        guard_type lock(mutex_);
+
+        ++queued_;
+        pending_.push_back(Pending{ objectId, evt, data });
+    }
+
+
+    /**
+     * Queues an event, coalescing it if isLevelEvent() says it is a level event.
+     *
+     * @param evt The event.
+     * @param data The value.
+     * @param objectId The object to send the event to.
+     */
+    void send(const event& evt, unsigned long data = 0, SimObjectId objectId = SimObject::user) {
+        if (isLevelEvent(evt.name())) {
+            set(evt, data, objectId);
+        } else {
+            trigger(evt, data, objectId);
+        }
+    }
+
+
+    /**
+     * Transmits all queued events, in the order they were first queued.
+     *
+     * @returns The number of events transmitted.
+     */
+    std::size_t flush() {
+        std::vector<Pending> batch;
+        {
+            guard_type lock(mutex_);
+
+            std::swap(pending_, batch);
+            slots_.clear();
+            lastFlush_ = clock_type::now();
+        }
+        for (const auto& entry : batch) {
+            transmit(entry);
+        }
+        const auto count = batch.size();
+
+        guard_type lock(mutex_);
+        transmitted_ += count;
+        if (pending_.empty() && pending_.capacity() < batch.capacity()) {
+            batch.clear();
+            std::swap(pending_, batch);     // Keep the larger buffer for the next frame.
+        }
+        return count;
+    }
+
+
+    /**
+     * Flushes if the configured minimum interval has passed since the previous flush.
+     *
+     * @returns The number of events transmitted.
+     */
+    std::size_t flushIfDue() {
+        {
+            guard_type lock(mutex_);
+
+            if (pending_.empty() || (lastFlush_ != clock_type::time_point{} && (clock_type::now() - lastFlush_) < config_.minInterval)) {
+                return 0;
+            }
+        }
+        return flush();
+    }
+
+
+    /**
+     * Returns the number of events waiting to be transmitted.
+     */
+    [[nodiscard]]
+    std::size_t pending() const {
+        guard_type lock(mutex_);
+        return pending_.size();
+    }
+
+    /**
+     * Returns the number of set(), trigger(), and send() calls.
+     */
+    [[nodiscard]]
+    std::size_t queued() const {
+        guard_type lock(mutex_);
+        return queued_;
+    }
+
+    /**
+     * Returns the number of events transmitted.
+     */
+    [[nodiscard]]
+    std::size_t transmitted() const {
+        guard_type lock(mutex_);
+        return transmitted_;
+    }
+
+    /**
+     * Returns the number of values that were replaced by a later value before being transmitted.
+     */
+    [[nodiscard]]
+    std::size_t suppressed() const {
+        guard_type lock(mutex_);
+        return suppressed_;
+    }
+};
+
+} // namespace SimConnect
@@ -49,7 +49,7 @@ public:
     private:
         Key() = default;
 
-        template<class D, bool TS, class L, bool TM> friend class Connection;
+        template<class D, bool TS, class L, bool TM, bool M> friend class Connection;
 
         static EventId allocate() noexcept { return ++event::nextId_; }
     };
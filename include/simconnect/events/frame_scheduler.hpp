@@ -0,0 +1,354 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/events/event_handler.hpp>
+#include <simconnect/events/system_events.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Configuration for a FrameScheduler.
+ */
+struct FrameSchedulerConfig {
+    std::chrono::microseconds budget{ 2000 };   ///< Time per frame for running tasks; tasks that do not fit wait for the next frame.
+    bool runOnFrame{ true };                    ///< Subscribe to the "Frame" system event to drive runFrame().
+};
+
+
+/**
+ * Information passed to a task about the frame it runs in.
+ */
+struct FrameInfo {
+    std::uint64_t frame{ 0 };           ///< The frame number, counting from 1.
+    float frameRate{ 0.0f };            ///< The frame rate reported by the simulator.
+    float simSpeed{ 1.0f };             ///< The simulation rate reported by the simulator.
+    std::chrono::microseconds remaining{ 0 };   ///< Budget left when the task started.
+};
+
+
+/**
+ * Timing statistics for a single task.
+ */
+struct FrameTaskStats {
+    std::string name;
+    int priority{ 0 };
+    std::size_t runs{ 0 };
+    std::size_t deferrals{ 0 };         ///< Frames in which the task was due but did not fit in the budget.
+    std::size_t overruns{ 0 };          ///< Runs that started within the budget and ended past it.
+    std::chrono::microseconds lastTime{ 0 };
+    std::chrono::microseconds maxTime{ 0 };
+    std::chrono::microseconds totalTime{ 0 };
+};
+
+
+/**
+ * Statistics over all frames a FrameScheduler ran.
+ */
+struct FrameSchedulerStats {
+    std::uint64_t frames{ 0 };
+    std::size_t overrunFrames{ 0 };     ///< Frames in which the tasks took longer than the budget.
+    std::size_t deferrals{ 0 };         ///< Task runs pushed to a later frame.
+    std::chrono::microseconds lastFrameTime{ 0 };
+    std::chrono::microseconds maxFrameTime{ 0 };
+};
+
+
+/**
+ * The FrameScheduler runs per-frame work within a time budget.
+ *
+ * Tasks added with add() run every frame, tasks posted with post() run once. Each frame, tasks run in order of
+ * priority (higher first), with tasks that were deferred in the previous frame going before the others. Before each
+ * task the scheduler checks the time used so far, and once the budget is spent the remaining tasks are deferred to the
+ * next frame. A running task is never interrupted, so the first task of a frame always runs and a slow task can still
+ * overrun; such overruns are counted per task and per frame.
+ *
+ * Tasks run on the thread dispatching messages. They can be added and removed from any thread, and from within a task.
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ * @tparam Clock The clock used for timing.
+ */
+template <class M, class Clock = std::chrono::steady_clock>
+class FrameScheduler
+{
+public:
+    using simconnect_message_handler_type = M;
+    using connection_type = typename M::connection_type;
+    using mutex_type = typename connection_type::mutex_type;
+    using guard_type = typename connection_type::guard_type;
+    using clock_type = Clock;
+    using task_type = std::function<void(const FrameInfo&)>;
+    using TaskId = std::uint64_t;
+
+
+private:
+    struct Task {
+        TaskId id;
+        bool recurring;
+        bool removed{ false };
+        bool deferred{ false };
+        task_type call;
+        FrameTaskStats stats;
+    };
+
+    SystemEvents<M> systemEvents_;
+    FrameSchedulerConfig config_;
+
+    mutable mutex_type mutex_;
+    std::vector<std::shared_ptr<Task>> tasks_;
+    TaskId nextId_{ 1 };
+    FrameSchedulerStats stats_;
+
+
+    // No copies or moves
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler(FrameScheduler&&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(FrameScheduler&&) = delete;
+
+
+    static std::chrono::microseconds micros(typename clock_type::duration duration) noexcept {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    }
+
+
+    TaskId addTask(std::string name, int priority, bool recurring, task_type call) {
+        guard_type lock(mutex_);
+
+        const auto id = nextId_++;
+        tasks_.push_back(std::make_shared<Task>(Task{
+            .id = id, .recurring = recurring, .call = std::move(call),
+            .stats = FrameTaskStats{ .name = std::move(name), .priority = priority } }));
+        return id;
+    }
+
+
+public:
+    FrameScheduler(EventHandler<M>& eventHandler, FrameSchedulerConfig config = {})
+        : systemEvents_(eventHandler), config_(config)
+    {
+        if (config_.runOnFrame) {
+            systemEvents_.onFrame([this](float frameRate, float simSpeed) { runFrame(frameRate, simSpeed); });
+        }
+    }
+    ~FrameScheduler() = default;
+
+
+    /**
+     * Adds a task that runs every frame.
+     *
+     * @param name The name, used in the statistics.
+     * @param priority The priority; higher priorities run first.
+     * @param task The task.
+     * @returns The ID to remove the task with.
+     */
+    TaskId add(std::string name, int priority, task_type task) {
+        return addTask(std::move(name), priority, true, std::move(task));
+    }
+
+
+    /**
+     * Adds a task that runs once, in the first frame with budget left for it.
+     *
+     * @param name The name, used in the statistics.
+     * @param priority The priority; higher priorities run first.
+     * @param task The task.
+     * @returns The ID to cancel the task with.
+     */
+    TaskId post(std::string name, int priority, task_type task) {
+        return addTask(std::move(name), priority, false, std::move(task));
+    }
+
+
+    /**
+     * Removes a task. If called while a frame is running, the task will not be started in that frame anymore.
+     *
+     * @param id The ID returned by add() or post().
+     * @returns true if the task was found.
+     */
+    bool remove(TaskId id) {
+        guard_type lock(mutex_);
+
+        auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->id == id; });
+        if (it == tasks_.end()) {
+            return false;
+        }
+        (*it)->removed = true;
+        tasks_.erase(it);
+        return true;
+    }
+
+
+    /**
+     * Runs one frame's worth of tasks. This is called for every "Frame" system event, unless the scheduler was
+     * configured not to.
+     *
+     * @param frameRate The frame rate to pass to the tasks.
+     * @param simSpeed The simulation rate to pass to the tasks.
+     * @returns The number of tasks that ran.
+     */
+    std::size_t runFrame(float frameRate = 0.0f, float simSpeed = 1.0f) {
+        const auto start = clock_type::now();
+
+        FrameInfo info{ .frameRate = frameRate, .simSpeed = simSpeed };
+        std::chrono::microseconds budget{};
+        std::vector<std::shared_ptr<Task>> order;
+        {
+            guard_type lock(mutex_);
+
+            info.frame = ++stats_.frames;
+            budget = config_.budget;
+            order.assign(tasks_.begin(), tasks_.end());
+            std::stable_sort(order.begin(), order.end(), [](const auto& lhs, const auto& rhs) {
+                if (lhs->deferred != rhs->deferred) {
+                    return lhs->deferred;
+                }
+                return lhs->stats.priority > rhs->stats.priority;
+            });
+        }
+
+        std::size_t ran{ 0 };
+        std::size_t deferred{ 0 };
+        for (const auto& task : order) {
+            const auto used = micros(clock_type::now() - start);
+            {
+                guard_type lock(mutex_);
+
+                if (task->removed) {
+                    continue;
+                }
+                if ((ran > 0) && (used >= budget)) {
+                    task->deferred = true;
+                    ++task->stats.deferrals;
+                    ++deferred;
+                    continue;
+                }
+                if (!task->recurring) {
+                    task->removed = true;
+                    std::erase(tasks_, task);
+                }
+            }
+            info.remaining = (used < budget) ? (budget - used) : std::chrono::microseconds{ 0 };
+
+            const auto taskStart = clock_type::now();
+            task->call(info);
+            const auto taskEnd = clock_type::now();
+            ++ran;
+
+            guard_type lock(mutex_);
+            const auto time = micros(taskEnd - taskStart);
+            task->deferred = false;
+            ++task->stats.runs;
+            task->stats.lastTime = time;
+            task->stats.maxTime = std::max(task->stats.maxTime, time);
+            task->stats.totalTime += time;
+            if ((used < budget) && (micros(taskEnd - start) > budget)) {
+                ++task->stats.overruns;
+            }
+        }
+
+        const auto frameTime = micros(clock_type::now() - start);
+
+        guard_type lock(mutex_);
+        stats_.deferrals += deferred;
+        stats_.lastFrameTime = frameTime;
+        stats_.maxFrameTime = std::max(stats_.maxFrameTime, frameTime);
+        if (frameTime > budget) {
+            ++stats_.overrunFrames;
+        }
+        return ran;
+    }
+
+
+    /**
+     * Returns the time budget per frame.
+     */
+    [[nodiscard]]
+    std::chrono::microseconds budget() const {
+        guard_type lock(mutex_);
+        return config_.budget;
+    }
+
+    /**
+     * Sets the time budget per frame, taking effect from the next frame.
+     */
+    void budget(std::chrono::microseconds budget) {
+        guard_type lock(mutex_);
+        config_.budget = budget;
+    }
+
+
+    /**
+     * Returns the number of tasks, including one-shot tasks that have not run yet.
+     */
+    [[nodiscard]]
+    std::size_t size() const {
+        guard_type lock(mutex_);
+        return tasks_.size();
+    }
+
+
+    [[nodiscard]]
+    FrameSchedulerStats stats() const {
+        guard_type lock(mutex_);
+        return stats_;
+    }
+
+
+    /**
+     * Returns the statistics of a task that has not been removed or, for a one-shot task, run.
+     */
+    [[nodiscard]]
+    std::optional<FrameTaskStats> taskStats(TaskId id) const {
+        guard_type lock(mutex_);
+        auto it = std::find_if(tasks_.begin(), tasks_.end(), [id](const auto& task) { return task->id == id; });
+        if (it == tasks_.end()) {
+            return std::nullopt;
+        }
+        return (*it)->stats;
+    }
+
+
+    /**
+     * Returns the statistics of all current tasks, in the order they were added.
+     */
+    [[nodiscard]]
+    std::vector<FrameTaskStats> taskStats() const {
+        guard_type lock(mutex_);
+        std::vector<FrameTaskStats> result;
+        result.reserve(tasks_.size());
+        for (const auto& task : tasks_) {
+            result.push_back(task->stats);
+        }
+        return result;
+    }
+};
+
+} // namespace SimConnect
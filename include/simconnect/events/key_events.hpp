@@ -0,0 +1,315 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <simconnect/simconnect.hpp>
+
+
+/**
+ * A compile-time catalog of commonly used Key Events (the simulator events you map with MapClientEventToSimEvent).
+ *
+ * Every name in the catalog has a fixed client event ID, found through a perfect hash table that is built when the
+ * header is compiled. Connection::event() looks names up here first, so mapping a catalog event needs no ID
+ * allocation or registry entry, and the same name always gives the same ID. Use KeyEvents::id() to get the ID as a
+ * compile-time constant:
+ *
+ *     constexpr EventId apMaster = KeyEvents::id("AP_MASTER");
+ *
+ * Names not in the catalog still work as before; they get an ID from the connection's dynamic registry.
+ */
+namespace SimConnect::KeyEvents {
+
+/**
+ * The Key Event names in the catalog. The ID of a name is firstId plus its index, so new names must be added at the
+ * end to keep existing IDs stable.
+ */
+inline constexpr auto names = std::to_array<std::string_view>({
+    // Autopilot
+    "AP_MASTER", "AUTOPILOT_OFF", "AUTOPILOT_ON", "AUTOPILOT_DISENGAGE_TOGGLE", "YAW_DAMPER_TOGGLE", "YAW_DAMPER_ON",
+    "YAW_DAMPER_OFF", "TOGGLE_FLIGHT_DIRECTOR", "AP_WING_LEVELER", "AP_WING_LEVELER_ON", "AP_WING_LEVELER_OFF",
+    "AP_HDG_HOLD", "AP_HDG_HOLD_ON", "AP_HDG_HOLD_OFF", "AP_PANEL_HEADING_HOLD", "AP_PANEL_HEADING_ON",
+    "AP_PANEL_HEADING_OFF", "HEADING_BUG_INC", "HEADING_BUG_DEC", "HEADING_BUG_SET", "HEADING_BUG_SELECT",
+    "AP_ALT_HOLD", "AP_ALT_HOLD_ON", "AP_ALT_HOLD_OFF", "AP_PANEL_ALTITUDE_HOLD", "AP_PANEL_ALTITUDE_ON",
+    "AP_PANEL_ALTITUDE_OFF", "AP_ALT_VAR_INC", "AP_ALT_VAR_DEC", "AP_ALT_VAR_SET_ENGLISH", "AP_ALT_VAR_SET_METRIC",
+    "AP_VS_HOLD", "AP_VS_ON", "AP_VS_OFF", "AP_PANEL_VS_HOLD", "AP_VS_VAR_INC", "AP_VS_VAR_DEC",
+    "AP_VS_VAR_SET_ENGLISH", "AP_VS_VAR_SET_METRIC", "AP_VS_SET", "AP_AIRSPEED_HOLD", "AP_AIRSPEED_ON",
+    "AP_AIRSPEED_OFF", "AP_AIRSPEED_SET", "AP_PANEL_SPEED_HOLD", "AP_SPD_VAR_INC", "AP_SPD_VAR_DEC", "AP_SPD_VAR_SET",
+    "AP_MACH_HOLD", "AP_MACH_ON", "AP_MACH_OFF", "AP_MACH_SET", "AP_PANEL_MACH_HOLD", "AP_MACH_VAR_INC",
+    "AP_MACH_VAR_DEC", "AP_MACH_VAR_SET", "AP_NAV1_HOLD", "AP_NAV1_HOLD_ON", "AP_NAV1_HOLD_OFF", "AP_NAV_SELECT_SET",
+    "AP_LOC_HOLD", "AP_LOC_HOLD_ON", "AP_LOC_HOLD_OFF", "AP_APR_HOLD", "AP_APR_HOLD_ON", "AP_APR_HOLD_OFF",
+    "AP_BC_HOLD", "AP_BC_HOLD_ON", "AP_BC_HOLD_OFF", "AP_ATT_HOLD", "AP_ATT_HOLD_ON", "AP_ATT_HOLD_OFF",
+    "AP_PITCH_REF_INC_UP", "AP_PITCH_REF_INC_DN", "AP_PITCH_REF_SELECT", "AP_MAX_BANK_INC", "AP_MAX_BANK_DEC",
+    "AP_N1_HOLD", "AP_N1_REF_INC", "AP_N1_REF_DEC", "AP_N1_REF_SET", "FLIGHT_LEVEL_CHANGE", "FLIGHT_LEVEL_CHANGE_ON",
+    "FLIGHT_LEVEL_CHANGE_OFF", "AUTO_THROTTLE_ARM", "AUTO_THROTTLE_TO_GA", "TOGGLE_GPS_DRIVES_NAV1",
+
+    // Engines
+    "THROTTLE_FULL", "THROTTLE_INCR", "THROTTLE_INCR_SMALL", "THROTTLE_DECR", "THROTTLE_DECR_SMALL", "THROTTLE_CUT",
+    "THROTTLE_SET", "THROTTLE_10", "THROTTLE_20", "THROTTLE_30", "THROTTLE_40", "THROTTLE_50", "THROTTLE_60",
+    "THROTTLE_70", "THROTTLE_80", "THROTTLE_90", "INCREASE_THROTTLE", "DECREASE_THROTTLE", "AXIS_THROTTLE_SET",
+    "THROTTLE1_SET", "THROTTLE2_SET", "THROTTLE3_SET", "THROTTLE4_SET", "THROTTLE1_FULL", "THROTTLE2_FULL",
+    "THROTTLE3_FULL", "THROTTLE4_FULL", "THROTTLE1_CUT", "THROTTLE2_CUT", "THROTTLE3_CUT", "THROTTLE4_CUT",
+    "AXIS_THROTTLE1_SET", "AXIS_THROTTLE2_SET", "AXIS_THROTTLE3_SET", "AXIS_THROTTLE4_SET", "MIXTURE_RICH",
+    "MIXTURE_LEAN", "MIXTURE_INCR", "MIXTURE_DECR", "MIXTURE_SET", "MIXTURE1_SET", "MIXTURE2_SET", "MIXTURE3_SET",
+    "MIXTURE4_SET", "AXIS_MIXTURE_SET", "PROP_PITCH_INCR", "PROP_PITCH_DECR", "PROP_PITCH_HI", "PROP_PITCH_LO",
+    "PROP_PITCH_SET", "AXIS_PROPELLER_SET", "ENGINE_AUTO_START", "ENGINE_AUTO_SHUTDOWN", "TOGGLE_STARTER1",
+    "TOGGLE_STARTER2", "TOGGLE_STARTER3", "TOGGLE_STARTER4", "SET_STARTER1_HELD", "SET_STARTER2_HELD",
+    "MAGNETO_OFF", "MAGNETO_RIGHT", "MAGNETO_LEFT", "MAGNETO_BOTH", "MAGNETO_START", "MAGNETO_INCR", "MAGNETO_DECR",
+    "MAGNETO_SET", "MAGNETO1_OFF", "MAGNETO1_RIGHT", "MAGNETO1_LEFT", "MAGNETO1_BOTH", "MAGNETO1_START",
+    "MAGNETO2_OFF", "MAGNETO2_RIGHT", "MAGNETO2_LEFT", "MAGNETO2_BOTH", "MAGNETO2_START", "SELECT_1", "SELECT_2",
+    "SELECT_3", "SELECT_4", "ENGINE",
+
+    // Electrical
+    "TOGGLE_MASTER_BATTERY", "TOGGLE_MASTER_ALTERNATOR", "TOGGLE_MASTER_BATTERY_ALTERNATOR", "MASTER_BATTERY_ON",
+    "MASTER_BATTERY_OFF", "MASTER_BATTERY_SET", "TOGGLE_ALTERNATOR1", "TOGGLE_ALTERNATOR2", "TOGGLE_ALTERNATOR3",
+    "TOGGLE_ALTERNATOR4", "ALTERNATOR_ON", "ALTERNATOR_OFF", "ALTERNATOR_SET", "TOGGLE_AVIONICS_MASTER",
+    "AVIONICS_MASTER_SET", "TOGGLE_ELECT_FUEL_PUMP", "TOGGLE_ELECT_FUEL_PUMP1", "TOGGLE_ELECT_FUEL_PUMP2",
+
+    // Fuel
+    "FUEL_PUMP", "TOGGLE_FUEL_VALVE_ALL", "TOGGLE_FUEL_VALVE_ENG1", "TOGGLE_FUEL_VALVE_ENG2", "TOGGLE_FUEL_VALVE_ENG3",
+    "TOGGLE_FUEL_VALVE_ENG4", "FUEL_SELECTOR_OFF", "FUEL_SELECTOR_ALL", "FUEL_SELECTOR_LEFT", "FUEL_SELECTOR_RIGHT",
+    "FUEL_SELECTOR_CENTER", "FUEL_SELECTOR_SET", "FUEL_SELECTOR_2_OFF", "FUEL_SELECTOR_2_ALL", "FUEL_SELECTOR_2_LEFT",
+    "FUEL_SELECTOR_2_RIGHT", "FUEL_SELECTOR_2_SET", "CROSS_FEED_TOGGLE", "CROSS_FEED_OPEN", "CROSS_FEED_OFF",
+    "ADD_FUEL_QUANTITY", "REPAIR_AND_REFUEL", "REQUEST_FUEL_KEY",
+
+    // Flight controls
+    "AILERON_LEFT", "AILERON_RIGHT", "AILERON_SET", "AILERONS_LEFT", "AILERONS_RIGHT", "CENTER_AILER_RUDDER",
+    "AXIS_AILERONS_SET", "ELEVATOR_UP", "ELEVATOR_DOWN", "ELEVATOR_SET", "AXIS_ELEVATOR_SET", "ELEV_TRIM_UP",
+    "ELEV_TRIM_DN", "ELEVATOR_TRIM_SET", "AXIS_ELEV_TRIM_SET", "RUDDER_LEFT", "RUDDER_RIGHT", "RUDDER_CENTER",
+    "RUDDER_SET", "AXIS_RUDDER_SET", "RUDDER_TRIM_LEFT", "RUDDER_TRIM_RIGHT", "RUDDER_TRIM_SET", "AILERON_TRIM_LEFT",
+    "AILERON_TRIM_RIGHT", "AILERON_TRIM_SET", "FLAPS_UP", "FLAPS_1", "FLAPS_2", "FLAPS_3", "FLAPS_DOWN",
+    "FLAPS_INCR", "FLAPS_DECR", "FLAPS_SET", "AXIS_FLAPS_SET", "SPOILERS_TOGGLE", "SPOILERS_ON", "SPOILERS_OFF",
+    "SPOILERS_SET", "SPOILERS_ARM_TOGGLE", "SPOILERS_ARM_ON", "SPOILERS_ARM_OFF", "AXIS_SPOILER_SET",
+
+    // Gear and brakes
+    "GEAR_TOGGLE", "GEAR_UP", "GEAR_DOWN", "GEAR_SET", "GEAR_PUMP", "BRAKES", "BRAKES_LEFT", "BRAKES_RIGHT",
+    "AXIS_LEFT_BRAKE_SET", "AXIS_RIGHT_BRAKE_SET", "PARKING_BRAKES", "PARKING_BRAKE_SET", "TOGGLE_TAIL_HOOK_HANDLE",
+    "TOGGLE_WATER_RUDDER", "TOGGLE_PUSHBACK", "KEY_TUG_HEADING", "TOW_PLANE_RELEASE",
+
+    // Anti-ice
+    "ANTI_ICE_ON", "ANTI_ICE_OFF", "ANTI_ICE_TOGGLE", "ANTI_ICE_SET", "PITOT_HEAT_TOGGLE", "PITOT_HEAT_ON",
+    "PITOT_HEAT_OFF", "PITOT_HEAT_SET", "TOGGLE_STRUCTURAL_DEICE", "TOGGLE_PROPELLER_DEICE", "WINDSHIELD_DEICE_TOGGLE",
+
+    // Lights
+    "ALL_LIGHTS_TOGGLE", "STROBES_TOGGLE", "STROBES_ON", "STROBES_OFF", "STROBES_SET", "PANEL_LIGHTS_TOGGLE",
+    "PANEL_LIGHTS_ON", "PANEL_LIGHTS_OFF", "PANEL_LIGHTS_SET", "LANDING_LIGHTS_TOGGLE", "LANDING_LIGHTS_ON",
+    "LANDING_LIGHTS_OFF", "LANDING_LIGHTS_SET", "LANDING_LIGHT_UP", "LANDING_LIGHT_DOWN", "LANDING_LIGHT_LEFT",
+    "LANDING_LIGHT_RIGHT", "LANDING_LIGHT_HOME", "TOGGLE_BEACON_LIGHTS", "BEACON_LIGHTS_ON", "BEACON_LIGHTS_OFF",
+    "BEACON_LIGHTS_SET", "TOGGLE_TAXI_LIGHTS", "TAXI_LIGHTS_ON", "TAXI_LIGHTS_OFF", "TAXI_LIGHTS_SET",
+    "TOGGLE_LOGO_LIGHTS", "LOGO_LIGHTS_SET", "TOGGLE_WING_LIGHTS", "WING_LIGHTS_ON", "WING_LIGHTS_OFF",
+    "WING_LIGHTS_SET", "TOGGLE_NAV_LIGHTS", "NAV_LIGHTS_ON", "NAV_LIGHTS_OFF", "NAV_LIGHTS_SET",
+    "TOGGLE_RECOGNITION_LIGHTS", "RECOGNITION_LIGHTS_SET", "TOGGLE_CABIN_LIGHTS", "CABIN_LIGHTS_ON",
+    "CABIN_LIGHTS_OFF", "CABIN_LIGHTS_SET",
+
+    // Radios
+    "COM_RADIO", "COM_RADIO_SET", "COM_RADIO_SET_HZ", "COM_STBY_RADIO_SET", "COM_STBY_RADIO_SET_HZ", "COM_RADIO_SWAP",
+    "COM_RADIO_WHOLE_INC", "COM_RADIO_WHOLE_DEC", "COM_RADIO_FRACT_INC", "COM_RADIO_FRACT_DEC", "COM2_RADIO_SET",
+    "COM2_RADIO_SET_HZ", "COM2_STBY_RADIO_SET", "COM2_STBY_RADIO_SET_HZ", "COM2_RADIO_SWAP", "COM2_RADIO_WHOLE_INC",
+    "COM2_RADIO_WHOLE_DEC", "COM2_RADIO_FRACT_INC", "COM2_RADIO_FRACT_DEC", "COM1_TRANSMIT_SELECT",
+    "COM2_TRANSMIT_SELECT", "NAV1_RADIO_SET", "NAV1_RADIO_SET_HZ", "NAV1_STBY_SET", "NAV1_STBY_SET_HZ",
+    "NAV1_RADIO_SWAP", "NAV1_RADIO_WHOLE_INC", "NAV1_RADIO_WHOLE_DEC", "NAV1_RADIO_FRACT_INC", "NAV1_RADIO_FRACT_DEC",
+    "NAV2_RADIO_SET", "NAV2_RADIO_SET_HZ", "NAV2_STBY_SET", "NAV2_STBY_SET_HZ", "NAV2_RADIO_SWAP",
+    "NAV2_RADIO_WHOLE_INC", "NAV2_RADIO_WHOLE_DEC", "NAV2_RADIO_FRACT_INC", "NAV2_RADIO_FRACT_DEC", "VOR1_SET",
+    "VOR2_SET", "VOR1_OBI_INC", "VOR1_OBI_DEC", "VOR2_OBI_INC", "VOR2_OBI_DEC", "ADF_SET", "ADF_COMPLETE_SET",
+    "ADF_100_INC", "ADF_10_INC", "ADF_1_INC", "ADF_100_DEC", "ADF_10_DEC", "ADF_1_DEC", "XPNDR_SET",
+    "XPNDR_1000_INC", "XPNDR_100_INC", "XPNDR_10_INC", "XPNDR_1_INC", "XPNDR_1000_DEC", "XPNDR_100_DEC",
+    "XPNDR_10_DEC", "XPNDR_1_DEC", "XPNDR_IDENT_ON",
+
+    // Instruments
+    "KOHLSMAN_INC", "KOHLSMAN_DEC", "KOHLSMAN_SET", "BAROMETRIC", "GYRO_DRIFT_INC", "GYRO_DRIFT_DEC",
+    "GYRO_DRIFT_SET", "HEADING_GYRO_SET",
+
+    // Simulation
+    "PAUSE_TOGGLE", "PAUSE_ON", "PAUSE_OFF", "PAUSE_SET", "SIM_RATE", "SIM_RATE_INCR", "SIM_RATE_DECR",
+    "SIM_RATE_SET", "SLEW_TOGGLE", "SLEW_ON", "SLEW_OFF", "SLEW_SET", "SLEW_RESET", "FREEZE_LATITUDE_LONGITUDE_TOGGLE",
+    "FREEZE_LATITUDE_LONGITUDE_SET", "FREEZE_ALTITUDE_TOGGLE", "FREEZE_ALTITUDE_SET", "FREEZE_ATTITUDE_TOGGLE",
+    "FREEZE_ATTITUDE_SET", "SITUATION_RESET", "SITUATION_SAVE", "ZULU_HOURS_SET", "ZULU_MINUTES_SET", "ZULU_DAY_SET",
+    "ZULU_YEAR_SET", "SOUND_TOGGLE", "SOUND_ON", "SOUND_OFF", "SMOKE_TOGGLE", "SMOKE_ON", "SMOKE_OFF", "SMOKE_SET",
+    "TOGGLE_AIRCRAFT_EXIT", "TOGGLE_JETWAY", "TOGGLE_RAMPTRUCK", "CABIN_SEATBELTS_ALERT_SWITCH_TOGGLE",
+    "CABIN_NO_SMOKING_ALERT_SWITCH_TOGGLE",
+
+    // Failures
+    "TOGGLE_ELECTRICAL_FAILURE", "TOGGLE_VACUUM_FAILURE", "TOGGLE_PITOT_BLOCKAGE", "TOGGLE_STATIC_PORT_BLOCKAGE",
+    "TOGGLE_HYDRAULIC_FAILURE", "TOGGLE_LEFT_BRAKE_FAILURE", "TOGGLE_RIGHT_BRAKE_FAILURE", "TOGGLE_TOTAL_BRAKE_FAILURE",
+    "TOGGLE_ENGINE1_FAILURE", "TOGGLE_ENGINE2_FAILURE", "TOGGLE_ENGINE3_FAILURE", "TOGGLE_ENGINE4_FAILURE",
+});
+
+
+inline constexpr std::size_t count{ names.size() };    ///< The number of Key Events in the catalog.
+inline constexpr EventId firstId{ 0x7F000000 };         ///< The ID of the first catalog entry, well above the dynamically allocated IDs.
+
+
+namespace Detail {
+
+    inline constexpr std::size_t bucketCount{ (count + 3) / 4 };
+    inline constexpr std::size_t slotCount{ 1024 };         // A power of two, at least twice the number of names.
+    static_assert(slotCount >= 2 * count, "The Key Event catalog has outgrown its hash table; increase slotCount.");
+
+    [[nodiscard]]
+    constexpr std::uint64_t hash(std::string_view name) noexcept {
+        std::uint64_t h{ 0xcbf29ce484222325ULL };
+        for (const char c : name) {
+            h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t slot(std::uint64_t h, std::uint16_t displacement) noexcept {
+        h += displacement * 0x9e3779b97f4a7c15ULL;
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<std::size_t>((h ^ (h >> 31)) & (slotCount - 1));
+    }
+
+
+    /**
+     * A hash-and-displace perfect hash table: each name's bucket holds a displacement, chosen so that all names
+     * land in distinct slots.
+     */
+    struct Table {
+        std::array<std::uint16_t, bucketCount> displacements{};
+        std::array<std::uint16_t, slotCount> slots{};           // Catalog index plus one, or zero if empty.
+    };
+
+    /**
+     * Builds the table, placing the largest buckets first. Fails to compile if the catalog contains a duplicate name,
+     * which no displacement can separate.
+     */
+    consteval Table build() {
+        Table table{};
+        std::array<std::uint64_t, count> hashes{};
+        std::array<std::size_t, bucketCount> bucketSizes{};
+        std::size_t largest{ 0 };
+        for (std::size_t i = 0; i < count; ++i) {
+            hashes[i] = hash(names[i]);
+            const auto size = ++bucketSizes[hashes[i] % bucketCount];
+            largest = size > largest ? size : largest;
+        }
+
+        std::array<std::size_t, 16> members{};
+        std::array<std::size_t, 16> memberSlots{};
+        for (std::size_t size = largest; size > 0; --size) {
+            for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                if (bucketSizes[bucket] != size) {
+                    continue;
+                }
+                std::size_t n{ 0 };
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (hashes[i] % bucketCount == bucket) {
+                        members.at(n++) = i;
+                    }
+                }
+                std::uint16_t displacement{ 0 };
+                for (;; ++displacement) {
+                    if (displacement == 0xFFFF) {
+                        throw "Cannot build the Key Event hash table. Is there a duplicate name in the catalog?";
+                    }
+                    bool fits{ true };
+                    for (std::size_t m = 0; fits && m < n; ++m) {
+                        memberSlots[m] = slot(hashes[members[m]], displacement);
+                        fits = table.slots[memberSlots[m]] == 0;
+                        for (std::size_t k = 0; fits && k < m; ++k) {
+                            fits = memberSlots[k] != memberSlots[m];
+                        }
+                    }
+                    if (fits) {
+                        break;
+                    }
+                }
+                table.displacements[bucket] = displacement;
+                for (std::size_t m = 0; m < n; ++m) {
+                    table.slots[memberSlots[m]] = static_cast<std::uint16_t>(members[m] + 1);
+                }
+            }
+        }
+        return table;
+    }
+
+    inline constexpr Table table{ build() };
+
+} // namespace Detail
+
+
+/**
+ * Looks up a Key Event name in the catalog. Names are matched exactly, so they must be in upper case.
+ *
+ * @param name The Key Event name.
+ * @returns The event's fixed client event ID, or std::nullopt if the name is not in the catalog.
+ */
+[[nodiscard]]
+constexpr std::optional<EventId> find(std::string_view name) noexcept {
+    const auto h = Detail::hash(name);
+    const auto index = Detail::table.slots[Detail::slot(h, Detail::table.displacements[h % Detail::bucketCount])];
+    if (index == 0 || names[index - 1] != name) {
+        return std::nullopt;
+    }
+    return firstId + static_cast<EventId>(index - 1);
+}
+
+
+/**
+ * Returns the fixed client event ID of a Key Event as a compile-time constant. Using a name that is not in the
+ * catalog is a compile error.
+ *
+ * @param name The Key Event name.
+ * @returns The event's client event ID.
+ */
+[[nodiscard]]
+consteval EventId id(std::string_view name) {
+    const auto result = find(name);
+    if (!result) {
+        throw "Unknown Key Event name; use Connection::event() for events not in the catalog.";
+    }
+    return *result;
+}
+
+
+/**
+ * Returns true if the ID belongs to a catalog entry.
+ */
+[[nodiscard]]
+constexpr bool contains(EventId id) noexcept {
+    return id >= firstId && id - firstId < count;
+}
+
+
+/**
+ * Returns the catalog index of an ID. Only valid if contains(id) is true.
+ */
+[[nodiscard]]
+constexpr std::size_t indexOf(EventId id) noexcept {
+    return static_cast<std::size_t>(id - firstId);
+}
+
+
+/**
+ * Returns the name of a catalog entry.
+ *
+ * @param id The client event ID.
+ * @returns The Key Event name, or an empty string_view if the ID is not in the catalog.
+ */
+[[nodiscard]]
+constexpr std::string_view name(EventId id) noexcept {
+    return contains(id) ? names[indexOf(id)] : std::string_view{};
+}
+
+} // namespace SimConnect::KeyEvents
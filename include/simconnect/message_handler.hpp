@@ -21,10 +21,12 @@
 #include <array>
 #include <vector>
 #include <utility>
+#include <cstddef>
 #include <functional>
 
 
 #include <simconnect/simconnect.hpp>
+#include <simconnect/connection_metrics.hpp>
 
 #include <simconnect/messaging/message_dispatcher.hpp>
 #include <simconnect/messaging/registration.hpp>
@@ -65,6 +67,7 @@ private:
     std::array<std::tuple<MessageId, handler_id_type>, numIds> registrations_;
     std::map<correlation_id_type, std::tuple<handler_type, bool>> messageHandlers_;
     std::function<void()> cleanup_;
+    MetricGauge* correlationGauge_{ nullptr };  ///< Tracks the size of messageHandlers_, if the connection keeps metrics.
 
     mutex_type mutex_;
 
@@ -76,6 +79,18 @@ private:
     MessageHandler& operator=(MessageHandler&&) = delete;
 
 
+    /**
+     * Adjusts the correlation handler gauge, if the connection keeps metrics.
+     */
+    void countHandlers([[maybe_unused]] std::ptrdiff_t delta) noexcept {
+        if constexpr (MetricsConnection<connection_type>) {
+            if (correlationGauge_ != nullptr && delta != 0) {
+                correlationGauge_->add(delta);
+            }
+        }
+    }
+
+
 protected:
 
     /**
@@ -105,7 +120,7 @@ protected:
             if (remove) {
                 this->logger().debug("Auto-removing correlation ID handler for correlation ID {}", correlationId(msg));
                 std::lock_guard lock(mutex_);
-                messageHandlers_.erase(correlationId(msg));
+                countHandlers(-static_cast<std::ptrdiff_t>(messageHandlers_.erase(correlationId(msg))));
             }
             return true;
         }
@@ -123,6 +138,7 @@ protected:
             cleanup_();
             cleanup_ = nullptr;
 
+            countHandlers(-static_cast<std::ptrdiff_t>(messageHandlers_.size()));
             messageHandlers_.clear();
         }
     }
@@ -184,6 +200,10 @@ public:
         std::lock_guard lock(mutex_);
         size_t regIndex{ 0 };
         (registerFor(regIndex, msgHandler, id), ...);
+        if constexpr (MetricsConnection<connection_type>) {
+            correlationGauge_ = &msgHandler.connection().metrics().correlationHandlers(this->logger().name());
+            countHandlers(static_cast<std::ptrdiff_t>(messageHandlers_.size()));
+        }
         cleanup_ = [this, &msgHandler]() {
             for (const auto& [registrationId, handler] : registrations_) {
                 msgHandler.unRegisterHandler(registrationId, handler);
@@ -207,6 +227,7 @@ public:
 
         if (!messageHandlers_.contains(correlationId)) {
             messageHandlers_.emplace(correlationId, std::make_tuple(handler_type{}, autoRemove));
+            countHandlers(1);
 		}
         return std::get<0>(messageHandlers_[correlationId]).setProc(std::move(correlationHandler));
     }
@@ -229,6 +250,7 @@ public:
             std::get<0>(it->second).clear(handlerId);
             if (!std::get<0>(it->second).hasHandlers()) {
                 messageHandlers_.erase(it);
+                countHandlers(-1);
             }
         }
     }
@@ -244,7 +266,7 @@ public:
     void removeHandler(correlation_id_type correlationId) {
         std::lock_guard lock(mutex_);
 
-        messageHandlers_.erase(correlationId);
+        countHandlers(-static_cast<std::ptrdiff_t>(messageHandlers_.erase(correlationId)));
     }
 
 };
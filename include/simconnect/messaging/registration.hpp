@@ -16,6 +16,7 @@
  */
 
 #include <functional>
+#include <utility>
 
 
 namespace SimConnect {
@@ -78,6 +79,23 @@ public:
     }
 
 
+    /**
+     * Adds a cleanup action that runs after the current one, if any.
+     *
+     * @param cleanup The additional cleanup function.
+     */
+    void addCleanup(std::function<void()> cleanup) {
+        if (!cleanup_) {
+            cleanup_ = std::move(cleanup);
+            return;
+        }
+        cleanup_ = [first = std::move(cleanup_), second = std::move(cleanup)]() {
+            first();
+            second();
+        };
+    }
+
+
     /**
      * Clears the cleanup action, if any. There is no impact on the registered ID.
      */
@@ -0,0 +1,356 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/util/mpmc_queue.hpp>
+#include <simconnect/util/spsc_queue.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * What an OutboundQueue does with a new element when it is full.
+ */
+enum class OverflowPolicy {
+    dropNewest,     ///< Discard the new element.
+    dropOldest,     ///< Discard the oldest queued element to make room. Needs a queue that allows several consumers.
+    block,          ///< Wait until a consumer makes room, or the queue is closed.
+};
+
+
+/**
+ * Configuration for an OutboundQueue.
+ */
+struct OutboundQueueConfig {
+    std::size_t capacity{ 1024 };           ///< The maximum number of queued elements, rounded up to a power of two.
+    OverflowPolicy overflow{ OverflowPolicy::dropNewest };
+};
+
+
+/**
+ * Counters describing an OutboundQueue.
+ */
+struct OutboundQueueStats {
+    std::size_t pushed{ 0 };
+    std::size_t popped{ 0 };
+    std::size_t dropped{ 0 };               ///< Elements discarded because the queue was full.
+    std::size_t blocked{ 0 };               ///< Pushes that had to wait for room.
+    std::size_t depth{ 0 };                 ///< The approximate number of elements queued now.
+    std::size_t maxDepth{ 0 };
+    std::size_t capacity{ 0 };
+
+
+    /**
+     * Returns the current depth as a fraction of the capacity.
+     */
+    [[nodiscard]]
+    double occupancy() const noexcept {
+        return (capacity == 0) ? 0.0 : static_cast<double>(depth) / static_cast<double>(capacity);
+    }
+};
+
+
+/**
+ * A bounded queue that carries decoded data from the thread dispatching SimConnect messages to consumer threads.
+ *
+ * Handlers run on the dispatching thread, such as BackgroundSimConnectManager's worker thread, and push the structs
+ * they decoded. Consumers poll with tryPop() or wait with pop(), on their own schedule and without sharing a lock
+ * with the handlers. Pushing and popping are lock-free; the mutex is only taken when a thread actually has to wait.
+ *
+ * @code
+ * SpscOutboundQueue<Position> positions({ .capacity = 256, .overflow = OverflowPolicy::dropNewest });
+ *
+ * manager.simConnectHandler().registerHandler(Messages::simObjectData, [&](const Messages::MsgBase& msg) {
+ *     positions.push(decode(msg));         // Worker thread
+ * });
+ *
+ * while (auto position = positions.pop(100ms)) {   // Consumer thread
+ *     render(*position);
+ * }
+ * @endcode
+ *
+ * @tparam T The element type, which must be default constructible and move assignable.
+ * @tparam Q The lock-free ring to use, SpscQueue<T> or MpmcQueue<T>.
+ */
+template <class T, class Q = SpscQueue<T>>
+class OutboundQueue {
+public:
+    using value_type = T;
+    using queue_type = Q;
+
+
+private:
+    Q queue_;
+    OverflowPolicy overflow_;
+
+    std::atomic<bool> closed_{ false };
+    std::atomic<std::size_t> waitingConsumers_{ 0 };
+    std::atomic<std::size_t> waitingProducers_{ 0 };
+    std::mutex waitMutex_;
+    std::condition_variable dataAvailable_;
+    std::condition_variable spaceAvailable_;
+
+    std::atomic<std::size_t> pushed_{ 0 };
+    std::atomic<std::size_t> popped_{ 0 };
+    std::atomic<std::size_t> dropped_{ 0 };
+    std::atomic<std::size_t> blocked_{ 0 };
+    std::atomic<std::size_t> maxDepth_{ 0 };
+
+
+    /**
+     * Wakes the threads waiting on the given condition, if there are any. The fence pairs with the one in waitFor(),
+     * so either the waiter sees the change or we see the waiter.
+     */
+    void wake(std::atomic<std::size_t>& waiters, std::condition_variable& condition) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) > 0) {
+            { std::lock_guard lock(waitMutex_); }
+            condition.notify_all();
+        }
+    }
+
+
+    template <class Pred>
+    bool waitFor(std::atomic<std::size_t>& waiters, std::condition_variable& condition, std::chrono::milliseconds timeout, Pred ready) {
+        waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::unique_lock lock(waitMutex_);
+        const bool result = condition.wait_for(lock, timeout, ready);
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+
+    void pushed() {
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        const auto depth = queue_.sizeApprox();
+        auto max = maxDepth_.load(std::memory_order_relaxed);
+        while (depth > max && !maxDepth_.compare_exchange_weak(max, depth, std::memory_order_relaxed)) {
+        }
+        wake(waitingConsumers_, dataAvailable_);
+    }
+
+
+    std::optional<T> popped(std::optional<T> value) {
+        if (value) {
+            popped_.fetch_add(1, std::memory_order_relaxed);
+            wake(waitingProducers_, spaceAvailable_);
+        }
+        return value;
+    }
+
+
+public:
+    /**
+     * Creates a queue.
+     *
+     * @param config The capacity and overflow policy.
+     * @throws SimConnectException if OverflowPolicy::dropOldest is asked of a single-consumer queue.
+     */
+    explicit OutboundQueue(OutboundQueueConfig config = {})
+        : queue_(config.capacity), overflow_(config.overflow)
+    {
+        if (overflow_ == OverflowPolicy::dropOldest && !Q::multiConsumer) {
+            throw SimConnectException("OverflowPolicy::dropOldest needs a multi-consumer queue, such as MpmcOutboundQueue.");
+        }
+    }
+
+    // No copies or moves
+    OutboundQueue(const OutboundQueue&) = delete;
+    OutboundQueue(OutboundQueue&&) = delete;
+    OutboundQueue& operator=(const OutboundQueue&) = delete;
+    OutboundQueue& operator=(OutboundQueue&&) = delete;
+    ~OutboundQueue() = default;
+
+
+    /**
+     * Adds an element, applying the overflow policy if the queue is full.
+     *
+     * @note With OverflowPolicy::block this stalls the calling thread, and so the dispatching of all messages if
+     *       called from a handler, until a consumer catches up.
+     * @param value The element to add.
+     * @returns true if the element was queued, false if it was dropped or the queue is closed.
+     */
+    bool push(T value) {
+        if (closed_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (queue_.tryPush(value)) {
+            pushed();
+            return true;
+        }
+        switch (overflow_) {
+        case OverflowPolicy::dropNewest:
+            break;
+
+        case OverflowPolicy::dropOldest:
+            while (!queue_.tryPush(value)) {
+                if (queue_.tryPop()) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            pushed();
+            return true;
+
+        case OverflowPolicy::block:
+            blocked_.fetch_add(1, std::memory_order_relaxed);
+            while (!queue_.tryPush(value)) {
+                waitFor(waitingProducers_, spaceAvailable_, std::chrono::milliseconds(100), [this] {
+                    return closed_.load(std::memory_order_acquire) || queue_.sizeApprox() < queue_.capacity();
+                });
+                if (closed_.load(std::memory_order_acquire)) {
+                    return false;
+                }
+            }
+            pushed();
+            return true;
+        }
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+
+    /**
+     * Removes the oldest element without waiting.
+     *
+     * @returns The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<T> tryPop() {
+        return popped(queue_.tryPop());
+    }
+
+
+    /**
+     * Removes the oldest element, waiting until one is available, the timeout expires, or the queue is closed.
+     *
+     * @param timeout The maximum time to wait.
+     * @returns The element, or std::nullopt on timeout or once a closed queue is empty.
+     */
+    std::optional<T> pop(std::chrono::milliseconds timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (;;) {
+            if (auto value = queue_.tryPop()) {
+                return popped(std::move(value));
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline || closed_.load(std::memory_order_acquire)) {
+                return std::nullopt;
+            }
+            waitFor(waitingConsumers_, dataAvailable_, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1), [this] {
+                return closed_.load(std::memory_order_acquire) || queue_.sizeApprox() > 0;
+            });
+        }
+    }
+
+
+    /**
+     * Removes queued elements without waiting, passing each to a function.
+     *
+     * @param consumer The function to call for each element.
+     * @param maxElements The maximum number of elements to remove.
+     * @returns The number of elements removed.
+     */
+    template <class F>
+    std::size_t drain(F&& consumer, std::size_t maxElements = std::numeric_limits<std::size_t>::max()) {
+        std::size_t count{ 0 };
+        while (count < maxElements) {
+            auto value = tryPop();
+            if (!value) {
+                break;
+            }
+            consumer(std::move(*value));
+            ++count;
+        }
+        return count;
+    }
+
+
+    /**
+     * Closes the queue: further pushes are refused, and all waiting threads wake up. Consumers can still pop what is
+     * left.
+     */
+    void close() {
+        closed_.store(true, std::memory_order_release);
+        {
+            std::lock_guard lock(waitMutex_);
+        }
+        dataAvailable_.notify_all();
+        spaceAvailable_.notify_all();
+    }
+
+
+    [[nodiscard]]
+    bool closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+
+    /**
+     * Returns the approximate number of queued elements.
+     */
+    [[nodiscard]]
+    std::size_t depth() const noexcept { return queue_.sizeApprox(); }
+
+
+    [[nodiscard]]
+    std::size_t capacity() const noexcept { return queue_.capacity(); }
+
+
+    [[nodiscard]]
+    OverflowPolicy overflow() const noexcept { return overflow_; }
+
+
+    /**
+     * Returns a snapshot of the queue's counters. Safe to call from any thread.
+     */
+    [[nodiscard]]
+    OutboundQueueStats stats() const noexcept {
+        return OutboundQueueStats{
+            .pushed = pushed_.load(std::memory_order_relaxed),
+            .popped = popped_.load(std::memory_order_relaxed),
+            .dropped = dropped_.load(std::memory_order_relaxed),
+            .blocked = blocked_.load(std::memory_order_relaxed),
+            .depth = queue_.sizeApprox(),
+            .maxDepth = maxDepth_.load(std::memory_order_relaxed),
+            .capacity = queue_.capacity(),
+        };
+    }
+};
+
+
+/**
+ * An OutboundQueue for one producer thread and one consumer thread.
+ */
+template <class T>
+using SpscOutboundQueue = OutboundQueue<T, SpscQueue<T>>;
+
+/**
+ * An OutboundQueue that any number of threads may push to and pop from.
+ */
+template <class T>
+using MpmcOutboundQueue = OutboundQueue<T, MpmcQueue<T>>;
+
+} // namespace SimConnect
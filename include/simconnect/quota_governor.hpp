@@ -0,0 +1,478 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/data/client_data_definitions.hpp>
+#include <simconnect/data/data_definitions.hpp>
+#include <simconnect/requests/request.hpp>
+#include <simconnect/requests/requests.hpp>
+#include <simconnect/util/scope_exit.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * The per-client resources SimConnect limits.
+ */
+enum class Quota : std::size_t {
+    requests,
+    dataDefinitions,
+    clientDataDefinitions,
+    groups,                 ///< Notification and input groups together.
+};
+
+inline constexpr std::size_t quotaCount{ 4 };
+
+
+/**
+ * The limits a QuotaGovernor enforces. The defaults are SimConnect's own limits, as reported in its exceptions.
+ */
+struct QuotaLimits {
+    std::size_t requests{ 1000 };
+    std::size_t dataDefinitions{ 1000 };
+    std::size_t clientDataDefinitions{ 1000 };
+    std::size_t groups{ 20 };
+    double admissionThreshold{ 0.95 };      ///< The fraction of a limit above which new requests are queued instead of started.
+    std::size_t maxQueued{ 10000 };         ///< The maximum number of queued requests; beyond this submit() rejects.
+};
+
+
+/**
+ * What submit() did with a request.
+ */
+enum class Admission {
+    started,                ///< The request was started immediately.
+    queued,                 ///< The request waits for capacity, and will be started by a pump() once there is room.
+    rejected,               ///< The queue is full; the request was dropped.
+};
+
+
+/**
+ * Counters describing a QuotaGovernor.
+ */
+struct QuotaStats {
+    std::array<std::size_t, quotaCount> inUse{};
+    std::array<std::size_t, quotaCount> peak{};
+    std::size_t queued{ 0 };
+    std::size_t started{ 0 };
+    std::size_t deferred{ 0 };              ///< Requests that were queued before they started.
+    std::size_t rejected{ 0 };
+    std::size_t refused{ 0 };               ///< Definition or group allocations refused at the limit.
+    std::chrono::microseconds maxQueueWait{ 0 };
+
+
+    [[nodiscard]]
+    std::size_t inUseOf(Quota quota) const noexcept { return inUse[static_cast<std::size_t>(quota)]; }
+};
+
+
+class QuotaGovernor;
+
+
+/**
+ * A unit of a quota, such as one data definition ID, held until the lease is destroyed.
+ */
+class QuotaLease {
+    QuotaGovernor* governor_{ nullptr };
+    Quota quota_{ Quota::requests };
+    unsigned long id_{ unused };
+
+    friend class QuotaGovernor;
+
+    QuotaLease(QuotaGovernor& governor, Quota quota, unsigned long id) : governor_(&governor), quota_(quota), id_(id) {}
+
+public:
+    QuotaLease() = default;
+
+    QuotaLease(const QuotaLease&) = delete;
+    QuotaLease& operator=(const QuotaLease&) = delete;
+
+    QuotaLease(QuotaLease&& other) noexcept
+        : governor_(std::exchange(other.governor_, nullptr)), quota_(other.quota_), id_(other.id_) {}
+
+    QuotaLease& operator=(QuotaLease&& other) {
+        if (this != &other) {
+            release();
+            governor_ = std::exchange(other.governor_, nullptr);
+            quota_ = other.quota_;
+            id_ = other.id_;
+        }
+        return *this;
+    }
+
+    ~QuotaLease() { release(); }
+
+
+    /**
+     * Returns the ID allocated with the lease, or unused if the lease was not tied to an ID.
+     */
+    [[nodiscard]]
+    unsigned long id() const noexcept { return id_; }
+
+    [[nodiscard]]
+    Quota quota() const noexcept { return quota_; }
+
+    [[nodiscard]]
+    bool held() const noexcept { return governor_ != nullptr; }
+
+
+    /**
+     * Gives the unit back early. Safe to call more than once.
+     */
+    inline void release();
+};
+
+
+/**
+ * Admission control for SimConnect's per-client limits.
+ *
+ * SimConnect refuses requests, definitions, and groups beyond its limits with an exception, and the data is lost.
+ * The governor counts what is live and keeps below the limits:
+ *
+ * - Requests are started through submit(). Below the admission threshold they start immediately, above it they are
+ *   queued by priority, with a queue per quota, so a full quota does not hold up requests against another one. The
+ *   returned Request is given a cleanup action, so destroying or stopping it gives its slot back.
+ * - Data definitions, client data definitions, and groups are long-lived, so they are not queued: allocate() and
+ *   acquire() return a QuotaLease, or nothing at the limit.
+ *
+ * Giving a slot back never starts anything, because that happens in destructors, often while the container holding
+ * the Requests is being changed. Queued requests are started by pump(), which is best called on the thread
+ * dispatching messages, after each dispatch. The governor must outlive all leases and Requests it has handed out.
+ */
+class QuotaGovernor {
+public:
+    using start_type = std::function<Request()>;
+    using started_type = std::function<void(Request)>;
+    using clock_type = std::chrono::steady_clock;
+
+
+private:
+    struct Pending {
+        int priority;
+        std::uint64_t sequence;
+        start_type start;
+        started_type onStarted;
+        clock_type::time_point queuedAt;
+    };
+
+    struct ByPriority {
+        bool operator()(const Pending& a, const Pending& b) const noexcept {
+            return (a.priority != b.priority) ? (a.priority < b.priority) : (a.sequence > b.sequence);
+        }
+    };
+
+    QuotaLimits limits_;
+
+    mutable std::mutex mutex_;
+    std::array<std::size_t, quotaCount> inUse_{};
+    std::array<std::size_t, quotaCount> peak_{};
+    std::array<std::priority_queue<Pending, std::vector<Pending>, ByPriority>, quotaCount> queues_;
+    std::size_t queued_{ 0 };               ///< The requests in all queues.
+    std::uint64_t sequence_{ 0 };
+    bool pumping_{ false };
+
+    std::size_t started_{ 0 };
+    std::size_t deferred_{ 0 };
+    std::size_t rejected_{ 0 };
+    std::size_t refused_{ 0 };
+    std::chrono::microseconds maxQueueWait_{ 0 };
+
+    friend class QuotaLease;
+
+
+    [[nodiscard]]
+    std::size_t limitOf(Quota quota) const noexcept {
+        switch (quota) {
+        case Quota::requests: return limits_.requests;
+        case Quota::dataDefinitions: return limits_.dataDefinitions;
+        case Quota::clientDataDefinitions: return limits_.clientDataDefinitions;
+        case Quota::groups: return limits_.groups;
+        }
+        return 0;
+    }
+
+
+    [[nodiscard]]
+    std::size_t admissionLimitOf(Quota quota) const noexcept {
+        const auto limit = limitOf(quota);
+        const auto threshold = static_cast<std::size_t>(static_cast<double>(limit) * limits_.admissionThreshold);
+        return (threshold == 0) ? 1 : threshold;
+    }
+
+
+    /**
+     * Takes a unit of the given quota, if it is below the limit.
+     *
+     * @pre The mutex must be locked.
+     */
+    bool take(Quota quota, std::size_t limit) noexcept {
+        auto& used = inUse_[static_cast<std::size_t>(quota)];
+        if (used >= limit) {
+            return false;
+        }
+        ++used;
+        auto& peak = peak_[static_cast<std::size_t>(quota)];
+        peak = (used > peak) ? used : peak;
+        return true;
+    }
+
+
+    /**
+     * Returns a unit of the given quota. Queued requests wait for the next pump().
+     */
+    void release(Quota quota) {
+        std::lock_guard lock(mutex_);
+        auto& used = inUse_[static_cast<std::size_t>(quota)];
+        if (used > 0) {
+            --used;
+        }
+    }
+
+
+    /**
+     * Starts a request for which a unit of the quota was taken. If startFn throws, the unit is given back before the
+     * exception is passed on, since there is no Request to release it.
+     */
+    void start(Quota quota, start_type& startFn, started_type& onStarted) {
+        ScopeExit failed([this, quota]() { release(quota); });
+        Request request = startFn();
+        request.addCleanup([this, quota]() { release(quota); });
+        failed.release();
+        if (onStarted) {
+            onStarted(std::move(request));
+        }
+    }
+
+
+
+public:
+    explicit QuotaGovernor(QuotaLimits limits = {}) : limits_(limits) {}
+
+    // No copies or moves
+    QuotaGovernor(const QuotaGovernor&) = delete;
+    QuotaGovernor(QuotaGovernor&&) = delete;
+    QuotaGovernor& operator=(const QuotaGovernor&) = delete;
+    QuotaGovernor& operator=(QuotaGovernor&&) = delete;
+    ~QuotaGovernor() = default;
+
+
+    [[nodiscard]]
+    const QuotaLimits& limits() const noexcept { return limits_; }
+
+
+    /**
+     * Starts queued requests while their quota has room. Call it on the thread dispatching messages, for example after
+     * each dispatch; it is cheap when nothing is queued. Only one thread pumps at a time, and a pump() from a callback
+     * of a request it starts returns straight away, as the running loop picks up any room that was made. If a request
+     * fails to start, its slot is given back and the exception is passed on; the requests behind it stay queued.
+     *
+     * @returns The number of requests started.
+     */
+    std::size_t pump() {
+        std::unique_lock lock(mutex_);
+        if (pumping_) {
+            return 0;
+        }
+        pumping_ = true;
+        ScopeExit done([this, &lock]() {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            pumping_ = false;
+        });
+        std::size_t count{ 0 };
+        for (std::size_t index = 0; index < quotaCount; ++index) {
+            const auto quota = static_cast<Quota>(index);
+            auto& queue = queues_[index];
+            while (!queue.empty() && take(quota, admissionLimitOf(quota))) {
+                auto pending = std::move(const_cast<Pending&>(queue.top()));
+                queue.pop();
+                --queued_;
+                ++started_;
+                const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - pending.queuedAt);
+                maxQueueWait_ = (waited > maxQueueWait_) ? waited : maxQueueWait_;
+
+                lock.unlock();
+                start(quota, pending.start, pending.onStarted);
+                lock.lock();
+                ++count;
+            }
+        }
+        return count;
+    }
+
+
+    /**
+     * Starts a request now if there is room, or queues it.
+     *
+     * @code
+     * governor.submit([&] { return facilities.requestFacilityData(...); },
+     *                 [&](Request request) { running.push_back(std::move(request)); },
+     *                 priority);
+     * @endcode
+     *
+     * @param startFn Starts the request and returns its Request.
+     * @param onStarted Receives the Request once started; keep it for as long as the request should run. Called on the
+     *                  submitting thread if started immediately, otherwise on the thread calling pump().
+     * @param priority Queued requests with a higher priority start first; equal priorities start in submission order.
+     *                 Only requests against the same quota are ordered.
+     * @param quota The quota the request counts against.
+     * @returns What happened to the request.
+     */
+    Admission submit(start_type startFn, started_type onStarted, int priority = 0, Quota quota = Quota::requests) {
+        {
+            std::lock_guard lock(mutex_);
+            auto& queue = queues_[static_cast<std::size_t>(quota)];
+            if (!queue.empty() || !take(quota, admissionLimitOf(quota))) {
+                if (queued_ >= limits_.maxQueued) {
+                    ++rejected_;
+                    return Admission::rejected;
+                }
+                queue.push(Pending{ priority, sequence_++, std::move(startFn), std::move(onStarted), clock_type::now() });
+                ++queued_;
+                ++deferred_;
+                return Admission::queued;
+            }
+            ++started_;
+        }
+        start(quota, startFn, onStarted);
+        return Admission::started;
+    }
+
+
+    /**
+     * Takes a unit of a quota without allocating an ID, such as for a group.
+     *
+     * @param quota The quota.
+     * @returns The lease, or std::nullopt if the quota is at its limit.
+     */
+    [[nodiscard]]
+    std::optional<QuotaLease> acquire(Quota quota, unsigned long id = unused) {
+        std::lock_guard lock(mutex_);
+        if (!take(quota, limitOf(quota))) {
+            ++refused_;
+            return std::nullopt;
+        }
+        return QuotaLease(*this, quota, id);
+    }
+
+
+    /**
+     * Allocates a data definition ID, if the limit allows it.
+     *
+     * @param definitions The connection's data definition ID allocator.
+     * @returns The lease, holding the new ID, or std::nullopt at the limit.
+     */
+    [[nodiscard]]
+    std::optional<QuotaLease> allocate(DataDefinitions& definitions) {
+        auto lease = acquire(Quota::dataDefinitions);
+        if (lease) {
+            lease->id_ = static_cast<unsigned long>(definitions.nextDataDefID());
+        }
+        return lease;
+    }
+
+
+    /**
+     * Allocates a client data definition ID, if the limit allows it.
+     *
+     * @param definitions The connection's client data definition ID allocator.
+     * @returns The lease, holding the new ID, or std::nullopt at the limit.
+     */
+    [[nodiscard]]
+    std::optional<QuotaLease> allocate(ClientDataDefinitions& definitions) {
+        auto lease = acquire(Quota::clientDataDefinitions);
+        if (lease) {
+            lease->id_ = static_cast<unsigned long>(definitions.nextDataDefID());
+        }
+        return lease;
+    }
+
+
+    /**
+     * Drops all queued requests without starting them.
+     *
+     * @returns The number of requests dropped.
+     */
+    std::size_t clearQueue() {
+        std::lock_guard lock(mutex_);
+        const auto count = queued_;
+        queues_ = {};
+        queued_ = 0;
+        return count;
+    }
+
+
+    /**
+     * Returns the number of units of a quota in use.
+     */
+    [[nodiscard]]
+    std::size_t inUse(Quota quota) const {
+        std::lock_guard lock(mutex_);
+        return inUse_[static_cast<std::size_t>(quota)];
+    }
+
+
+    /**
+     * Returns the number of units of a quota still available before its hard limit.
+     */
+    [[nodiscard]]
+    std::size_t available(Quota quota) const {
+        std::lock_guard lock(mutex_);
+        const auto used = inUse_[static_cast<std::size_t>(quota)];
+        const auto limit = limitOf(quota);
+        return (used < limit) ? (limit - used) : 0;
+    }
+
+
+    [[nodiscard]]
+    QuotaStats stats() const {
+        std::lock_guard lock(mutex_);
+        return QuotaStats{
+            .inUse = inUse_,
+            .peak = peak_,
+            .queued = queued_,
+            .started = started_,
+            .deferred = deferred_,
+            .rejected = rejected_,
+            .refused = refused_,
+            .maxQueueWait = maxQueueWait_,
+        };
+    }
+};
+
+
+inline void QuotaLease::release() {
+    if (auto* governor = std::exchange(governor_, nullptr)) {
+        governor->release(quota_);
+    }
+}
+
+} // namespace SimConnect
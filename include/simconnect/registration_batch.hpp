@@ -0,0 +1,272 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <simconnect.hpp>
+#include <simconnect/simconnect.hpp>
+#include <simconnect/events/events.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A batch of registration calls: event mappings and data, client data, and facility definition items.
+ *
+ * The calls are queued here and submitted with Connection::submit(), which takes the connection's lock once for the
+ * whole batch instead of once per call. Each submitted entry records its result and SendId, so that an
+ * ExceptionMsg arriving later can be traced back to the entry that caused it with find().
+ *
+ * A batch can be submitted more than once; each submit() only sends the entries added since the previous one.
+ */
+class RegistrationBatch {
+public:
+    enum class Kind {
+        mapClientEvent,
+        dataDefinition,
+        clientDataDefinition,
+        facilityDefinition,
+    };
+
+    /**
+     * A single queued registration call.
+     */
+    struct Entry {
+        Kind kind;
+        unsigned long id{ 0 };              ///< The event, data definition, client data definition, or facility definition ID.
+        std::string name{};                 ///< The event name, simulation variable, or facility field. Empty for client data.
+        std::string units{};                ///< The simulation variable's units, for data definitions.
+        DataType dataType{ DataTypes::float64 };   ///< The data type, for data definitions.
+        unsigned long sizeOrType{ 0 };      ///< The size in bytes or ClientDataType, for client data definitions.
+        std::size_t offset{ clientDataAutoOffset }; ///< The offset, for client data definitions.
+        float epsilon{ 0.0f };
+        unsigned long datumId{ unused };
+
+        HRESULT result{ S_OK };             ///< The result of the SimConnect call, once submitted.
+        SendId sendId{ noId };              ///< The SendId of the call, or noId if it failed or was skipped.
+
+
+        /**
+         * Returns true if the call was sent to the simulator.
+         */
+        [[nodiscard]]
+        bool sent() const noexcept { return sendId != noId; }
+
+
+        /**
+         * Returns a short description of the call, for logging.
+         */
+        [[nodiscard]]
+        std::string describe() const {
+            switch (kind) {
+            case Kind::mapClientEvent:
+                return std::format("mapClientEvent(id={}, '{}')", id, name);
+            case Kind::dataDefinition:
+                return std::format("addDataDefinition(def={}, '{}', '{}')", id, name, units);
+            case Kind::clientDataDefinition:
+                return std::format("addClientDataDefinition(def={}, offset={}, sizeOrType={})", id, offset, sizeOrType);
+            case Kind::facilityDefinition:
+                return std::format("addToFacilityDefinition(def={}, '{}')", id, name);
+            }
+            return "unknown";
+        }
+    };
+
+
+private:
+    std::vector<Entry> entries_;
+    std::vector<std::pair<SendId, std::size_t>> sendIndex_;  ///< SendIds of sent entries, in ascending order.
+    std::size_t submitted_{ 0 };
+    std::size_t failed_{ 0 };
+
+    template <class D, bool TS, class L, bool TM, bool M> friend class Connection;
+
+
+    /**
+     * Returns the entries not yet submitted.
+     */
+    std::span<Entry> unsubmitted() noexcept {
+        return std::span<Entry>(entries_).subspan(submitted_);
+    }
+
+
+    /**
+     * Records the outcome of the next unsubmitted entry.
+     */
+    void record(HRESULT result, SendId sendId) {
+        auto& entry = entries_[submitted_];
+        entry.result = result;
+        entry.sendId = sendId;
+        if (FAILED(result)) {
+            ++failed_;
+        } else if (sendId != noId) {
+            sendIndex_.emplace_back(sendId, submitted_);
+        }
+        ++submitted_;
+    }
+
+
+    RegistrationBatch& add(Entry entry) {
+        entries_.push_back(std::move(entry));
+        return *this;
+    }
+
+
+public:
+    RegistrationBatch() = default;
+
+    /**
+     * Creates an empty batch with room for the given number of entries.
+     */
+    explicit RegistrationBatch(std::size_t capacity) {
+        entries_.reserve(capacity);
+        sendIndex_.reserve(capacity);
+    }
+
+
+    /**
+     * Queues mapping a client event to the simulator event of the same name.
+     */
+    RegistrationBatch& mapClientEvent(const SimConnect::event& evt) {
+        return add({ .kind = Kind::mapClientEvent, .id = evt.id(), .name = evt.name() });
+    }
+
+
+    /**
+     * Queues adding a simulation variable to a data definition.
+     */
+    RegistrationBatch& addDataDefinition(DataDefinitionId dataDef, std::string_view itemName, std::string_view itemUnits,
+                                         DataType itemDataType, float itemEpsilon = 0.0f, unsigned long itemDatumId = unused) {
+        return add({ .kind = Kind::dataDefinition, .id = dataDef, .name = std::string(itemName), .units = std::string(itemUnits),
+                     .dataType = itemDataType, .epsilon = itemEpsilon, .datumId = itemDatumId });
+    }
+
+
+    /**
+     * Queues adding a raw item of the given size to a client data definition.
+     */
+    RegistrationBatch& addClientDataDefinition(ClientDataDefinitionId defId, std::size_t size,
+                                               std::size_t offset = clientDataAutoOffset, unsigned long itemDatumId = unused) {
+        return add({ .kind = Kind::clientDataDefinition, .id = defId, .sizeOrType = static_cast<unsigned long>(size),
+                     .offset = offset, .datumId = itemDatumId });
+    }
+
+
+    /**
+     * Queues adding a typed item to a client data definition.
+     */
+    RegistrationBatch& addClientDataDefinition(ClientDataDefinitionId defId, ClientDataType type,
+                                               std::size_t offset = clientDataAutoOffset, float epsilon = 0.0f, unsigned long itemDatumId = unused) {
+        return add({ .kind = Kind::clientDataDefinition, .id = defId, .sizeOrType = static_cast<unsigned long>(type),
+                     .offset = offset, .epsilon = epsilon, .datumId = itemDatumId });
+    }
+
+
+    /**
+     * Queues adding a field to a facility definition.
+     */
+    RegistrationBatch& addToFacilityDefinition(FacilityDefinitionId facilityDefId, std::string_view fieldName) {
+        return add({ .kind = Kind::facilityDefinition, .id = facilityDefId, .name = std::string(fieldName) });
+    }
+
+
+    /**
+     * Returns all entries, in the order they were queued.
+     */
+    [[nodiscard]]
+    std::span<const Entry> entries() const noexcept { return entries_; }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    [[nodiscard]]
+    bool empty() const noexcept { return entries_.empty(); }
+
+    /**
+     * Returns the number of entries not yet submitted.
+     */
+    [[nodiscard]]
+    std::size_t pending() const noexcept { return entries_.size() - submitted_; }
+
+    /**
+     * Returns the number of submitted entries whose SimConnect call failed immediately.
+     */
+    [[nodiscard]]
+    std::size_t failed() const noexcept { return failed_; }
+
+
+    /**
+     * Finds the entry that was sent with the given SendId.
+     *
+     * @param sendId The SendId, usually ExceptionMsg::dwSendID.
+     * @returns The entry, or nullptr if no entry of this batch was sent with that SendId.
+     */
+    [[nodiscard]]
+    const Entry* find(SendId sendId) const noexcept {
+        auto it = std::lower_bound(sendIndex_.begin(), sendIndex_.end(), sendId,
+                                   [](const auto& sent, SendId id) { return sent.first < id; });
+        return (it != sendIndex_.end() && it->first == sendId) ? &entries_[it->second] : nullptr;
+    }
+
+
+    /**
+     * Finds the entry an exception refers to.
+     *
+     * @param msg The exception message.
+     * @returns The entry, or nullptr if the exception is not about an entry of this batch.
+     */
+    [[nodiscard]]
+    const Entry* find(const Messages::ExceptionMsg& msg) const noexcept {
+        return find(static_cast<SendId>(msg.dwSendID));
+    }
+
+
+    /**
+     * Marks all entries as not yet submitted, so the next submit() sends the whole batch again, for example on a new
+     * connection. The results of the previous submission are forgotten.
+     */
+    void rewind() noexcept {
+        for (auto& entry : entries_) {
+            entry.result = S_OK;
+            entry.sendId = noId;
+        }
+        sendIndex_.clear();
+        submitted_ = 0;
+        failed_ = 0;
+    }
+
+
+    /**
+     * Removes all entries.
+     */
+    void clear() noexcept {
+        entries_.clear();
+        sendIndex_.clear();
+        submitted_ = 0;
+        failed_ = 0;
+    }
+};
+
+} // namespace SimConnect
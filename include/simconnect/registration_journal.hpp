@@ -0,0 +1,300 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/registration_batch.hpp>
+#include <simconnect/events/events.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Counters describing a RegistrationJournal.
+ */
+struct RegistrationJournalStats {
+    std::size_t registrations{ 0 };         ///< Registrations in the journal.
+    std::size_t actions{ 0 };               ///< Other calls in the journal, such as long-lived requests.
+    std::size_t replays{ 0 };               ///< Number of times the journal was replayed on a new connection.
+    std::size_t lastReplayFailures{ 0 };    ///< Registrations that failed during the last replay.
+    std::chrono::microseconds lastReplayDuration{ 0 };
+};
+
+
+/**
+ * A journal of the registrations and long-lived requests a client needs, so they can be restored after reconnecting.
+ *
+ * A SimConnect client loses all its definitions, event mappings, and requests when the simulator restarts. Consumers
+ * record them here once. apply() sends whatever is new to an open connection, and replay() sends everything again
+ * on a fresh connection. Registrations are kept as a RegistrationBatch and sent under a single lock; actions
+ * (arbitrary calls, such as a periodic data request) follow in the order they were added.
+ *
+ * Recording is safe from any thread. apply() and replay() must be called from the thread that dispatches messages for
+ * the connection. They send the registrations under the journal's lock, but run the actions after releasing it, so an
+ * action may itself add to or remove from the journal.
+ *
+ * @tparam C The connection type.
+ */
+template <class C>
+class RegistrationJournal {
+public:
+    using connection_type = C;
+    using action_type = std::function<void(C&)>;
+    using ActionId = std::uint64_t;
+
+
+private:
+    struct Action {
+        ActionId id;
+        std::string description;
+        action_type call;
+    };
+
+    mutable std::mutex mutex_;
+    RegistrationBatch registrations_;
+    std::vector<Action> actions_;
+    std::size_t appliedActions_{ 0 };       ///< Actions already sent on the current connection.
+    ActionId nextActionId_{ 1 };
+
+    std::size_t replays_{ 0 };
+    std::size_t lastReplayFailures_{ 0 };
+    std::chrono::microseconds lastReplayDuration_{ 0 };
+
+
+    /**
+     * Sends the pending registrations and returns the calls of the pending actions, marking them as applied.
+     * Requires the mutex to be held; the returned calls must be run after releasing it.
+     */
+    [[nodiscard]]
+    std::vector<action_type> sendRegistrations(C& connection) {
+        connection.submit(registrations_);
+
+        std::vector<action_type> calls;
+        calls.reserve(actions_.size() - appliedActions_);
+        for (; appliedActions_ < actions_.size(); ++appliedActions_) {
+            calls.push_back(actions_[appliedActions_].call);
+        }
+        return calls;
+    }
+
+
+    static void runActions(const std::vector<action_type>& calls, C& connection) {
+        for (const auto& call : calls) {
+            call(connection);
+        }
+    }
+
+
+public:
+    RegistrationJournal() = default;
+
+    // No copies or moves
+    RegistrationJournal(const RegistrationJournal&) = delete;
+    RegistrationJournal(RegistrationJournal&&) = delete;
+    RegistrationJournal& operator=(const RegistrationJournal&) = delete;
+    RegistrationJournal& operator=(RegistrationJournal&&) = delete;
+    ~RegistrationJournal() = default;
+
+
+    RegistrationJournal& mapClientEvent(const event& evt) {
+        std::lock_guard lock(mutex_);
+        registrations_.mapClientEvent(evt);
+        return *this;
+    }
+
+    RegistrationJournal& addDataDefinition(DataDefinitionId dataDef, std::string_view itemName, std::string_view itemUnits,
+                                           DataType itemDataType, float itemEpsilon = 0.0f, unsigned long itemDatumId = unused) {
+        std::lock_guard lock(mutex_);
+        registrations_.addDataDefinition(dataDef, itemName, itemUnits, itemDataType, itemEpsilon, itemDatumId);
+        return *this;
+    }
+
+    RegistrationJournal& addClientDataDefinition(ClientDataDefinitionId defId, std::size_t size,
+                                                 std::size_t offset = clientDataAutoOffset, unsigned long itemDatumId = unused) {
+        std::lock_guard lock(mutex_);
+        registrations_.addClientDataDefinition(defId, size, offset, itemDatumId);
+        return *this;
+    }
+
+    RegistrationJournal& addClientDataDefinition(ClientDataDefinitionId defId, ClientDataType type,
+                                                 std::size_t offset = clientDataAutoOffset, float epsilon = 0.0f, unsigned long itemDatumId = unused) {
+        std::lock_guard lock(mutex_);
+        registrations_.addClientDataDefinition(defId, type, offset, epsilon, itemDatumId);
+        return *this;
+    }
+
+    RegistrationJournal& addToFacilityDefinition(FacilityDefinitionId facilityDefId, std::string_view fieldName) {
+        std::lock_guard lock(mutex_);
+        registrations_.addToFacilityDefinition(facilityDefId, fieldName);
+        return *this;
+    }
+
+
+    /**
+     * Records a call that is not a plain registration, such as mapping a client data name or starting a periodic data
+     * request. Actions are sent after all registrations, in the order they were added.
+     *
+     * @param description A short description, for logging.
+     * @param call The call to make on the connection.
+     * @returns An ID that can be passed to remove() once the call no longer needs to be restored.
+     */
+    ActionId add(std::string description, action_type call) {
+        std::lock_guard lock(mutex_);
+        const auto id = nextActionId_++;
+        actions_.push_back(Action{ id, std::move(description), std::move(call) });
+        return id;
+    }
+
+
+    /**
+     * Removes an action, so it is not sent again on the next replay.
+     *
+     * @param id The ID returned by add().
+     * @returns true if the action was found.
+     */
+    bool remove(ActionId id) {
+        std::lock_guard lock(mutex_);
+        auto it = std::find_if(actions_.begin(), actions_.end(), [id](const Action& action) { return action.id == id; });
+        if (it == actions_.end()) {
+            return false;
+        }
+        if (static_cast<std::size_t>(it - actions_.begin()) < appliedActions_) {
+            --appliedActions_;
+        }
+        actions_.erase(it);
+        return true;
+    }
+
+
+    /**
+     * Sends the registrations and actions added since the previous apply() or replay().
+     *
+     * @param connection The open connection.
+     */
+    void apply(C& connection) {
+        std::vector<action_type> calls;
+        {
+            std::lock_guard lock(mutex_);
+            calls = sendRegistrations(connection);
+        }
+        runActions(calls, connection);
+    }
+
+
+    /**
+     * Sends the whole journal on a new connection.
+     *
+     * @param connection The freshly opened connection.
+     * @returns The number of registrations that failed.
+     */
+    std::size_t replay(C& connection) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<action_type> calls;
+        std::size_t failures{ 0 };
+        {
+            std::lock_guard lock(mutex_);
+            registrations_.rewind();
+            appliedActions_ = 0;
+            calls = sendRegistrations(connection);
+            failures = registrations_.failed();
+        }
+        runActions(calls, connection);
+
+        std::lock_guard lock(mutex_);
+        lastReplayDuration_ = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        lastReplayFailures_ = failures;
+        ++replays_;
+
+        return lastReplayFailures_;
+    }
+
+
+    /**
+     * Describes the registration that was sent with the given SendId on the current connection.
+     *
+     * @param sendId The SendId, usually ExceptionMsg::dwSendID.
+     * @returns The description, or an empty string if the SendId is not one of the journal's registrations.
+     */
+    [[nodiscard]]
+    std::string describe(SendId sendId) const {
+        std::lock_guard lock(mutex_);
+        const auto* entry = registrations_.find(sendId);
+        return (entry == nullptr) ? std::string{} : entry->describe();
+    }
+
+
+    /**
+     * Returns the descriptions of the recorded actions, in the order they are sent.
+     */
+    [[nodiscard]]
+    std::vector<std::string> actionDescriptions() const {
+        std::lock_guard lock(mutex_);
+        std::vector<std::string> result;
+        result.reserve(actions_.size());
+        for (const auto& action : actions_) {
+            result.push_back(action.description);
+        }
+        return result;
+    }
+
+
+    /**
+     * Returns the number of registrations and actions in the journal.
+     */
+    [[nodiscard]]
+    std::size_t size() const {
+        std::lock_guard lock(mutex_);
+        return registrations_.size() + actions_.size();
+    }
+
+
+    [[nodiscard]]
+    RegistrationJournalStats stats() const {
+        std::lock_guard lock(mutex_);
+        return RegistrationJournalStats{
+            .registrations = registrations_.size(),
+            .actions = actions_.size(),
+            .replays = replays_,
+            .lastReplayFailures = lastReplayFailures_,
+            .lastReplayDuration = lastReplayDuration_,
+        };
+    }
+
+
+    /**
+     * Removes everything from the journal. Nothing is undone on the current connection.
+     */
+    void clear() {
+        std::lock_guard lock(mutex_);
+        registrations_.clear();
+        actions_.clear();
+        appliedActions_ = 0;
+    }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,338 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/request.hpp>
+#include <simconnect/requests/facility_handler.hpp>
+#include <simconnect/requests/facility_tree.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Configuration for a BulkFacilityFetcher.
+ */
+struct BulkFetchConfig {
+    std::size_t initialWindow{ 8 };                     ///< Requests in flight at the start.
+    std::size_t minWindow{ 1 };
+    std::size_t maxWindow{ 128 };
+    std::chrono::milliseconds targetLatency{ 250 };     ///< The window grows while completions are faster than this, and shrinks when slower.
+    std::chrono::milliseconds timeout{ 10000 };         ///< A request without an answer after this long is retried.
+    unsigned maxAttempts{ 3 };                          ///< Attempts per facility before it is reported as failed.
+};
+
+
+/**
+ * Progress of a BulkFacilityFetcher.
+ */
+struct BulkFetchProgress {
+    std::size_t added{ 0 };
+    std::size_t queued{ 0 };            ///< Waiting to be requested, including retries.
+    std::size_t inFlight{ 0 };
+    std::size_t completed{ 0 };
+    std::size_t failed{ 0 };            ///< Gave up after maxAttempts, or the simulator had no data.
+    std::size_t retries{ 0 };
+    std::size_t timeouts{ 0 };
+    std::size_t exceptions{ 0 };
+    double window{ 0.0 };               ///< The current in-flight limit.
+    std::chrono::microseconds averageLatency{ 0 };  ///< Moving average of the completion latency.
+    double throughput{ 0.0 };           ///< Completed facilities per second since the first request.
+
+    [[nodiscard]]
+    bool done() const noexcept { return (queued == 0) && (inFlight == 0); }
+};
+
+
+/**
+ * Fetches facility data for many facilities, keeping a bounded number of requests in flight.
+ *
+ * The in-flight limit adapts in the style of TCP congestion control: it grows by about one for every window of
+ * completions faster than the target latency, shrinks a little for every slower completion, and is halved on a
+ * SimConnect exception or a timeout. Failed requests are retried up to a configured number of attempts. Each finished
+ * facility is assembled into a FacilityTree and handed to the consumer.
+ *
+ * Requests are sent from pump() and from the completion callbacks, and timeouts are checked in pump(), so call pump()
+ * regularly from the thread that dispatches messages, for instance from a FrameScheduler task. The fetcher is not
+ * thread-safe.
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ * @tparam Clock The clock used for latencies and timeouts.
+ */
+template <class M, class Clock = std::chrono::steady_clock>
+class BulkFacilityFetcher
+{
+public:
+    using simconnect_message_handler_type = M;
+    using clock_type = Clock;
+    using consumer_type = std::function<void(std::string_view icao, std::string_view region, FacilityTree tree)>;
+    using failure_type = std::function<void(std::string_view icao, std::string_view region)>;
+
+
+private:
+    struct Item {
+        std::string icao;
+        std::string region;
+        unsigned attempts{ 0 };
+    };
+
+    struct InFlight {
+        Item item;
+        typename clock_type::time_point started;
+        Request request;
+    };
+
+    M& handler_;
+    FacilityHandler<M>& facilities_;
+    FacilityDefinitionId definitionId_;
+    BulkFetchConfig config_;
+    consumer_type consumer_;
+    failure_type onFailed_;
+
+    FacilityTreeAssembler assembler_;
+    std::deque<Item> queue_;
+    std::map<std::uint64_t, InFlight> inFlight_;        ///< By ticket, as the request ID is only known once the call returns.
+    std::uint64_t nextTicket_{ 1 };
+    typename M::handler_id_type exceptionHandlerId_{};
+
+    double window_{ 0.0 };
+    double averageLatencyUs_{ 0.0 };
+    typename clock_type::time_point firstRequest_{};
+    BulkFetchProgress counts_;
+
+
+    // No copies or moves
+    BulkFacilityFetcher(const BulkFacilityFetcher&) = delete;
+    BulkFacilityFetcher(BulkFacilityFetcher&&) = delete;
+    BulkFacilityFetcher& operator=(const BulkFacilityFetcher&) = delete;
+    BulkFacilityFetcher& operator=(BulkFacilityFetcher&&) = delete;
+
+
+    void shrink(double factor) noexcept {
+        window_ = std::max(static_cast<double>(config_.minWindow), window_ * factor);
+    }
+
+
+    void retryOrFail(Item item) {
+        if (++item.attempts < config_.maxAttempts) {
+            ++counts_.retries;
+            queue_.push_back(std::move(item));
+        } else {
+            fail(item);
+        }
+    }
+
+    void fail(const Item& item) {
+        ++counts_.failed;
+        if (onFailed_) {
+            onFailed_(item.icao, item.region);
+        }
+    }
+
+
+    void completed(std::uint64_t ticket, FacilityTree tree) {
+        auto it = inFlight_.find(ticket);
+        if (it == inFlight_.end()) {
+            return;     // Timed out already.
+        }
+        auto entry = std::move(it->second);
+        inFlight_.erase(it);
+
+        if (tree.empty()) {
+            fail(entry.item);
+        } else {
+            const auto latency = std::chrono::duration<double, std::micro>(clock_type::now() - entry.started).count();
+            averageLatencyUs_ = (counts_.completed == 0) ? latency : (0.8 * averageLatencyUs_ + 0.2 * latency);
+            ++counts_.completed;
+
+            if (latency <= std::chrono::duration<double, std::micro>(config_.targetLatency).count()) {
+                window_ = std::min(static_cast<double>(config_.maxWindow), window_ + 1.0 / window_);
+            } else {
+                shrink(0.95);
+            }
+            if (consumer_) {
+                consumer_(entry.item.icao, entry.item.region, std::move(tree));
+            }
+        }
+        fill();
+    }
+
+
+    void conflicted(std::uint64_t ticket) {
+        if (auto it = inFlight_.find(ticket); it != inFlight_.end()) {
+            auto entry = std::move(it->second);
+            inFlight_.erase(it);
+            fail(entry.item);
+        }
+    }
+
+
+    void exception(const Messages::ExceptionMsg& msg) {
+        const auto call = handler_.connection().sendHistory().find(msg);
+        if (!call || (call->requestId == unused)) {
+            return;
+        }
+        for (auto it = inFlight_.begin(); it != inFlight_.end(); ++it) {
+            if (it->second.request.id() == static_cast<RequestId>(call->requestId)) {
+                auto entry = std::move(it->second);
+                inFlight_.erase(it);
+                assembler_.discard(entry.request.id());
+
+                ++counts_.exceptions;
+                shrink(0.5);
+                retryOrFail(std::move(entry.item));
+                return;
+            }
+        }
+    }
+
+
+    /**
+     * Sends requests until the window is full or the queue is empty.
+     */
+    void fill() {
+        while (!queue_.empty() && (inFlight_.size() < static_cast<std::size_t>(window_))) {
+            auto item = std::move(queue_.front());
+            queue_.pop_front();
+
+            const auto ticket = nextTicket_++;
+            const auto now = clock_type::now();
+            if (firstRequest_ == typename clock_type::time_point{}) {
+                firstRequest_ = now;
+            }
+            auto request = facilities_.requestFacilityTree(assembler_, definitionId_, item.icao, item.region,
+                [this, ticket](FacilityTree tree) { completed(ticket, std::move(tree)); },
+                [this, ticket](const Messages::FacilityMinimalListMsg&) { conflicted(ticket); });
+
+            if (handler_.connection().failed()) {
+                shrink(0.5);
+                retryOrFail(std::move(item));
+                return;     // Try again on the next pump().
+            }
+            inFlight_.emplace(ticket, InFlight{ std::move(item), now, std::move(request) });
+        }
+    }
+
+
+public:
+    /**
+     * Creates a fetcher.
+     *
+     * @param handler The SimConnect message handler, used to watch for exceptions.
+     * @param facilities The facility handler to send the requests with.
+     * @param definitionId The facility definition to request.
+     * @param consumer Called with each finished facility.
+     * @param onFailed Called for facilities that could not be fetched.
+     * @param config The configuration.
+     */
+    BulkFacilityFetcher(M& handler, FacilityHandler<M>& facilities, FacilityDefinitionId definitionId,
+                        consumer_type consumer, failure_type onFailed = nullptr, BulkFetchConfig config = {})
+        : handler_(handler), facilities_(facilities), definitionId_(definitionId), config_(config)
+        , consumer_(std::move(consumer)), onFailed_(std::move(onFailed))
+    {
+        config_.minWindow = std::max<std::size_t>(config_.minWindow, 1);
+        config_.maxWindow = std::max(config_.maxWindow, config_.minWindow);
+        window_ = static_cast<double>(std::clamp(config_.initialWindow, config_.minWindow, config_.maxWindow));
+        exceptionHandlerId_ = handler_.template registerHandler<Messages::ExceptionMsg>(Messages::exception,
+            [this](const Messages::ExceptionMsg& msg) { exception(msg); });
+    }
+
+    ~BulkFacilityFetcher() {
+        handler_.unRegisterHandler(Messages::exception, exceptionHandlerId_);
+    }
+
+
+    /**
+     * Adds a facility to fetch.
+     *
+     * @param icao The ICAO code.
+     * @param region The region code, or empty.
+     */
+    void add(std::string_view icao, std::string_view region = "") {
+        queue_.push_back(Item{ std::string(icao), std::string(region) });
+        ++counts_.added;
+    }
+
+
+    /**
+     * Sends requests to fill the window and retries requests that timed out.
+     */
+    void pump() {
+        const auto now = clock_type::now();
+        for (auto it = inFlight_.begin(); it != inFlight_.end();) {
+            if ((now - it->second.started) >= config_.timeout) {
+                auto entry = std::move(it->second);
+                it = inFlight_.erase(it);
+                assembler_.discard(entry.request.id());
+
+                ++counts_.timeouts;
+                shrink(0.5);
+                retryOrFail(std::move(entry.item));
+            } else {
+                ++it;
+            }
+        }
+        fill();
+    }
+
+
+    /**
+     * Drops all queued and in-flight facilities. Answers still on their way are ignored.
+     */
+    void cancel() {
+        queue_.clear();
+        for (auto& [ticket, entry] : inFlight_) {
+            assembler_.discard(entry.request.id());
+        }
+        inFlight_.clear();
+    }
+
+
+    [[nodiscard]]
+    BulkFetchProgress progress() const {
+        auto progress = counts_;
+        progress.queued = queue_.size();
+        progress.inFlight = inFlight_.size();
+        progress.window = window_;
+        progress.averageLatency = std::chrono::microseconds(static_cast<long long>(averageLatencyUs_));
+        if ((firstRequest_ != typename clock_type::time_point{}) && (counts_.completed > 0)) {
+            const auto elapsed = std::chrono::duration<double>(clock_type::now() - firstRequest_).count();
+            progress.throughput = (elapsed > 0.0) ? (static_cast<double>(counts_.completed) / elapsed) : 0.0;
+        }
+        return progress;
+    }
+
+
+    /**
+     * Returns the current in-flight limit.
+     */
+    [[nodiscard]]
+    std::size_t window() const noexcept { return static_cast<std::size_t>(window_); }
+};
+
+} // namespace SimConnect
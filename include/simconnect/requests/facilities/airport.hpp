@@ -21,6 +21,7 @@
 
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <simconnect/requests/facilities/runway.hpp>
 #include <simconnect/requests/facilities/start_position.hpp>
@@ -33,6 +34,7 @@
 
 #include <map>
 #include <array>
+#include <functional>
 #include <vector>
 #include <string_view>
 
@@ -147,6 +149,52 @@ public:
     /** Returns the number of holding patterns at the airport. */
     constexpr int32_t nHoldingPatterns() const noexcept { return nHoldingPatterns_; }
 #endif
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+#if MSFS_2024_SDK
+            facilityMember<AirportData, &AirportData::isClosed_>(FacilityField::airportIsClosed),
+#endif
+            facilityMember<AirportData, &AirportData::icao_>(FacilityField::airportICAO),
+            facilityMember<AirportData, &AirportData::region_>(FacilityField::airportRegion),
+#if MSFS_2024_SDK
+            facilityMember<AirportData, &AirportData::country_>(FacilityField::airportCountry),
+            facilityMember<AirportData, &AirportData::cityState_>(FacilityField::airportCityState),
+#endif
+            facilityMember<AirportData, &AirportData::name_>(FacilityField::airportName),
+            facilityMember<AirportData, &AirportData::name64_>(FacilityField::airportName64),
+            facilityMember<AirportData, &AirportData::position, &LatLonAlt::latitude>(FacilityField::airportLatitude),
+            facilityMember<AirportData, &AirportData::position, &LatLonAlt::longitude>(FacilityField::airportLongitude),
+            facilityMember<AirportData, &AirportData::position, &LatLonAlt::altitude>(FacilityField::airportAltitude),
+            facilityMember<AirportData, &AirportData::position, &LatLonAltMagVar::magVar>(FacilityField::airportMagvar),
+            facilityMember<AirportData, &AirportData::towerPosition, &LatLonAlt::latitude>(FacilityField::airportTowerLatitude),
+            facilityMember<AirportData, &AirportData::towerPosition, &LatLonAlt::longitude>(FacilityField::airportTowerLongitude),
+            facilityMember<AirportData, &AirportData::towerPosition, &LatLonAlt::altitude>(FacilityField::airportTowerAltitude),
+#if MSFS_2024_SDK
+            facilityMember<AirportData, &AirportData::transitionAltitude_>(FacilityField::airportTransitionAltitude),
+            facilityMember<AirportData, &AirportData::transitionLevel_>(FacilityField::airportTransitionLevel),
+#endif
+            facilityMember<AirportData, &AirportData::nRunways_>(FacilityField::airportRunways),
+            facilityMember<AirportData, &AirportData::nStarts_>(FacilityField::airportStarts),
+            facilityMember<AirportData, &AirportData::nFrequencies_>(FacilityField::airportFrequencies),
+            facilityMember<AirportData, &AirportData::nHelipads_>(FacilityField::airportHelipads),
+            facilityMember<AirportData, &AirportData::nApproaches_>(FacilityField::airportApproaches),
+            facilityMember<AirportData, &AirportData::nDepartures_>(FacilityField::airportDepartures),
+            facilityMember<AirportData, &AirportData::nArrivals_>(FacilityField::airportArrivals),
+            facilityMember<AirportData, &AirportData::nTaxiPoints_>(FacilityField::airportTaxiPoints),
+            facilityMember<AirportData, &AirportData::nTaxiParkings_>(FacilityField::airportTaxiParkings),
+            facilityMember<AirportData, &AirportData::nTaxiPaths_>(FacilityField::airportTaxiPaths),
+            facilityMember<AirportData, &AirportData::nTaxiNames_>(FacilityField::airportTaxiNames),
+            facilityMember<AirportData, &AirportData::nJetways_>(FacilityField::airportJetways),
+#if MSFS_2024_SDK
+            facilityMember<AirportData, &AirportData::nVDGS_>(FacilityField::airportVDGS),
+            facilityMember<AirportData, &AirportData::nHoldingPatterns_>(FacilityField::airportHoldingPatterns),
+#endif
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -183,6 +231,20 @@ struct ParkingKey {
 };
 
 
+/**
+ * Hash for ParkingKey, so parkings can also be kept in an unordered map. All three fields fit in one 64-bit value.
+ */
+struct ParkingKeyHash {
+    [[nodiscard]]
+    std::size_t operator()(const ParkingKey& key) const noexcept {
+        const auto packed = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.number)) << 16)
+                          | (static_cast<std::uint64_t>(static_cast<std::uint8_t>(key.name)) << 8)
+                          | static_cast<std::uint64_t>(static_cast<std::uint8_t>(key.suffix));
+        return std::hash<std::uint64_t>{}(packed);
+    }
+};
+
+
 /**
  * A version of the AirportData structure that includes (optionally) child data.
  */
@@ -425,4 +487,16 @@ struct AirportBuilder
     }
 };
 
-} // namespace SimConnect::Facilities
\ No newline at end of file
+static_assert(layoutMatches<AirportData>(
+                  layoutOf(AirportBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::airportOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::airportOpen),
+                  AirportData::facilityMembers()),
+              "AirportData does not match AirportBuilder::allFields().");
+
+} // namespace SimConnect::Facilities
+
+
+template <>
+struct std::hash<SimConnect::Facilities::ParkingKey> : SimConnect::Facilities::ParkingKeyHash {};
@@ -18,6 +18,7 @@
 #include <simconnect/simconnect.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <cstdint>
 
@@ -55,6 +56,24 @@ public:
     constexpr float offset() const noexcept { return offset_; }
     constexpr float spacing() const noexcept { return spacing_; }
     constexpr float slope() const noexcept { return slope_; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<ApproachLightsData, &ApproachLightsData::system_>(FacilityField::approachLightsSystem),
+            facilityMember<ApproachLightsData, &ApproachLightsData::strobeCount_>(FacilityField::approachLightsStrobeCount),
+            facilityMember<ApproachLightsData, &ApproachLightsData::hasEndLights_>(FacilityField::approachLightsHasEndLights),
+            facilityMember<ApproachLightsData, &ApproachLightsData::hasREILLights_>(FacilityField::approachLightsHasReilLights),
+            facilityMember<ApproachLightsData, &ApproachLightsData::hasTouchdownLights_>(FacilityField::approachLightsHasTouchdownLights),
+            facilityMember<ApproachLightsData, &ApproachLightsData::onGround_>(FacilityField::approachLightsOnGround),
+            facilityMember<ApproachLightsData, &ApproachLightsData::enable_>(FacilityField::approachLightsEnable),
+            facilityMember<ApproachLightsData, &ApproachLightsData::offset_>(FacilityField::approachLightsOffset),
+            facilityMember<ApproachLightsData, &ApproachLightsData::spacing_>(FacilityField::approachLightsSpacing),
+            facilityMember<ApproachLightsData, &ApproachLightsData::slope_>(FacilityField::approachLightsSlope),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -121,4 +140,13 @@ struct ApproachLightsBuilder
     }
 };
 
+static_assert(layoutMatches<ApproachLightsData>(
+                  layoutOf(ApproachLightsBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::runwayPrimaryApproachLightsOpen),
+                                                      FacilityField::runwayPrimaryApproachLightsClose }
+                               .allFields()
+                               .definition,
+                           FacilityField::runwayPrimaryApproachLightsOpen),
+                  ApproachLightsData::facilityMembers()),
+              "ApproachLightsData does not match ApproachLightsBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
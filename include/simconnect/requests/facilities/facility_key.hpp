@@ -0,0 +1,257 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <simconnect/requests/facilities/facility_definition.hpp>
+
+
+namespace SimConnect::Facilities {
+
+
+/**
+ * A facility's ident and region as a single 64-bit value, for use as a map key.
+ *
+ * Nearly every ident in the simulator is at most 8 characters from A-Z, 0-9, space, '-', '_', and '.', with a
+ * region of at most 2 characters. Those are packed directly into the key at 6 bits per character, so creating,
+ * comparing, and hashing them needs no table and no lock, and the packed keys of two facilities compare like their
+ * idents and regions do. Anything else is added to a global table, and the key holds its index instead. Either way
+ * the same ident and region always give the same key, and ident() and region() give them back.
+ */
+class FacilityKey {
+    static constexpr unsigned bitsPerChar{ 6 };
+    static constexpr std::uint64_t charMask{ (1ULL << bitsPerChar) - 1 };
+    static constexpr std::uint64_t internedFlag{ 1ULL << 63 };
+    static constexpr unsigned regionShift{ 0 };
+    static constexpr unsigned identShift{ ShortRegionLength * bitsPerChar };
+
+    std::uint64_t value_{ 0 };
+
+
+    constexpr explicit FacilityKey(std::uint64_t value) noexcept : value_(value) {}
+
+
+    /**
+     * The characters that can be packed, in ASCII order so packed keys sort like the text. Code 0 ends the text.
+     */
+    static constexpr std::string_view alphabet{ " -.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_" };
+
+    [[nodiscard]]
+    static constexpr std::uint64_t encode(char c) noexcept {
+        const auto pos = alphabet.find(c);
+        return (pos == std::string_view::npos) ? 0 : pos + 1;
+    }
+
+    [[nodiscard]]
+    static constexpr char decode(std::uint64_t code) noexcept { return alphabet[code - 1]; }
+
+    /**
+     * Packs up to `length` characters into the bits above `shift`, first character in the highest bits.
+     */
+    [[nodiscard]]
+    static constexpr std::optional<std::uint64_t> packText(std::string_view text, std::size_t length, unsigned shift) noexcept {
+        if (text.size() > length) {
+            return std::nullopt;
+        }
+        std::uint64_t result{ 0 };
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            const auto code = encode(text[i]);
+            if (code == 0) {
+                return std::nullopt;
+            }
+            result |= code << (shift + ((length - 1 - i) * bitsPerChar));
+        }
+        return result;
+    }
+
+    [[nodiscard]]
+    static std::string unpackText(std::uint64_t value, std::size_t length, unsigned shift) {
+        std::string result;
+        for (std::size_t i = 0; i < length; ++i) {
+            const auto code = (value >> (shift + ((length - 1 - i) * bitsPerChar))) & charMask;
+            if (code == 0) {
+                break;
+            }
+            result.push_back(decode(code));
+        }
+        return result;
+    }
+
+    [[nodiscard]]
+    static constexpr std::string_view trimmed(std::string_view text) noexcept {
+        return text.substr(0, text.find('\0'));
+    }
+
+
+    /**
+     * The global table of ident and region pairs that cannot be packed. Entries are never removed, so the strings
+     * stay where they are and the index in a key stays valid.
+     */
+    class Interner {
+        mutable std::shared_mutex mutex_;
+        std::deque<std::pair<std::string, std::string>> entries_;
+        std::unordered_map<std::string, std::uint32_t> index_;
+
+        [[nodiscard]]
+        static std::string joined(std::string_view ident, std::string_view region) {
+            std::string result;
+            result.reserve(ident.size() + 1 + region.size());
+            result.append(ident).push_back('\0');
+            result.append(region);
+            return result;
+        }
+
+    public:
+        [[nodiscard]]
+        std::uint32_t intern(std::string_view ident, std::string_view region) {
+            auto key = joined(ident, region);
+            {
+                std::shared_lock lock(mutex_);
+                if (auto it = index_.find(key); it != index_.end()) {
+                    return it->second;
+                }
+            }
+            std::unique_lock lock(mutex_);
+            auto [it, inserted] = index_.try_emplace(std::move(key), static_cast<std::uint32_t>(entries_.size()));
+            if (inserted) {
+                entries_.emplace_back(std::string(ident), std::string(region));
+            }
+            return it->second;
+        }
+
+        [[nodiscard]]
+        const std::pair<std::string, std::string>& entry(std::uint32_t index) const {
+            std::shared_lock lock(mutex_);
+            return entries_.at(index);
+        }
+
+        [[nodiscard]]
+        std::size_t size() const {
+            std::shared_lock lock(mutex_);
+            return entries_.size();
+        }
+    };
+
+    [[nodiscard]]
+    static Interner& interner() {
+        static Interner instance;
+        return instance;
+    }
+
+
+public:
+    constexpr FacilityKey() noexcept = default;
+
+
+    /**
+     * Returns the key for an ident and region if it can be packed, without touching the global table.
+     * Both values are cut off at the first NUL, so fixed size character arrays can be passed as they are.
+     */
+    [[nodiscard]]
+    static constexpr std::optional<FacilityKey> packed(std::string_view ident, std::string_view region) noexcept {
+        const auto identBits = packText(trimmed(ident), ICAOLength, identShift);
+        const auto regionBits = packText(trimmed(region), ShortRegionLength, regionShift);
+        if (!identBits || !regionBits) {
+            return std::nullopt;
+        }
+        return FacilityKey{ *identBits | *regionBits };
+    }
+
+
+    /**
+     * Returns the key for an ident and region, adding them to the global table if they cannot be packed.
+     * Both values are cut off at the first NUL, so fixed size character arrays can be passed as they are.
+     */
+    [[nodiscard]]
+    static FacilityKey of(std::string_view ident, std::string_view region = {}) {
+        if (const auto key = packed(ident, region)) {
+            return *key;
+        }
+        return FacilityKey{ internedFlag | interner().intern(trimmed(ident), trimmed(region)) };
+    }
+
+
+    /**
+     * Returns the key for a facility from a list or search result.
+     */
+    [[nodiscard]]
+    static FacilityKey of(const MinimalFacilityData& facility) { return of(facility.ident(), facility.region()); }
+
+
+    /**
+     * Returns the number of ident and region pairs in the global table.
+     */
+    [[nodiscard]]
+    static std::size_t internedCount() { return interner().size(); }
+
+
+    [[nodiscard]]
+    constexpr std::uint64_t value() const noexcept { return value_; }
+
+    [[nodiscard]]
+    constexpr bool isPacked() const noexcept { return (value_ & internedFlag) == 0; }
+
+    [[nodiscard]]
+    std::string ident() const {
+        return isPacked() ? unpackText(value_, ICAOLength, identShift)
+                          : interner().entry(static_cast<std::uint32_t>(value_)).first;
+    }
+
+    [[nodiscard]]
+    std::string region() const {
+        return isPacked() ? unpackText(value_, ShortRegionLength, regionShift)
+                          : interner().entry(static_cast<std::uint32_t>(value_)).second;
+    }
+
+
+    constexpr bool operator==(const FacilityKey&) const noexcept = default;
+    constexpr std::strong_ordering operator<=>(const FacilityKey&) const noexcept = default;
+};
+
+
+/**
+ * Hash for FacilityKey. The bits are mixed first, as packed keys of nearby idents differ only in a few bits.
+ */
+struct FacilityKeyHash {
+    [[nodiscard]]
+    std::size_t operator()(const FacilityKey& key) const noexcept {
+        auto x = key.value();
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+};
+
+} // namespace SimConnect::Facilities
+
+
+template <>
+struct std::hash<SimConnect::Facilities::FacilityKey> : SimConnect::Facilities::FacilityKeyHash {};
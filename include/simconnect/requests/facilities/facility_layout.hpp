@@ -0,0 +1,558 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <simconnect/simconnect.hpp>
+
+#include <simconnect/requests/facilities/facility_definition.hpp>
+#include <simconnect/requests/facilities/facility_definition_builder.hpp>
+
+
+namespace SimConnect::Facilities {
+
+
+/**
+ * The way a facility field is encoded in a SimConnect FacilityData message.
+ */
+enum class FacilityWireType {
+    marker,         ///< An OPEN or CLOSE entry, which takes no space in the data.
+    int8,
+    int32,
+    uint32,
+    float32,
+    float64,
+    string8,        ///< ICAO codes, region codes, and procedure names.
+    string32,
+    string64,
+    string256,
+};
+
+
+/**
+ * Returns true if the field opens or closes a (child) object, rather than carrying data.
+ */
+[[nodiscard]]
+constexpr bool isFacilityMarker(FacilityField field) noexcept {
+    const auto name = facilityFieldInfos[static_cast<std::size_t>(field)];
+    return name.starts_with("OPEN ") || name.starts_with("CLOSE ");
+}
+
+
+/**
+ * Returns the wire type of a facility field. Fields not listed are 32-bit integers or enumerations.
+ */
+[[nodiscard]]
+constexpr FacilityWireType facilityWireType(FacilityField field) noexcept {
+    if (isFacilityMarker(field)) {
+        return FacilityWireType::marker;
+    }
+    switch (field) {
+    case FacilityField::airportIsClosed:
+    case FacilityField::runwayEdgeLights:
+    case FacilityField::runwayCenterLights:
+    case FacilityField::runwayPrimaryClosed:
+    case FacilityField::runwayPrimaryTakeoff:
+    case FacilityField::runwayPrimaryLanding:
+    case FacilityField::runwaySecondaryClosed:
+    case FacilityField::runwaySecondaryTakeoff:
+    case FacilityField::runwaySecondaryLanding:
+        return FacilityWireType::int8;
+
+    case FacilityField::ndbFrequency:
+    case FacilityField::vorFrequency:
+        return FacilityWireType::uint32;
+
+    case FacilityField::airportLatitude:
+    case FacilityField::airportLongitude:
+    case FacilityField::airportAltitude:
+    case FacilityField::airportTowerLatitude:
+    case FacilityField::airportTowerLongitude:
+    case FacilityField::airportTowerAltitude:
+    case FacilityField::runwayLatitude:
+    case FacilityField::runwayLongitude:
+    case FacilityField::runwayAltitude:
+    case FacilityField::startLatitude:
+    case FacilityField::startLongitude:
+    case FacilityField::startAltitude:
+    case FacilityField::helipadLatitude:
+    case FacilityField::helipadLongitude:
+    case FacilityField::helipadAltitude:
+    case FacilityField::approachLegFixLatitude:
+    case FacilityField::approachLegFixLongitude:
+    case FacilityField::approachLegFixAltitude:
+    case FacilityField::approachLegOriginLatitude:
+    case FacilityField::approachLegOriginLongitude:
+    case FacilityField::approachLegOriginAltitude:
+    case FacilityField::approachLegArcCenterFixLatitude:
+    case FacilityField::approachLegArcCenterFixLongitude:
+    case FacilityField::approachLegArcCenterFixAltitude:
+    case FacilityField::vdgsLatitude:
+    case FacilityField::vdgsLongitude:
+    case FacilityField::vdgsAltitude:
+    case FacilityField::waypointLatitude:
+    case FacilityField::waypointLongitude:
+    case FacilityField::waypointAltitude:
+    case FacilityField::routeNextLatitude:
+    case FacilityField::routeNextLongitude:
+    case FacilityField::routeNextAltitude:
+    case FacilityField::routePrevLatitude:
+    case FacilityField::routePrevLongitude:
+    case FacilityField::routePrevAltitude:
+    case FacilityField::ndbLatitude:
+    case FacilityField::ndbLongitude:
+    case FacilityField::ndbAltitude:
+    case FacilityField::vorVorLatitude:
+    case FacilityField::vorVorLongitude:
+    case FacilityField::vorVorAltitude:
+    case FacilityField::vorDmeLatitude:
+    case FacilityField::vorDmeLongitude:
+    case FacilityField::vorDmeAltitude:
+    case FacilityField::vorGsLatitude:
+    case FacilityField::vorGsLongitude:
+    case FacilityField::vorGsAltitude:
+    case FacilityField::vorTacanLatitude:
+    case FacilityField::vorTacanLongitude:
+    case FacilityField::vorTacanAltitude:
+        return FacilityWireType::float64;
+
+    case FacilityField::airportMagvar:
+    case FacilityField::airportTransitionAltitude:
+    case FacilityField::airportTransitionLevel:
+    case FacilityField::runwayHeading:
+    case FacilityField::runwayLength:
+    case FacilityField::runwayWidth:
+    case FacilityField::runwayPatternAltitude:
+    case FacilityField::runwaySlope:
+    case FacilityField::runwayTrueSlope:
+    case FacilityField::pavementLength:
+    case FacilityField::pavementWidth:
+    case FacilityField::approachLightsOffset:
+    case FacilityField::approachLightsSpacing:
+    case FacilityField::approachLightsSlope:
+    case FacilityField::vasiBiasX:
+    case FacilityField::vasiBiasZ:
+    case FacilityField::vasiSpacing:
+    case FacilityField::vasiAngle:
+    case FacilityField::startHeading:
+    case FacilityField::helipadHeading:
+    case FacilityField::helipadLength:
+    case FacilityField::helipadWidth:
+    case FacilityField::helipadTouchDownLength:
+    case FacilityField::helipadFatoLength:
+    case FacilityField::helipadFatoWidth:
+    case FacilityField::approachFafHeading:
+    case FacilityField::approachFafAltitude:
+    case FacilityField::approachMissedAltitude:
+    case FacilityField::approachTransitionIafAltitude:
+    case FacilityField::approachTransitionDmeArcRadial:
+    case FacilityField::approachTransitionDmeArcDistance:
+    case FacilityField::approachLegTheta:
+    case FacilityField::approachLegRho:
+    case FacilityField::approachLegCourse:
+    case FacilityField::approachLegRouteDistance:
+    case FacilityField::approachLegAltitude1:
+    case FacilityField::approachLegAltitude2:
+    case FacilityField::approachLegSpeedLimit:
+    case FacilityField::approachLegVerticalAngle:
+    case FacilityField::approachLegRadius:
+    case FacilityField::approachLegRequiredNavigationPerformance:
+    case FacilityField::taxiParkingHeading:
+    case FacilityField::taxiParkingRadius:
+    case FacilityField::taxiParkingBiasX:
+    case FacilityField::taxiParkingBiasZ:
+    case FacilityField::taxiPointBiasX:
+    case FacilityField::taxiPointBiasZ:
+    case FacilityField::taxiPathWidth:
+    case FacilityField::taxiPathLeftHalfWidth:
+    case FacilityField::taxiPathRightHalfWidth:
+    case FacilityField::holdingPatternInboundHoldingCourse:
+    case FacilityField::holdingPatternLegLength:
+    case FacilityField::holdingPatternLegTime:
+    case FacilityField::holdingPatternMinAltitude:
+    case FacilityField::holdingPatternMaxAltitude:
+    case FacilityField::holdingPatternHoldSpeed:
+    case FacilityField::holdingPatternRequiredNavigationPerformance:
+    case FacilityField::holdingPatternArcRadius:
+    case FacilityField::waypointMagvar:
+    case FacilityField::ndbRange:
+    case FacilityField::ndbMagvar:
+    case FacilityField::vorNavRange:
+    case FacilityField::vorMagvar:
+    case FacilityField::vorLocalizer:
+    case FacilityField::vorLocalizerWidth:
+    case FacilityField::vorGlideSlope:
+    case FacilityField::vorDmeBias:
+        return FacilityWireType::float32;
+
+    case FacilityField::airportICAO:
+    case FacilityField::airportRegion:
+    case FacilityField::runwayPrimaryILSICAO:
+    case FacilityField::runwayPrimaryILSRegion:
+    case FacilityField::runwaySecondaryILSICAO:
+    case FacilityField::runwaySecondaryILSRegion:
+    case FacilityField::approachFafICAO:
+    case FacilityField::approachFafRegion:
+    case FacilityField::approachTransitionIafICAO:
+    case FacilityField::approachTransitionIafRegion:
+    case FacilityField::approachTransitionDmeArcICAO:
+    case FacilityField::approachTransitionDmeArcRegion:
+    case FacilityField::approachLegFixICAO:
+    case FacilityField::approachLegFixRegion:
+    case FacilityField::approachLegOriginICAO:
+    case FacilityField::approachLegOriginRegion:
+    case FacilityField::approachLegArcCenterFixICAO:
+    case FacilityField::approachLegArcCenterFixRegion:
+    case FacilityField::departureName:
+    case FacilityField::enrouteTransitionName:
+    case FacilityField::arrivalName:
+    case FacilityField::holdingPatternFixICAO:
+    case FacilityField::holdingPatternFixRegion:
+    case FacilityField::waypointICAO:
+    case FacilityField::waypointRegion:
+    case FacilityField::routeNextICAO:
+    case FacilityField::routeNextRegion:
+    case FacilityField::routePrevICAO:
+    case FacilityField::routePrevRegion:
+        return FacilityWireType::string8;
+
+    case FacilityField::airportName:
+    case FacilityField::approachTransitionName:
+    case FacilityField::airlineName:
+    case FacilityField::taxiNameName:
+    case FacilityField::routeName:
+        return FacilityWireType::string32;
+
+    case FacilityField::airportName64:
+    case FacilityField::frequencyName:
+    case FacilityField::holdingPatternName:
+    case FacilityField::ndbName:
+    case FacilityField::vorName:
+        return FacilityWireType::string64;
+
+    case FacilityField::airportCountry:
+    case FacilityField::airportCityState:
+        return FacilityWireType::string256;
+
+    default:
+        return FacilityWireType::int32;
+    }
+}
+
+
+/**
+ * Returns the number of bytes a value of the given wire type takes in a FacilityData message.
+ */
+[[nodiscard]]
+constexpr std::size_t facilityWireSize(FacilityWireType type) noexcept {
+    switch (type) {
+    case FacilityWireType::marker:    return 0;
+    case FacilityWireType::int8:      return sizeof(std::int8_t);
+    case FacilityWireType::int32:     return sizeof(std::int32_t);
+    case FacilityWireType::uint32:    return sizeof(std::uint32_t);
+    case FacilityWireType::float32:   return sizeof(float);
+    case FacilityWireType::float64:   return sizeof(double);
+    case FacilityWireType::string8:   return ICAOLength;
+    case FacilityWireType::string32:  return NameLength;
+    case FacilityWireType::string64:  return Name64Length;
+    case FacilityWireType::string256: return CountryLength;
+    }
+    return 0;
+}
+
+
+/**
+ * Maps a wire type to the C++ type used to read it. Strings map to the same fixed arrays the facility structs use.
+ */
+template <FacilityWireType T> struct FacilityWireValue;
+template <> struct FacilityWireValue<FacilityWireType::int8> { using type = std::int8_t; };
+template <> struct FacilityWireValue<FacilityWireType::int32> { using type = std::int32_t; };
+template <> struct FacilityWireValue<FacilityWireType::uint32> { using type = std::uint32_t; };
+template <> struct FacilityWireValue<FacilityWireType::float32> { using type = float; };
+template <> struct FacilityWireValue<FacilityWireType::float64> { using type = double; };
+template <> struct FacilityWireValue<FacilityWireType::string8> { using type = std::array<char, ICAOLength>; };
+template <> struct FacilityWireValue<FacilityWireType::string32> { using type = std::array<char, NameLength>; };
+template <> struct FacilityWireValue<FacilityWireType::string64> { using type = std::array<char, Name64Length>; };
+template <> struct FacilityWireValue<FacilityWireType::string256> { using type = std::array<char, CountryLength>; };
+
+template <FacilityField F>
+using facility_field_type = typename FacilityWireValue<facilityWireType(F)>::type;
+
+
+/**
+ * The position of a single field within the data of a FacilityData message.
+ */
+struct FacilityFieldLayout {
+    FacilityField field{ FacilityField::FieldCount };
+    std::size_t offset{ 0 };
+    std::size_t size{ 0 };
+};
+
+
+/**
+ * The wire layout of one object in a facility definition, such as the airport itself or one of its runways. Only the
+ * object's own fields count; the fields of its children arrive in separate messages.
+ *
+ * Layouts are computed at compile time with layoutOf(), and can be used as template argument to FacilityRecord.
+ */
+template <std::size_t MaxLength>
+struct FacilityLayout {
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    FacilityField open{ FacilityField::FieldCount };    ///< The OPEN entry of the object, or FieldCount if it was not found.
+    std::array<FacilityFieldLayout, MaxLength> fields{};
+    std::size_t fieldCount{ 0 };
+    std::size_t size{ 0 };                              ///< The total size of the object's data in bytes.
+
+    [[nodiscard]]
+    constexpr bool found() const noexcept { return open != FacilityField::FieldCount; }
+
+    [[nodiscard]]
+    constexpr std::size_t indexOf(FacilityField field) const noexcept {
+        for (std::size_t i = 0; i < fieldCount; ++i) {
+            if (fields[i].field == field) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    [[nodiscard]]
+    constexpr bool contains(FacilityField field) const noexcept { return indexOf(field) != npos; }
+
+    /**
+     * Returns the byte offset of a field in the object's data, or npos if the object does not contain it.
+     */
+    [[nodiscard]]
+    constexpr std::size_t offsetOf(FacilityField field) const noexcept {
+        const auto index = indexOf(field);
+        return (index == npos) ? npos : fields[index].offset;
+    }
+};
+
+
+/**
+ * Computes the wire layout of an object in a facility definition.
+ *
+ * @param definition The facility definition, usually `builder.definition`.
+ * @param open The OPEN entry of the object, such as FacilityField::runwayOpen.
+ * @param occurrence Which of the objects opened with the same entry to use, if the definition has more than one.
+ * @returns The layout. If the object was not found, found() returns false and the layout is empty.
+ */
+template <std::size_t MaxLength>
+[[nodiscard]]
+constexpr FacilityLayout<MaxLength> layoutOf(const FacilityDefinition<MaxLength>& definition, FacilityField open, std::size_t occurrence = 0) noexcept {
+    FacilityLayout<MaxLength> layout;
+
+    std::size_t index = 0;
+    for (; index < definition.fieldCount; ++index) {
+        if ((definition.fields[index] == open) && (occurrence-- == 0)) {
+            break;
+        }
+    }
+    if (index == definition.fieldCount) {
+        return layout;
+    }
+    layout.open = open;
+
+    std::size_t depth = 0;
+    for (++index; index < definition.fieldCount; ++index) {
+        const auto field = definition.fields[index];
+        const auto type = facilityWireType(field);
+
+        if (type == FacilityWireType::marker) {
+            if (facilityFieldInfos[static_cast<std::size_t>(field)].starts_with("OPEN ")) {
+                ++depth;
+            } else if (depth-- == 0) {
+                break;
+            }
+        } else if (depth == 0) {
+            const auto size = facilityWireSize(type);
+            layout.fields[layout.fieldCount++] = FacilityFieldLayout{ .field = field, .offset = layout.size, .size = size };
+            layout.size += size;
+        }
+    }
+    return layout;
+}
+
+template <std::size_t MaxLength>
+[[nodiscard]]
+constexpr FacilityLayout<MaxLength> layoutOf(const Builder<MaxLength>& builder, FacilityField open, std::size_t occurrence = 0) noexcept {
+    return layoutOf(builder.definition, open, occurrence);
+}
+
+
+/**
+ * Where a hand-written struct stores a facility field.
+ */
+struct FacilityMember {
+    FacilityField field{ FacilityField::FieldCount };
+    std::size_t offset{ 0 };    ///< The byte offset of the member in the struct.
+    std::size_t size{ 0 };      ///< The size of the member.
+};
+
+
+/**
+ * Returns the byte offset of a data member. Unlike `offsetof()`, this also works for members inherited from a base
+ * class, such as the LatLonAltMagVar of WaypointData. It fills the struct with bytes holding their own position and
+ * reads back the first byte of the member, once for the low and once for the high byte of the position.
+ *
+ * @tparam T The (trivially copyable) struct.
+ * @tparam Member A pointer to the data member, which may be a member of a base class of T.
+ */
+template <class T, auto Member>
+[[nodiscard]]
+constexpr std::size_t memberOffset() noexcept {
+    static_assert(sizeof(T) <= 0x10000, "The struct is too large to locate its members.");
+    using member_type = std::remove_cvref_t<decltype(std::declval<const T&>().*Member)>;
+    using bytes_type = std::array<unsigned char, sizeof(T)>;
+
+    bytes_type low{};
+    bytes_type high{};
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        low[i] = static_cast<unsigned char>(i & 0xff);
+        high[i] = static_cast<unsigned char>(i >> 8);
+    }
+    const auto firstByte = [](const bytes_type& bytes) {
+        return std::bit_cast<std::array<unsigned char, sizeof(member_type)>>(std::bit_cast<T>(bytes).*Member)[0];
+    };
+    return (static_cast<std::size_t>(firstByte(high)) << 8) | firstByte(low);
+}
+
+
+/**
+ * Describes the member of T that stores a facility field. Members of nested structs are reached by passing more member
+ * pointers, such as `facilityMember<AirportData, &AirportData::position, &LatLonAlt::latitude>(...)`.
+ *
+ * @tparam T The struct.
+ * @tparam Member A pointer to the data member of T.
+ * @tparam Nested Pointers to data members of the member, and so on.
+ * @param field The field stored in the (innermost) member.
+ */
+template <class T, auto Member, auto... Nested>
+[[nodiscard]]
+constexpr FacilityMember facilityMember(FacilityField field) noexcept {
+    using member_type = std::remove_cvref_t<decltype(std::declval<const T&>().*Member)>;
+
+    if constexpr (sizeof...(Nested) == 0) {
+        return FacilityMember{ .field = field, .offset = memberOffset<T, Member>(), .size = sizeof(member_type) };
+    } else {
+        auto member = facilityMember<member_type, Nested...>(field);
+        member.offset += memberOffset<T, Member>();
+        return member;
+    }
+}
+
+
+/**
+ * Returns true if a hand-written (packed) struct has exactly the size of the layout.
+ */
+template <class T, std::size_t MaxLength>
+[[nodiscard]]
+constexpr bool layoutMatches(const FacilityLayout<MaxLength>& layout) noexcept {
+    return layout.found() && (sizeof(T) == layout.size);
+}
+
+
+/**
+ * Returns true if a hand-written (packed) struct matches the layout member by member: it has the layout's size, the
+ * members describe every field of the layout, and each of them has the offset and size of its field. Use it in a
+ * `static_assert` next to the struct.
+ *
+ * @param layout The layout, as returned by layoutOf().
+ * @param members The members of T, built with facilityMember().
+ */
+template <class T, std::size_t MaxLength, std::size_t N>
+[[nodiscard]]
+constexpr bool layoutMatches(const FacilityLayout<MaxLength>& layout, const std::array<FacilityMember, N>& members) noexcept {
+    if (!layoutMatches<T>(layout) || (N != layout.fieldCount)) {
+        return false;
+    }
+    for (const auto& member : members) {
+        const auto index = layout.indexOf(member.field);
+        if ((index == FacilityLayout<MaxLength>::npos) || (layout.fields[index].offset != member.offset)
+            || (layout.fields[index].size != member.size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * A typed view on the data of a FacilityData message, for the object described by the Layout.
+ *
+ * Fields are read with get<FacilityField::...>(), which checks at compile time that the field is part of the object
+ * and returns it as the C++ type matching its wire type. as<T>() returns the data as a hand-written struct, after
+ * checking at compile time that its size matches, and also each member's offset if T has a facilityMembers() table.
+ *
+ * @tparam Layout The layout, as returned by layoutOf().
+ */
+template <auto Layout>
+class FacilityRecord {
+    const std::byte* data_;
+
+public:
+    explicit FacilityRecord(const Messages::FacilityDataMsg& msg) noexcept
+        : data_(reinterpret_cast<const std::byte*>(&msg.Data))
+    {
+    }
+
+    explicit FacilityRecord(const void* data) noexcept
+        : data_(static_cast<const std::byte*>(data))
+    {
+    }
+
+
+    [[nodiscard]]
+    static constexpr std::size_t size() noexcept { return Layout.size; }
+
+    template <FacilityField F>
+    [[nodiscard]]
+    static constexpr std::size_t offsetOf() noexcept {
+        static_assert(Layout.contains(F), "The field is not part of this facility object.");
+        return Layout.offsetOf(F);
+    }
+
+    template <FacilityField F>
+    [[nodiscard]]
+    facility_field_type<F> get() const noexcept {
+        facility_field_type<F> value;
+        std::memcpy(&value, data_ + offsetOf<F>(), sizeof(value));
+        return value;
+    }
+
+    template <class T>
+    [[nodiscard]]
+    const T& as() const noexcept {
+        if constexpr (requires { T::facilityMembers(); }) {
+            static_assert(layoutMatches<T>(Layout, T::facilityMembers()), "The struct does not match the layout of the facility definition.");
+        } else {
+            static_assert(layoutMatches<T>(Layout), "The struct does not match the layout of the facility definition.");
+        }
+        return *reinterpret_cast<const T*>(data_);
+    }
+};
+
+} // namespace SimConnect::Facilities
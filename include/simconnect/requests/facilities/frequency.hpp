@@ -19,6 +19,7 @@
 #include <simconnect/simconnect.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 
 namespace SimConnect::Facilities {
@@ -42,6 +43,17 @@ public:
     constexpr int32_t frequency() const noexcept { return frequency_; }
     constexpr float frequencyMHz() const noexcept { return static_cast<float>(frequency_) / 1'000'000.0f; }
     constexpr std::string_view name() const noexcept { return { name_.data(), Name64Length }; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<FrequencyData, &FrequencyData::type_>(FacilityField::frequencyType),
+            facilityMember<FrequencyData, &FrequencyData::frequency_>(FacilityField::frequencyFrequency),
+            facilityMember<FrequencyData, &FrequencyData::name_>(FacilityField::frequencyName),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -85,4 +97,12 @@ struct FrequencyBuilder
     }
 };
 
+static_assert(layoutMatches<FrequencyData>(
+                  layoutOf(FrequencyBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::frequencyOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::frequencyOpen),
+                  FrequencyData::facilityMembers()),
+              "FrequencyData does not match FrequencyBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
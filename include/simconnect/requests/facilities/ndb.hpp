@@ -21,6 +21,7 @@
 
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 
 #include <cstdint>
@@ -69,6 +70,26 @@ public:
 #if MSFS_2024_SDK
     constexpr bool bfoRequired() const noexcept { return bfoRequired_ != 0; }
 #endif
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<NDBData, &NDBData::latitude>(FacilityField::ndbLatitude),
+            facilityMember<NDBData, &NDBData::longitude>(FacilityField::ndbLongitude),
+            facilityMember<NDBData, &NDBData::altitude>(FacilityField::ndbAltitude),
+            facilityMember<NDBData, &NDBData::magVar>(FacilityField::ndbMagvar),
+            facilityMember<NDBData, &NDBData::frequency_>(FacilityField::ndbFrequency),
+            facilityMember<NDBData, &NDBData::name_>(FacilityField::ndbName),
+            facilityMember<NDBData, &NDBData::type_>(FacilityField::ndbType),
+            facilityMember<NDBData, &NDBData::range_>(FacilityField::ndbRange),
+            facilityMember<NDBData, &NDBData::isTerminalNDB_>(FacilityField::ndbIsTerminalNDB),
+#if MSFS_2024_SDK
+            facilityMember<NDBData, &NDBData::bfoRequired_>(FacilityField::ndbBfoRequired),
+#endif
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -143,4 +164,13 @@ struct NDBBuilder
     }
     
 };
+
+static_assert(layoutMatches<NDBData>(
+                  layoutOf(NDBBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::ndbOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::ndbOpen),
+                  NDBData::facilityMembers()),
+              "NDBData does not match NDBBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
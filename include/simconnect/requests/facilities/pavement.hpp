@@ -18,6 +18,7 @@
 #include <simconnect/simconnect.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <cstdint>
 
@@ -45,6 +46,17 @@ public:
     constexpr float widthMeters() const noexcept { return width_; }
     constexpr float widthFeet() const noexcept { return static_cast<float>(width_ * MetersToFeetFactor); }
     constexpr bool isEnabled() const noexcept { return enable_ != 0; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<PavementData, &PavementData::length_>(FacilityField::pavementLength),
+            facilityMember<PavementData, &PavementData::width_>(FacilityField::pavementWidth),
+            facilityMember<PavementData, &PavementData::enable_>(FacilityField::pavementEnable),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -83,4 +95,13 @@ struct PavementBuilder
     }
 };
 
+static_assert(layoutMatches<PavementData>(
+                  layoutOf(PavementBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::runwayPrimaryThresholdOpen),
+                                                FacilityField::runwayPrimaryThresholdClose }
+                               .allFields()
+                               .definition,
+                           FacilityField::runwayPrimaryThresholdOpen),
+                  PavementData::facilityMembers()),
+              "PavementData does not match PavementBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
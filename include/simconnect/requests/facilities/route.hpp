@@ -21,6 +21,7 @@
 
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 
 #include <cstdint>
@@ -69,6 +70,27 @@ public:
     constexpr std::string_view prevRegion() const noexcept { return { prevRegion_.data(), RegionLength }; }
     constexpr RouteWaypointType prevWaypointType() const noexcept { return prevWaypointType_; }
     constexpr const LatLonAlt& prevPosition() const noexcept { return prevPosition_; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<RouteData, &RouteData::type_>(FacilityField::routeType),
+            facilityMember<RouteData, &RouteData::nextIcao_>(FacilityField::routeNextICAO),
+            facilityMember<RouteData, &RouteData::nextRegion_>(FacilityField::routeNextRegion),
+            facilityMember<RouteData, &RouteData::nextWaypointType_>(FacilityField::routeNextType),
+            facilityMember<RouteData, &RouteData::nextPosition_, &LatLonAlt::latitude>(FacilityField::routeNextLatitude),
+            facilityMember<RouteData, &RouteData::nextPosition_, &LatLonAlt::longitude>(FacilityField::routeNextLongitude),
+            facilityMember<RouteData, &RouteData::nextPosition_, &LatLonAlt::altitude>(FacilityField::routeNextAltitude),
+            facilityMember<RouteData, &RouteData::prevIcao_>(FacilityField::routePrevICAO),
+            facilityMember<RouteData, &RouteData::prevRegion_>(FacilityField::routePrevRegion),
+            facilityMember<RouteData, &RouteData::prevWaypointType_>(FacilityField::routePrevType),
+            facilityMember<RouteData, &RouteData::prevPosition_, &LatLonAlt::latitude>(FacilityField::routePrevLatitude),
+            facilityMember<RouteData, &RouteData::prevPosition_, &LatLonAlt::longitude>(FacilityField::routePrevLongitude),
+            facilityMember<RouteData, &RouteData::prevPosition_, &LatLonAlt::altitude>(FacilityField::routePrevAltitude),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -147,4 +169,13 @@ struct RouteBuilder
     }
     
 };
+
+static_assert(layoutMatches<RouteData>(
+                  layoutOf(RouteBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::routeOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::routeOpen),
+                  RouteData::facilityMembers()),
+              "RouteData does not match RouteBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
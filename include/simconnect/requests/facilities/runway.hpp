@@ -19,6 +19,7 @@
  #include <simconnect/simconnect.hpp>
  #include <simconnect/requests/facilities/facility_definition.hpp>
  #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
  #include <simconnect/requests/facilities/pavement.hpp>
  #include <simconnect/requests/facilities/approach_lights.hpp>
  #include <simconnect/requests/facilities/vasi.hpp>
@@ -164,6 +165,48 @@ public:
         const auto index = static_cast<std::size_t>(secondaryDesignator_);
         return (index < RunwayDesignatorNames.size()) ? RunwayDesignatorNames[index] : "Invalid";
     }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<RunwayData, &RunwayData::position_, &LatLonAlt::latitude>(FacilityField::runwayLatitude),
+            facilityMember<RunwayData, &RunwayData::position_, &LatLonAlt::longitude>(FacilityField::runwayLongitude),
+            facilityMember<RunwayData, &RunwayData::position_, &LatLonAlt::altitude>(FacilityField::runwayAltitude),
+            facilityMember<RunwayData, &RunwayData::heading_>(FacilityField::runwayHeading),
+            facilityMember<RunwayData, &RunwayData::length_>(FacilityField::runwayLength),
+            facilityMember<RunwayData, &RunwayData::width_>(FacilityField::runwayWidth),
+            facilityMember<RunwayData, &RunwayData::patternAltitude_>(FacilityField::runwayPatternAltitude),
+            facilityMember<RunwayData, &RunwayData::slope_>(FacilityField::runwaySlope),
+            facilityMember<RunwayData, &RunwayData::trueSlope_>(FacilityField::runwayTrueSlope),
+            facilityMember<RunwayData, &RunwayData::surface_>(FacilityField::runwaySurface),
+#if MSFS_2024_SDK
+            facilityMember<RunwayData, &RunwayData::edgeLights_>(FacilityField::runwayEdgeLights),
+            facilityMember<RunwayData, &RunwayData::centerLights_>(FacilityField::runwayCenterLights),
+#endif
+            facilityMember<RunwayData, &RunwayData::primaryIlsIcao_>(FacilityField::runwayPrimaryILSICAO),
+            facilityMember<RunwayData, &RunwayData::primaryIlsRegion_>(FacilityField::runwayPrimaryILSRegion),
+#if MSFS_2024_SDK
+            facilityMember<RunwayData, &RunwayData::primaryClosed_>(FacilityField::runwayPrimaryClosed),
+            facilityMember<RunwayData, &RunwayData::primaryTakeoff_>(FacilityField::runwayPrimaryTakeoff),
+            facilityMember<RunwayData, &RunwayData::primaryLanding_>(FacilityField::runwayPrimaryLanding),
+#endif
+            facilityMember<RunwayData, &RunwayData::primaryIlsType_>(FacilityField::runwayPrimaryILSType),
+            facilityMember<RunwayData, &RunwayData::primaryNumber_>(FacilityField::runwayPrimaryNumber),
+            facilityMember<RunwayData, &RunwayData::primaryDesignator_>(FacilityField::runwayPrimaryDesignator),
+            facilityMember<RunwayData, &RunwayData::secondaryIlsIcao_>(FacilityField::runwaySecondaryILSICAO),
+            facilityMember<RunwayData, &RunwayData::secondaryIlsRegion_>(FacilityField::runwaySecondaryILSRegion),
+#if MSFS_2024_SDK
+            facilityMember<RunwayData, &RunwayData::secondaryClosed_>(FacilityField::runwaySecondaryClosed),
+            facilityMember<RunwayData, &RunwayData::secondaryTakeoff_>(FacilityField::runwaySecondaryTakeoff),
+            facilityMember<RunwayData, &RunwayData::secondaryLanding_>(FacilityField::runwaySecondaryLanding),
+#endif
+            facilityMember<RunwayData, &RunwayData::secondaryIlsType_>(FacilityField::runwaySecondaryILSType),
+            facilityMember<RunwayData, &RunwayData::secondaryNumber_>(FacilityField::runwaySecondaryNumber),
+            facilityMember<RunwayData, &RunwayData::secondaryDesignator_>(FacilityField::runwaySecondaryDesignator),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -370,4 +413,12 @@ struct RunwayBuilder
     }
 };
 
+static_assert(layoutMatches<RunwayData>(
+                  layoutOf(RunwayBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::runwayOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::runwayOpen),
+                  RunwayData::facilityMembers()),
+              "RunwayData does not match RunwayBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
@@ -19,6 +19,7 @@
  #include <simconnect/simconnect.hpp>
  #include <simconnect/requests/facilities/facility_definition.hpp>
  #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
  #include <cstdint>
 
@@ -85,6 +86,21 @@ public:
         const auto index = static_cast<std::size_t>(designator_);
         return (index < RunwayDesignatorNames.size()) ? RunwayDesignatorNames[index] : "Invalid";
     }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<StartData, &StartData::type_>(FacilityField::startType),
+            facilityMember<StartData, &StartData::position_, &LatLonAlt::latitude>(FacilityField::startLatitude),
+            facilityMember<StartData, &StartData::position_, &LatLonAlt::longitude>(FacilityField::startLongitude),
+            facilityMember<StartData, &StartData::position_, &LatLonAlt::altitude>(FacilityField::startAltitude),
+            facilityMember<StartData, &StartData::heading_>(FacilityField::startHeading),
+            facilityMember<StartData, &StartData::number_>(FacilityField::startNumber),
+            facilityMember<StartData, &StartData::designator_>(FacilityField::startDesignator),
+        };
+    }
 };
 
 
@@ -144,4 +160,12 @@ struct StartBuilder
     }
 };
 
+static_assert(layoutMatches<StartData>(
+                  layoutOf(StartBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::startOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::startOpen),
+                  StartData::facilityMembers()),
+              "StartData does not match StartBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
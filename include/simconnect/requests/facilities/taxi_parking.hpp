@@ -19,6 +19,7 @@
 #include <simconnect/simconnect.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 
 #include <cmath>
@@ -121,6 +122,27 @@ public:
 #if MSFS_2024_SDK
     constexpr int32_t nAirlines() const noexcept { return nAirlines_; }
 #endif
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<TaxiParkingData, &TaxiParkingData::type_>(FacilityField::taxiParkingType),
+            facilityMember<TaxiParkingData, &TaxiParkingData::taxiPointType_>(FacilityField::taxiParkingTaxiPointType),
+            facilityMember<TaxiParkingData, &TaxiParkingData::name_>(FacilityField::taxiParkingName),
+            facilityMember<TaxiParkingData, &TaxiParkingData::suffix_>(FacilityField::taxiParkingSuffix),
+            facilityMember<TaxiParkingData, &TaxiParkingData::number_>(FacilityField::taxiParkingNumber),
+            facilityMember<TaxiParkingData, &TaxiParkingData::orientation_>(FacilityField::taxiParkingOrientation),
+            facilityMember<TaxiParkingData, &TaxiParkingData::heading_>(FacilityField::taxiParkingHeading),
+            facilityMember<TaxiParkingData, &TaxiParkingData::radius_>(FacilityField::taxiParkingRadius),
+            facilityMember<TaxiParkingData, &TaxiParkingData::biasX_>(FacilityField::taxiParkingBiasX),
+            facilityMember<TaxiParkingData, &TaxiParkingData::biasZ_>(FacilityField::taxiParkingBiasZ),
+#if MSFS_2024_SDK
+            facilityMember<TaxiParkingData, &TaxiParkingData::nAirlines_>(FacilityField::taxiParkingNAirlines),
+#endif
+        };
+    }
 };
 #pragma pack(pop)
 
@@ -214,4 +236,12 @@ struct TaxiParkingBuilder
     }
 };
 
+static_assert(layoutMatches<TaxiParkingData>(
+                  layoutOf(TaxiParkingBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::taxiParkingOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::taxiParkingOpen),
+                  TaxiParkingData::facilityMembers()),
+              "TaxiParkingData does not match TaxiParkingBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <simconnect/simconnect.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <cstdint>
 #include <array>
@@ -61,6 +62,19 @@ public:
     constexpr float biasZ() const noexcept { return biasZ_; }
     constexpr float spacing() const noexcept { return spacing_; }
     constexpr float angle() const noexcept { return angle_; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<VASIData, &VASIData::type_>(FacilityField::vasiType),
+            facilityMember<VASIData, &VASIData::biasX_>(FacilityField::vasiBiasX),
+            facilityMember<VASIData, &VASIData::biasZ_>(FacilityField::vasiBiasZ),
+            facilityMember<VASIData, &VASIData::spacing_>(FacilityField::vasiSpacing),
+            facilityMember<VASIData, &VASIData::angle_>(FacilityField::vasiAngle),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -107,4 +121,13 @@ struct VasiBuilder
     }
 };
 
+static_assert(layoutMatches<VASIData>(
+                  layoutOf(VasiBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::runwayPrimaryLeftVASIOpen),
+                                            FacilityField::runwayPrimaryLeftVASIClose }
+                               .allFields()
+                               .definition,
+                           FacilityField::runwayPrimaryLeftVASIOpen),
+                  VASIData::facilityMembers()),
+              "VASIData does not match VasiBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
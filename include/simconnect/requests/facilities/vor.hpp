@@ -21,6 +21,7 @@
 
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <simconnect/requests/facilities/taxi_parking.hpp>
 #include <simconnect/requests/facilities/frequency.hpp>
@@ -105,6 +106,46 @@ public:
     constexpr LocalizerCategory lsCategory() const noexcept { return lsCategory_; }
     constexpr bool isTrueReferenced() const noexcept { return isTrueReferenced_ != 0; }
 #endif
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<VORData, &VORData::vorPosition, &LatLonAlt::latitude>(FacilityField::vorVorLatitude),
+            facilityMember<VORData, &VORData::vorPosition, &LatLonAlt::longitude>(FacilityField::vorVorLongitude),
+            facilityMember<VORData, &VORData::vorPosition, &LatLonAlt::altitude>(FacilityField::vorVorAltitude),
+            facilityMember<VORData, &VORData::vorPosition, &LatLonAltMagVar::magVar>(FacilityField::vorMagvar),
+            facilityMember<VORData, &VORData::dmePosition, &LatLonAlt::latitude>(FacilityField::vorDmeLatitude),
+            facilityMember<VORData, &VORData::dmePosition, &LatLonAlt::longitude>(FacilityField::vorDmeLongitude),
+            facilityMember<VORData, &VORData::dmePosition, &LatLonAlt::altitude>(FacilityField::vorDmeAltitude),
+            facilityMember<VORData, &VORData::gsPosition, &LatLonAlt::latitude>(FacilityField::vorGsLatitude),
+            facilityMember<VORData, &VORData::gsPosition, &LatLonAlt::longitude>(FacilityField::vorGsLongitude),
+            facilityMember<VORData, &VORData::gsPosition, &LatLonAlt::altitude>(FacilityField::vorGsAltitude),
+            facilityMember<VORData, &VORData::tacanPosition, &LatLonAlt::latitude>(FacilityField::vorTacanLatitude),
+            facilityMember<VORData, &VORData::tacanPosition, &LatLonAlt::longitude>(FacilityField::vorTacanLongitude),
+            facilityMember<VORData, &VORData::tacanPosition, &LatLonAlt::altitude>(FacilityField::vorTacanAltitude),
+            facilityMember<VORData, &VORData::isNav_>(FacilityField::vorIsNav),
+            facilityMember<VORData, &VORData::isDme_>(FacilityField::vorIsDme),
+            facilityMember<VORData, &VORData::isTacan_>(FacilityField::vorIsTacan),
+            facilityMember<VORData, &VORData::hasGlideSlope_>(FacilityField::vorHasGlideSlope),
+            facilityMember<VORData, &VORData::dmeAtNav_>(FacilityField::vorDmeAtNav),
+            facilityMember<VORData, &VORData::dmeAtGlideSlope_>(FacilityField::vorDmeAtGlideSlope),
+            facilityMember<VORData, &VORData::hasBackCourse_>(FacilityField::vorHasBackCourse),
+            facilityMember<VORData, &VORData::frequency_>(FacilityField::vorFrequency),
+            facilityMember<VORData, &VORData::type_>(FacilityField::vorType),
+            facilityMember<VORData, &VORData::navRange_>(FacilityField::vorNavRange),
+            facilityMember<VORData, &VORData::localizer_>(FacilityField::vorLocalizer),
+            facilityMember<VORData, &VORData::localizerWidth_>(FacilityField::vorLocalizerWidth),
+            facilityMember<VORData, &VORData::glideSlope_>(FacilityField::vorGlideSlope),
+            facilityMember<VORData, &VORData::name_>(FacilityField::vorName),
+#if MSFS_2024_SDK
+            facilityMember<VORData, &VORData::dmeBias_>(FacilityField::vorDmeBias),
+            facilityMember<VORData, &VORData::lsCategory_>(FacilityField::vorLsCategory),
+            facilityMember<VORData, &VORData::isTrueReferenced_>(FacilityField::vorIsTrueReferenced),
+#endif
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -259,4 +300,13 @@ struct VORBuilder
     }
     
 };
+
+static_assert(layoutMatches<VORData>(
+                  layoutOf(VORBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::vorOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::vorOpen),
+                  VORData::facilityMembers()),
+              "VORData does not match VORBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
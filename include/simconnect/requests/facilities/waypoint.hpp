@@ -21,6 +21,7 @@
 
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facilities/facility_layout.hpp>
 
 #include <simconnect/requests/facilities/route.hpp>
 
@@ -62,6 +63,23 @@ public:
 
     constexpr bool isTerminalWaypoint() const noexcept { return isTerminalWaypoint_ != 0; }
     constexpr std::int32_t nRoutes() const noexcept { return nRoutes_; }
+
+    /**
+     * Returns where each field of the builder's allFields() is stored, to check the struct against the wire layout.
+     */
+    static constexpr auto facilityMembers() noexcept {
+        return std::array{
+            facilityMember<WaypointData, &WaypointData::latitude>(FacilityField::waypointLatitude),
+            facilityMember<WaypointData, &WaypointData::longitude>(FacilityField::waypointLongitude),
+            facilityMember<WaypointData, &WaypointData::altitude>(FacilityField::waypointAltitude),
+            facilityMember<WaypointData, &WaypointData::magVar>(FacilityField::waypointMagvar),
+            facilityMember<WaypointData, &WaypointData::icao_>(FacilityField::waypointICAO),
+            facilityMember<WaypointData, &WaypointData::region_>(FacilityField::waypointRegion),
+            facilityMember<WaypointData, &WaypointData::type_>(FacilityField::waypointType),
+            facilityMember<WaypointData, &WaypointData::isTerminalWaypoint_>(FacilityField::waypointIsTerminalWpt),
+            facilityMember<WaypointData, &WaypointData::nRoutes_>(FacilityField::waypointNRoutes),
+        };
+    }
 };
 
 #pragma pack(pop)
@@ -140,4 +158,13 @@ struct WaypointBuilder
     }
     
 };
+
+static_assert(layoutMatches<WaypointData>(
+                  layoutOf(WaypointBuilder<64>{ FacilityDefinition<64>{}.push(FacilityField::waypointOpen) }
+                               .allFields()
+                               .definition,
+                           FacilityField::waypointOpen),
+                  WaypointData::facilityMembers()),
+              "WaypointData does not match WaypointBuilder::allFields().");
+
 } // namespace SimConnect::Facilities
\ No newline at end of file
@@ -0,0 +1,279 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/request.hpp>
+#include <simconnect/requests/facility_list_handler.hpp>
+#include <simconnect/requests/facility_index.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Configuration for a FacilityBubbleTracker.
+ */
+struct FacilityBubbleConfig {
+    std::chrono::milliseconds interval{ 5000 };     ///< Time between the starts of two listings, when driven by pump().
+};
+
+
+/**
+ * Counters describing a FacilityBubbleTracker.
+ */
+struct FacilityBubbleStats {
+    std::size_t facilities{ 0 };        ///< Facilities in the last completed snapshot.
+    std::size_t listings{ 0 };          ///< Listings started.
+    std::size_t completed{ 0 };         ///< Listings that completed and were compared with the previous snapshot.
+    std::size_t abandoned{ 0 };         ///< Listings replaced by a new one before they completed.
+    std::size_t entered{ 0 };           ///< Total facilities reported as entering the bubble.
+    std::size_t left{ 0 };              ///< Total facilities reported as leaving the bubble.
+};
+
+
+/**
+ * Tracks which facilities are in the simulator's reality bubble, and reports only the ones that entered or left it.
+ *
+ * Every refresh lists the bubble for the configured facility types. When all lists are complete, the new snapshot is
+ * sorted by type, ident, and region, and merged in a single pass with the previous one. The consumer is called once
+ * with the facilities that are new and the ones that are gone, and only if there are any. The first snapshot reports
+ * every facility as entered.
+ *
+ * Call pump() regularly from the thread that dispatches messages, for instance from a FrameScheduler task, or call
+ * refresh() directly. The tracker is not thread-safe.
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ * @tparam Clock The clock used for the refresh interval.
+ */
+template <class M, class Clock = std::chrono::steady_clock>
+class FacilityBubbleTracker
+{
+public:
+    using simconnect_message_handler_type = M;
+    using clock_type = Clock;
+    using consumer_type = std::function<void(std::span<const FacilityLocation> entered, std::span<const FacilityLocation> left)>;
+
+
+private:
+    FacilityListHandler<M>& lists_;
+    consumer_type consumer_;
+    std::vector<FacilityListType> types_;
+    FacilityBubbleConfig config_;
+
+    std::vector<FacilityLocation> current_;     ///< Sorted by key.
+    std::vector<FacilityLocation> incoming_;
+    std::vector<Request> requests_;
+    std::size_t outstanding_{ 0 };
+    typename clock_type::time_point lastStart_{};
+    bool started_{ false };
+
+    std::vector<FacilityLocation> entered_;
+    std::vector<FacilityLocation> left_;
+    FacilityBubbleStats stats_;
+
+
+    // No copies or moves
+    FacilityBubbleTracker(const FacilityBubbleTracker&) = delete;
+    FacilityBubbleTracker(FacilityBubbleTracker&&) = delete;
+    FacilityBubbleTracker& operator=(const FacilityBubbleTracker&) = delete;
+    FacilityBubbleTracker& operator=(FacilityBubbleTracker&&) = delete;
+
+
+    [[nodiscard]]
+    static bool keyLess(const FacilityLocation& a, const FacilityLocation& b) noexcept {
+        return std::tie(a.type, a.ident, a.region) < std::tie(b.type, b.ident, b.region);
+    }
+
+    [[nodiscard]]
+    static bool keyEqual(const FacilityLocation& a, const FacilityLocation& b) noexcept {
+        return (a.type == b.type) && (a.ident == b.ident) && (a.region == b.region);
+    }
+
+
+    void collect(FacilityListType type, std::string_view ident, std::string_view region, const LatLonAlt& position) {
+        incoming_.push_back(FacilityLocation::of(type, ident, region, position));
+    }
+
+
+    void listDone() {
+        if ((outstanding_ == 0) || (--outstanding_ > 0)) {
+            return;
+        }
+        std::sort(incoming_.begin(), incoming_.end(), keyLess);
+        incoming_.erase(std::unique(incoming_.begin(), incoming_.end(), keyEqual), incoming_.end());
+
+        entered_.clear();
+        left_.clear();
+        auto oldIt = current_.begin();
+        auto newIt = incoming_.begin();
+        while ((oldIt != current_.end()) || (newIt != incoming_.end())) {
+            if ((newIt == incoming_.end()) || ((oldIt != current_.end()) && keyLess(*oldIt, *newIt))) {
+                left_.push_back(*oldIt++);
+            } else if ((oldIt == current_.end()) || keyLess(*newIt, *oldIt)) {
+                entered_.push_back(*newIt++);
+            } else {
+                ++oldIt;
+                ++newIt;
+            }
+        }
+        std::swap(current_, incoming_);
+        incoming_.clear();
+
+        ++stats_.completed;
+        stats_.facilities = current_.size();
+        stats_.entered += entered_.size();
+        stats_.left += left_.size();
+        if ((!entered_.empty() || !left_.empty()) && consumer_) {
+            consumer_(entered_, left_);
+        }
+    }
+
+
+    Request list(FacilityListType type) {
+        auto onDone = [this]() { listDone(); };
+        switch (type) {
+        case FacilityListTypes::waypoint:
+            return lists_.listWaypoints(FacilitiesListScope::bubbleOnly,
+                [this](std::string_view ident, std::string_view region, const WaypointDetails& details) {
+                    collect(FacilityListTypes::waypoint, ident, region, details);
+                }, onDone);
+        case FacilityListTypes::ndb:
+            return lists_.listNDBs(FacilitiesListScope::bubbleOnly,
+                [this](std::string_view ident, std::string_view region, const NdbDetails& details) {
+                    collect(FacilityListTypes::ndb, ident, region, details);
+                }, onDone);
+        case FacilityListTypes::vor:
+            return lists_.listVORs(FacilitiesListScope::bubbleOnly,
+                [this](std::string_view ident, std::string_view region, const VorDetails& details) {
+                    collect(FacilityListTypes::vor, ident, region, details);
+                }, onDone);
+        default:
+            return lists_.listAirports(FacilitiesListScope::bubbleOnly,
+                [this](std::string_view ident, std::string_view region, const AirportDetails& details) {
+                    collect(FacilityListTypes::airport, ident, region, details);
+                }, onDone);
+        }
+    }
+
+
+public:
+    /**
+     * Creates a tracker. Nothing is listed until refresh() or pump() is called.
+     *
+     * @param lists The facility list handler used for the listings.
+     * @param consumer Called with the facilities that entered and left the bubble since the previous snapshot.
+     * @param types The facility types to track.
+     * @param config The refresh interval.
+     */
+    FacilityBubbleTracker(FacilityListHandler<M>& lists, consumer_type consumer,
+                          std::initializer_list<FacilityListType> types = { FacilityListTypes::airport, FacilityListTypes::vor, FacilityListTypes::ndb },
+                          FacilityBubbleConfig config = {})
+        : lists_(lists), consumer_(std::move(consumer)), types_(types), config_(config)
+    {
+    }
+
+    ~FacilityBubbleTracker() {
+        cancel();
+    }
+
+
+    /**
+     * Starts a new listing. A listing that is still running is abandoned, and its partial snapshot discarded.
+     */
+    void refresh() {
+        if (outstanding_ > 0) {
+            ++stats_.abandoned;
+        }
+        cancel();
+        lastStart_ = clock_type::now();
+        started_ = true;
+        ++stats_.listings;
+
+        outstanding_ = types_.size();
+        requests_.reserve(types_.size());
+        for (const auto type : types_) {
+            requests_.push_back(list(type));
+        }
+    }
+
+
+    /**
+     * Starts a new listing if none is running and the interval has passed since the previous one started.
+     *
+     * @returns true if a listing was started.
+     */
+    bool pump() {
+        if ((outstanding_ > 0) || (started_ && ((clock_type::now() - lastStart_) < config_.interval))) {
+            return false;
+        }
+        refresh();
+        return true;
+    }
+
+
+    /**
+     * Stops a running listing. The last completed snapshot is kept.
+     */
+    void cancel() {
+        outstanding_ = 0;
+        for (auto& request : requests_) {
+            request.stop();
+        }
+        requests_.clear();
+        incoming_.clear();
+    }
+
+
+    /**
+     * Returns true while a listing is running.
+     */
+    [[nodiscard]]
+    bool listing() const noexcept { return outstanding_ > 0; }
+
+
+    /**
+     * Returns the facilities of the last completed snapshot, sorted by type, ident, and region.
+     */
+    [[nodiscard]]
+    std::span<const FacilityLocation> facilities() const noexcept { return current_; }
+
+
+    /**
+     * Returns true if the facility was in the last completed snapshot.
+     */
+    [[nodiscard]]
+    bool contains(FacilityListType type, std::string_view ident, std::string_view region) const noexcept {
+        return std::binary_search(current_.begin(), current_.end(), FacilityLocation::of(type, ident, region), keyLess);
+    }
+
+
+    [[nodiscard]]
+    const FacilityBubbleStats& stats() const noexcept { return stats_; }
+};
+
+} // namespace SimConnect
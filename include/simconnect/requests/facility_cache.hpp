@@ -0,0 +1,474 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/util/mapped_file.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * The simulator a FacilityCache belongs to, as reported in Messages::OpenMsg. A cache file written for a different
+ * simulator, version, or build is ignored and replaced on the next flush.
+ */
+struct SimulatorIdentity {
+    std::string name;
+    std::string version;
+    std::string build;
+};
+
+
+/**
+ * The cached answer to a single facility data request: the Messages::FacilityDataMsg messages in the order they were
+ * received. The messages are read in place from the cache, and stay valid until the cache is flushed or the same
+ * facility is stored again.
+ */
+class FacilityCacheEntry {
+    std::span<const std::byte> bytes_;
+    std::size_t messages_{ 0 };
+
+
+    /**
+     * Returns the size of the message at the given offset, or 0 if there is no complete message there.
+     */
+    [[nodiscard]]
+    std::size_t messageSizeAt(std::size_t offset) const noexcept {
+        if ((offset > bytes_.size()) || (bytes_.size() - offset < sizeof(Messages::FacilityDataMsg))) {
+            return 0;
+        }
+        const std::size_t size = reinterpret_cast<const Messages::FacilityDataMsg*>(bytes_.data() + offset)->dwSize;
+        return ((size >= sizeof(Messages::FacilityDataMsg)) && (size <= bytes_.size() - offset)) ? size : 0;
+    }
+
+    static constexpr std::size_t aligned(std::size_t size) noexcept { return (size + 7) & ~std::size_t{ 7 }; }
+
+public:
+    FacilityCacheEntry(std::span<const std::byte> bytes, std::size_t messages) noexcept : bytes_(bytes), messages_(messages) {}
+
+    [[nodiscard]]
+    std::size_t messages() const noexcept { return messages_; }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return bytes_.size(); }
+
+    /**
+     * Checks that all messages are complete and lie within the entry.
+     */
+    [[nodiscard]]
+    bool valid() const noexcept {
+        std::size_t offset{ 0 };
+        for (std::size_t i = 0; i < messages_; ++i) {
+            const auto size = messageSizeAt(offset);
+            if (size == 0) {
+                return false;
+            }
+            offset += aligned(size);
+        }
+        return true;
+    }
+
+
+    /**
+     * Calls a function for every cached message, in order. Stops at the first message that is not complete.
+     */
+    template <class F>
+    void forEach(F&& visitor) const {
+        std::size_t offset{ 0 };
+        for (std::size_t i = 0; i < messages_; ++i) {
+            const auto size = messageSizeAt(offset);
+            if (size == 0) {
+                return;
+            }
+            visitor(*reinterpret_cast<const Messages::FacilityDataMsg*>(bytes_.data() + offset));
+            offset += aligned(size);
+        }
+    }
+};
+
+
+/**
+ * Counters describing a FacilityCache.
+ */
+struct FacilityCacheStats {
+    std::size_t entries{ 0 };       ///< Facilities in the cache file.
+    std::size_t pending{ 0 };       ///< Facilities stored since the last flush.
+    std::size_t hits{ 0 };
+    std::size_t misses{ 0 };
+    bool loaded{ false };           ///< Whether a cache file for this simulator was found.
+};
+
+
+/**
+ * A persistent cache of facility data, stored in a memory-mapped file.
+ *
+ * Each entry is keyed by ICAO code, region, and the facility definition used, and holds the raw facility data messages
+ * as they were received, so a hit can be handed to the same callbacks as a live answer without copying. The file
+ * belongs to a single simulator build; see SimulatorIdentity.
+ *
+ * Entries stored since opening are kept in memory until flush() writes a new file next to the old one and renames it
+ * into place. FacilityHandler::requestFacilityData() has an overload that uses a cache.
+ *
+ * The file starts with a Header, followed by the message data, each message aligned to 8 bytes, and ends with the
+ * IndexEntry array sorted by key. All numbers are in the native byte order.
+ */
+class FacilityCache {
+public:
+    static constexpr std::uint32_t magic{ 0x43464353 };    ///< "SCFC"
+    static constexpr std::uint32_t formatVersion{ 1 };
+
+
+private:
+    struct Header {
+        std::uint32_t magic{ 0 };
+        std::uint32_t formatVersion{ 0 };
+        std::uint32_t headerSize{ 0 };
+        std::uint32_t entryCount{ 0 };
+        std::uint64_t indexOffset{ 0 };
+        std::uint64_t fileSize{ 0 };
+        std::array<char, 64> simulator{};
+        std::array<char, 32> version{};
+        std::array<char, 32> build{};
+    };
+
+    struct Key {
+        std::array<char, 12> icao{};
+        std::array<char, 4> region{};
+        std::uint64_t definition{ 0 };
+
+        auto operator<=>(const Key&) const = default;
+    };
+
+    struct IndexEntry {
+        Key key;
+        std::uint64_t offset;
+        std::uint32_t size;
+        std::uint32_t messages;
+    };
+
+    struct Pending {
+        std::vector<std::byte> bytes;
+        std::size_t messages;
+    };
+
+    static_assert(sizeof(Header) % 8 == 0);
+    static_assert(sizeof(IndexEntry) % 8 == 0);
+
+
+    std::filesystem::path path_;
+    SimulatorIdentity simulator_;
+
+    mutable std::mutex mutex_;
+    MappedFile file_;
+    std::span<const IndexEntry> index_;
+    std::map<Key, Pending> pending_;
+    mutable std::size_t hits_{ 0 };
+    mutable std::size_t misses_{ 0 };
+
+
+    template <std::size_t N>
+    static bool copyField(std::array<char, N>& field, std::string_view value) noexcept {
+        if (value.size() >= N) {
+            return false;
+        }
+        std::copy(value.begin(), value.end(), field.begin());
+        return true;
+    }
+
+    static std::optional<Key> makeKey(std::string_view icao, std::string_view region, std::uint64_t definition) noexcept {
+        Key key{ .definition = definition };
+        if (!copyField(key.icao, icao) || !copyField(key.region, region)) {
+            return std::nullopt;
+        }
+        return key;
+    }
+
+    static constexpr std::size_t aligned(std::size_t size) noexcept { return (size + 7) & ~std::size_t{ 7 }; }
+
+
+    [[nodiscard]]
+    Header makeHeader() const noexcept {
+        Header header{ .magic = magic, .formatVersion = formatVersion, .headerSize = sizeof(Header) };
+        copyField(header.simulator, std::string_view(simulator_.name).substr(0, header.simulator.size() - 1));
+        copyField(header.version, std::string_view(simulator_.version).substr(0, header.version.size() - 1));
+        copyField(header.build, std::string_view(simulator_.build).substr(0, header.build.size() - 1));
+        return header;
+    }
+
+
+    /**
+     * Maps the cache file and checks it belongs to this simulator, that the index is sorted, and that every entry
+     * holds complete messages. Anything unexpected leaves the cache empty.
+     */
+    void load() {
+        index_ = {};
+        if (!file_.open(path_)) {
+            return;
+        }
+        const auto bytes = file_.bytes();
+        const auto expected = makeHeader();
+        Header header{};
+        if (bytes.size() < sizeof(Header)) {
+            file_.close();
+            return;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+
+        const bool valid = (header.magic == magic) && (header.formatVersion == formatVersion) && (header.headerSize == sizeof(Header))
+            && (header.simulator == expected.simulator) && (header.version == expected.version) && (header.build == expected.build)
+            && (header.fileSize == bytes.size()) && (header.indexOffset % 8 == 0) && (header.indexOffset <= bytes.size())
+            && ((bytes.size() - header.indexOffset) / sizeof(IndexEntry) >= header.entryCount);
+        if (!valid) {
+            file_.close();
+            return;
+        }
+        index_ = { reinterpret_cast<const IndexEntry*>(bytes.data() + header.indexOffset), header.entryCount };
+        const bool damaged = std::any_of(index_.begin(), index_.end(), [&header, bytes](const IndexEntry& entry) {
+                return (entry.offset < sizeof(Header)) || (entry.offset % 8 != 0) || (entry.offset > header.indexOffset)
+                    || (entry.size > header.indexOffset - entry.offset)
+                    || !FacilityCacheEntry{ bytes.subspan(entry.offset, entry.size), entry.messages }.valid();
+            })
+            || (std::adjacent_find(index_.begin(), index_.end(), [](const IndexEntry& lhs, const IndexEntry& rhs) {
+                return !(lhs.key < rhs.key); }) != index_.end());
+        if (damaged) {
+            index_ = {};
+            file_.close();
+        }
+    }
+
+
+    [[nodiscard]]
+    const IndexEntry* findMapped(const Key& key) const noexcept {
+        auto it = std::lower_bound(index_.begin(), index_.end(), key, [](const IndexEntry& entry, const Key& k) { return entry.key < k; });
+        return ((it != index_.end()) && (it->key == key)) ? &*it : nullptr;
+    }
+
+
+    bool write(const std::filesystem::path& temp) const {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        const auto mapped = file_.bytes();
+        std::vector<IndexEntry> index;
+        index.reserve(index_.size() + pending_.size());
+
+        Header header = makeHeader();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        std::uint64_t offset{ sizeof(Header) };
+
+        auto pendingIt = pending_.begin();
+        auto mappedIt = index_.begin();
+        while ((pendingIt != pending_.end()) || (mappedIt != index_.end())) {
+            const bool takePending = (mappedIt == index_.end()) || ((pendingIt != pending_.end()) && !(mappedIt->key < pendingIt->first));
+            if (takePending) {
+                if ((mappedIt != index_.end()) && (mappedIt->key == pendingIt->first)) {
+                    ++mappedIt;     // Replaced by the newer answer.
+                }
+                const auto& bytes = pendingIt->second.bytes;
+                out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                index.push_back(IndexEntry{ pendingIt->first, offset, static_cast<std::uint32_t>(bytes.size()),
+                                            static_cast<std::uint32_t>(pendingIt->second.messages) });
+                offset += bytes.size();
+                ++pendingIt;
+            } else {
+                out.write(reinterpret_cast<const char*>(mapped.data() + mappedIt->offset), mappedIt->size);
+                index.push_back(IndexEntry{ mappedIt->key, offset, mappedIt->size, mappedIt->messages });
+                offset += mappedIt->size;
+                ++mappedIt;
+            }
+        }
+        out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(IndexEntry)));
+
+        header.entryCount = static_cast<std::uint32_t>(index.size());
+        header.indexOffset = offset;
+        header.fileSize = offset + index.size() * sizeof(IndexEntry);
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        return static_cast<bool>(out);
+    }
+
+
+public:
+    /**
+     * Opens the cache. A missing, damaged, or outdated file results in an empty cache.
+     *
+     * @param path The cache file.
+     * @param simulator The simulator the cached data is for.
+     */
+    FacilityCache(std::filesystem::path path, SimulatorIdentity simulator)
+        : path_(std::move(path)), simulator_(std::move(simulator))
+    {
+        load();
+    }
+
+    // No copies or moves
+    FacilityCache(const FacilityCache&) = delete;
+    FacilityCache(FacilityCache&&) = delete;
+    FacilityCache& operator=(const FacilityCache&) = delete;
+    FacilityCache& operator=(FacilityCache&&) = delete;
+    ~FacilityCache() = default;
+
+
+    /**
+     * Returns a key for a facility definition, so answers for different definitions are kept apart.
+     */
+    template <std::size_t MaxLength>
+    [[nodiscard]]
+    static constexpr std::uint64_t definitionKey(const Facilities::FacilityDefinition<MaxLength>& definition) noexcept {
+        std::uint64_t hash{ 14695981039346656037ULL };
+        for (std::size_t i = 0; i < definition.fieldCount; ++i) {
+            hash = (hash ^ static_cast<std::uint64_t>(definition.fields[i])) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+
+    /**
+     * Looks up a facility.
+     *
+     * @param icao The ICAO code.
+     * @param region The region code, or empty.
+     * @param definition The key of the facility definition, see definitionKey().
+     * @returns The cached messages, if present.
+     */
+    [[nodiscard]]
+    std::optional<FacilityCacheEntry> find(std::string_view icao, std::string_view region, std::uint64_t definition) const {
+        const auto key = makeKey(icao, region, definition);
+
+        std::lock_guard lock(mutex_);
+        if (key) {
+            if (auto it = pending_.find(*key); it != pending_.end()) {
+                ++hits_;
+                return FacilityCacheEntry{ it->second.bytes, it->second.messages };
+            }
+            if (const auto* entry = findMapped(*key)) {
+                ++hits_;
+                return FacilityCacheEntry{ file_.bytes().subspan(entry->offset, entry->size), entry->messages };
+            }
+        }
+        ++misses_;
+        return std::nullopt;
+    }
+
+
+    /**
+     * Appends a message to a buffer that will be stored with store().
+     *
+     * @param buffer The buffer to append to.
+     * @param msg The message, as received.
+     */
+    static void append(std::vector<std::byte>& buffer, const Messages::FacilityDataMsg& msg) {
+        const auto* bytes = reinterpret_cast<const std::byte*>(&msg);
+        buffer.insert(buffer.end(), bytes, bytes + msg.dwSize);
+        buffer.resize(aligned(buffer.size()));
+    }
+
+
+    /**
+     * Stores the answer for a facility, replacing any earlier one. It is written to disk by the next flush().
+     *
+     * @param icao The ICAO code.
+     * @param region The region code, or empty.
+     * @param definition The key of the facility definition, see definitionKey().
+     * @param buffer The messages, collected with append().
+     * @param messages The number of messages in the buffer.
+     * @returns false if the ICAO or region code is too long to be cached.
+     */
+    bool store(std::string_view icao, std::string_view region, std::uint64_t definition, std::vector<std::byte> buffer, std::size_t messages) {
+        const auto key = makeKey(icao, region, definition);
+        if (!key) {
+            return false;
+        }
+        std::lock_guard lock(mutex_);
+        pending_.insert_or_assign(*key, Pending{ std::move(buffer), messages });
+        return true;
+    }
+
+
+    /**
+     * Writes the cache file if anything was stored since the last flush. Entries returned by find() before the flush
+     * are no longer valid afterwards.
+     *
+     * @returns false if the file could not be written; the stored entries are then kept in memory.
+     */
+    bool flush() {
+        std::lock_guard lock(mutex_);
+        if (pending_.empty()) {
+            return true;
+        }
+
+        auto temp = path_;
+        temp += ".tmp";
+        if (!write(temp)) {
+            std::error_code ignored;
+            std::filesystem::remove(temp, ignored);
+            return false;
+        }
+        index_ = {};
+        file_.close();
+
+        std::error_code error;
+        std::filesystem::rename(temp, path_, error);
+        if (!error) {
+            pending_.clear();
+        }
+        load();
+        return !error;
+    }
+
+
+    [[nodiscard]]
+    FacilityCacheStats stats() const {
+        std::lock_guard lock(mutex_);
+        return FacilityCacheStats{
+            .entries = index_.size(),
+            .pending = pending_.size(),
+            .hits = hits_,
+            .misses = misses_,
+            .loaded = file_.isOpen(),
+        };
+    }
+
+
+    [[nodiscard]]
+    const std::filesystem::path& path() const noexcept { return path_; }
+
+    [[nodiscard]]
+    const SimulatorIdentity& simulator() const noexcept { return simulator_; }
+};
+
+} // namespace SimConnect
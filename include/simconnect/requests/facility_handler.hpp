@@ -16,16 +16,23 @@
  */
 
 
+#include <cstddef>
+#include <cstdint>
 #include <span>
 #include <string>
 #include <string_view>
 #include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <simconnect/simconnect.hpp>
 #include <simconnect/message_handler.hpp>
 #include <simconnect/requests/requests.hpp>
 #include <simconnect/requests/facilities/facility_definition.hpp>
 #include <simconnect/requests/facilities/facility_definition_builder.hpp>
+#include <simconnect/requests/facility_cache.hpp>
+#include <simconnect/requests/facility_tree.hpp>
 
 #include <simconnect/util/logger.hpp>
 
@@ -47,6 +54,7 @@ public:
 
 private:
     simconnect_message_handler_type& simConnectMessageHandler_;
+    std::unordered_map<FacilityDefinitionId, std::uint64_t> definitionKeys_;   ///< Cache keys of the definitions built here.
 
 
     // No copies or moves
@@ -119,6 +127,7 @@ public:
                                                         fieldId, Facilities::facilityFieldInfos[fieldId], defId);
             }
         }
+        definitionKeys_[defId] = FacilityCache::definitionKey(builder.definition);
         return defId;
     }
 
@@ -199,6 +208,117 @@ public:
     }
 
 
+    /**
+     * Requests facility data, answering from a cache if possible. On a hit the callbacks are called immediately with the
+     * cached messages, and an empty Request is returned. On a miss the request is sent to the simulator, and a complete
+     * answer is stored in the cache; call FacilityCache::flush() to write it to disk. The facility definition must have
+     * been made with buildDefinition(), otherwise the cache is bypassed.
+     *
+     * @param cache The cache.
+     * @param facilityDefId The facility definition ID.
+     * @param icaoCode The ICAO code of the facility.
+     * @param region The region code of the facility.
+     * @param onData The callback to be called for each facility data message.
+     * @param onEnd The callback to be called when the facility data is complete.
+     * @param onConflict The callback to be called when the ICAO+Region combination was not unique. Such answers are not cached.
+     * @returns The Request object representing the facility data request.
+     */
+    [[nodiscard]]
+    Request requestFacilityData(FacilityCache& cache, FacilityDefinitionId facilityDefId, std::string_view icaoCode, std::string_view region = "",
+                                std::function<void(const Messages::FacilityDataMsg&)> onData = nullptr,
+                                std::function<void()> onEnd = nullptr,
+                                std::function<void(const Messages::FacilityMinimalListMsg&)> onConflict = nullptr)
+    {
+        const auto keyIt = definitionKeys_.find(facilityDefId);
+        if (keyIt == definitionKeys_.end()) {
+            this->logger().warn("Facility definition {} was not built by this handler, so it cannot be cached.", facilityDefId);
+            return requestFacilityData(facilityDefId, icaoCode, region, std::move(onData), std::move(onEnd), std::move(onConflict));
+        }
+        const auto definitionKey = keyIt->second;
+
+        if (auto entry = cache.find(icaoCode, region, definitionKey)) {
+            this->logger().debug("Facility data for '{}' ('{}') served from cache: {} messages.", icaoCode, region, entry->messages());
+            if (onData) {
+                entry->forEach(onData);
+            }
+            if (onEnd) {
+                onEnd();
+            }
+            return Request{};
+        }
+
+        struct Recording {
+            std::vector<std::byte> buffer;
+            std::size_t messages{ 0 };
+            bool conflict{ false };
+        };
+        auto recording = std::make_shared<Recording>();
+
+        return requestFacilityData(facilityDefId, icaoCode, region,
+            [recording, onData](const Messages::FacilityDataMsg& msg) {
+                FacilityCache::append(recording->buffer, msg);
+                ++recording->messages;
+                if (onData) {
+                    onData(msg);
+                }
+            },
+            [recording, onEnd, &cache, icao = std::string(icaoCode), regionCode = std::string(region), definitionKey]() {
+                if (!recording->conflict) {
+                    cache.store(icao, regionCode, definitionKey, std::move(recording->buffer), recording->messages);
+                }
+                if (onEnd) {
+                    onEnd();
+                }
+            },
+            [recording, onConflict](const Messages::FacilityMinimalListMsg& msg) {
+                recording->conflict = true;
+                if (onConflict) {
+                    onConflict(msg);
+                }
+            });
+    }
+
+
+    /**
+     * Requests facility data and assembles the answer into a FacilityTree, which is passed to the callback once complete.
+     *
+     * @param assembler The assembler to collect the records in.
+     * @param facilityDefId The facility definition ID.
+     * @param icaoCode The ICAO code of the facility.
+     * @param region The region code of the facility.
+     * @param onTree The callback to be called with the finished tree. The tree is empty if no data was received.
+     * @param onConflict The callback to be called when the ICAO+Region combination was not unique.
+     * @returns The Request object representing the facility data request.
+     */
+    [[nodiscard]]
+    Request requestFacilityTree(FacilityTreeAssembler& assembler, FacilityDefinitionId facilityDefId, std::string_view icaoCode, std::string_view region,
+                                std::function<void(FacilityTree)> onTree,
+                                std::function<void(const Messages::FacilityMinimalListMsg&)> onConflict = nullptr)
+    {
+        auto requestId = std::make_shared<RequestId>(noRequest);
+
+        return requestFacilityData(facilityDefId, icaoCode, region,
+            [requestId, &assembler](const Messages::FacilityDataMsg& msg) {
+                *requestId = static_cast<RequestId>(msg.UserRequestId);
+                assembler.add(msg);
+            },
+            [requestId, &assembler, onTree]() {
+                auto tree = (*requestId == noRequest) ? FacilityTree{} : assembler.finish(*requestId);
+                if (onTree) {
+                    onTree(std::move(tree));
+                }
+            },
+            [requestId, &assembler, onConflict](const Messages::FacilityMinimalListMsg& msg) {
+                if (*requestId != noRequest) {
+                    assembler.discard(*requestId);
+                }
+                if (onConflict) {
+                    onConflict(msg);
+                }
+            });
+    }
+
+
     /**
      * Requests jetway data for the specified ICAO code and jetway index.
      * 
@@ -0,0 +1,601 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <numbers>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simconnect_datatypes.hpp>
+#include <simconnect/util/mapped_file.hpp>
+#include <simconnect/requests/facility_list_handler.hpp>
+#include <simconnect/requests/facilities/facility_definition.hpp>
+#include <simconnect/requests/facilities/facility_key.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A facility in a FacilityIndex. The layout is fixed, as it is written to disk as-is.
+ */
+struct FacilityLocation {
+    LatLonAlt position{};
+    std::array<char, Facilities::ICAOLength> ident{};
+    std::array<char, Facilities::RegionLength> region{};
+    FacilityListType type{ FacilityListTypes::airport };
+
+    /**
+     * Creates a location. The fields need no terminator, so an identifier or region may fill its field; longer ones are
+     * truncated.
+     */
+    [[nodiscard]]
+    static FacilityLocation of(FacilityListType type, std::string_view ident, std::string_view region, const LatLonAlt& position = {}) noexcept {
+        FacilityLocation location{ .position = position, .type = type };
+        ident.copy(location.ident.data(), location.ident.size());
+        region.copy(location.region.data(), location.region.size());
+        return location;
+    }
+
+    [[nodiscard]]
+    std::string_view identView() const noexcept { return trimmed(ident); }
+
+    [[nodiscard]]
+    std::string_view regionView() const noexcept { return trimmed(region); }
+
+    /**
+     * Returns the interned ident and region, for keying maps of facilities.
+     */
+    [[nodiscard]]
+    Facilities::FacilityKey key() const { return Facilities::FacilityKey::of(identView(), regionView()); }
+
+private:
+    template <std::size_t N>
+    static std::string_view trimmed(const std::array<char, N>& text) noexcept {
+        const std::string_view view{ text.data(), N };
+        return view.substr(0, view.find('\0'));
+    }
+};
+
+
+/**
+ * A facility found by a distance query.
+ */
+struct FacilityHit {
+    const FacilityLocation* location{ nullptr };
+    double distance{ 0.0 };     ///< The great-circle distance in meters.
+};
+
+
+/**
+ * A static spatial index over facility list results, for nearest, radius, and bounding box queries.
+ *
+ * The facilities are stored as points on the unit sphere, in an implicit k-d tree: the entries are ordered so that
+ * each range is split at its median on the x, y, and z axes in turn, and no other structure is kept. Because the
+ * straight-line distance between two points on the sphere grows with their great-circle distance, the queries need
+ * no special cases for the date line or the poles. Queries take microseconds on a world-wide dataset and allocate
+ * only their result.
+ *
+ * The tree is implied by the order of the entries, so save() writes just the entries and load() reads them back
+ * without rebuilding. Build an index with FacilityIndexBuilder.
+ */
+class FacilityIndex {
+public:
+    static constexpr double meanEarthRadius{ 6'371'008.8 };     ///< In meters.
+    static constexpr std::size_t leafSize{ 16 };
+
+
+private:
+    static constexpr std::uint32_t magic{ 0x49464353 };         ///< "SCFI"
+    static constexpr std::uint32_t formatVersion{ 1 };
+
+    struct Header {
+        std::uint32_t magic{ 0 };
+        std::uint32_t formatVersion{ 0 };
+        std::uint32_t entrySize{ 0 };
+        std::uint32_t leafSize{ 0 };
+        std::uint64_t count{ 0 };
+    };
+
+    using Point = std::array<double, 3>;
+
+    std::vector<FacilityLocation> entries_;
+    std::vector<Point> points_;
+
+
+    [[nodiscard]]
+    static Point toPoint(double latitude, double longitude) noexcept {
+        constexpr double toRadians = std::numbers::pi / 180.0;
+        const double lat = latitude * toRadians;
+        const double lon = longitude * toRadians;
+        return { std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat) };
+    }
+
+    [[nodiscard]]
+    static double chord2(const Point& a, const Point& b) noexcept {
+        const double dx = a[0] - b[0];
+        const double dy = a[1] - b[1];
+        const double dz = a[2] - b[2];
+        return (dx * dx) + (dy * dy) + (dz * dz);
+    }
+
+    [[nodiscard]]
+    static double chordToMeters(double chordSquared) noexcept {
+        return 2.0 * meanEarthRadius * std::asin(std::min(1.0, std::sqrt(chordSquared) / 2.0));
+    }
+
+    [[nodiscard]]
+    static double metersToChord(double meters) noexcept {
+        return 2.0 * std::sin(std::min(meters / (2.0 * meanEarthRadius), std::numbers::pi / 2.0));
+    }
+
+
+    explicit FacilityIndex(std::vector<FacilityLocation> entries)
+        : entries_(std::move(entries))
+    {
+        points_.reserve(entries_.size());
+        for (const auto& entry : entries_) {
+            points_.push_back(toPoint(entry.position.latitude, entry.position.longitude));
+        }
+    }
+
+
+    template <class F>
+    void nearestIn(std::size_t lo, std::size_t hi, std::size_t axis, const Point& query, std::size_t k, F& accept,
+                   std::vector<std::pair<double, std::size_t>>& heap) const
+    {
+        auto consider = [&](std::size_t i) {
+            if (!accept(entries_[i])) {
+                return;
+            }
+            const double d2 = chord2(points_[i], query);
+            if (heap.size() < k) {
+                heap.emplace_back(d2, i);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (d2 < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = { d2, i };
+                std::push_heap(heap.begin(), heap.end());
+            }
+        };
+        if (hi - lo <= leafSize) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                consider(i);
+            }
+            return;
+        }
+        const std::size_t mid = lo + ((hi - lo) / 2);
+        consider(mid);
+
+        const double diff = query[axis] - points_[mid][axis];
+        const std::size_t next = (axis + 1) % 3;
+        if (diff < 0.0) {
+            nearestIn(lo, mid, next, query, k, accept, heap);
+            if ((heap.size() < k) || ((diff * diff) < heap.front().first)) {
+                nearestIn(mid + 1, hi, next, query, k, accept, heap);
+            }
+        } else {
+            nearestIn(mid + 1, hi, next, query, k, accept, heap);
+            if ((heap.size() < k) || ((diff * diff) < heap.front().first)) {
+                nearestIn(lo, mid, next, query, k, accept, heap);
+            }
+        }
+    }
+
+
+    template <class F>
+    void withinIn(std::size_t lo, std::size_t hi, std::size_t axis, const Point& query, double radius, F& accept,
+                  std::vector<FacilityHit>& result) const
+    {
+        const double radius2 = radius * radius;
+        auto consider = [&](std::size_t i) {
+            const double d2 = chord2(points_[i], query);
+            if ((d2 <= radius2) && accept(entries_[i])) {
+                result.push_back(FacilityHit{ .location = &entries_[i], .distance = chordToMeters(d2) });
+            }
+        };
+        if (hi - lo <= leafSize) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                consider(i);
+            }
+            return;
+        }
+        const std::size_t mid = lo + ((hi - lo) / 2);
+        consider(mid);
+
+        const double diff = query[axis] - points_[mid][axis];
+        const std::size_t next = (axis + 1) % 3;
+        if (diff <= radius) {
+            withinIn(lo, mid, next, query, radius, accept, result);
+        }
+        if (-diff <= radius) {
+            withinIn(mid + 1, hi, next, query, radius, accept, result);
+        }
+    }
+
+
+    template <class F>
+    void boxIn(std::size_t lo, std::size_t hi, std::size_t axis, const Point& low, const Point& high, F& contains,
+               std::vector<const FacilityLocation*>& result) const
+    {
+        auto consider = [&](std::size_t i) {
+            const auto& p = points_[i];
+            if ((p[0] >= low[0]) && (p[0] <= high[0]) && (p[1] >= low[1]) && (p[1] <= high[1]) && (p[2] >= low[2]) && (p[2] <= high[2])
+                && contains(entries_[i]))
+            {
+                result.push_back(&entries_[i]);
+            }
+        };
+        if (hi - lo <= leafSize) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                consider(i);
+            }
+            return;
+        }
+        const std::size_t mid = lo + ((hi - lo) / 2);
+        consider(mid);
+
+        const double split = points_[mid][axis];
+        const std::size_t next = (axis + 1) % 3;
+        if (low[axis] <= split) {
+            boxIn(lo, mid, next, low, high, contains, result);
+        }
+        if (high[axis] >= split) {
+            boxIn(mid + 1, hi, next, low, high, contains, result);
+        }
+    }
+
+
+    static void sortTree(std::vector<std::size_t>& order, const std::vector<Point>& points, std::size_t lo, std::size_t hi, std::size_t axis) {
+        if (hi - lo <= leafSize) {
+            return;
+        }
+        const std::size_t mid = lo + ((hi - lo) / 2);
+        std::nth_element(order.begin() + static_cast<std::ptrdiff_t>(lo), order.begin() + static_cast<std::ptrdiff_t>(mid),
+                         order.begin() + static_cast<std::ptrdiff_t>(hi),
+                         [&points, axis](std::size_t a, std::size_t b) { return points[a][axis] < points[b][axis]; });
+        sortTree(order, points, lo, mid, (axis + 1) % 3);
+        sortTree(order, points, mid + 1, hi, (axis + 1) % 3);
+    }
+
+
+    friend class FacilityIndexBuilder;
+
+    [[nodiscard]]
+    static FacilityIndex build(std::vector<FacilityLocation> entries) {
+        std::vector<Point> points;
+        points.reserve(entries.size());
+        for (const auto& entry : entries) {
+            points.push_back(toPoint(entry.position.latitude, entry.position.longitude));
+        }
+        std::vector<std::size_t> order(entries.size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        sortTree(order, points, 0, order.size(), 0);
+
+        std::vector<FacilityLocation> sorted;
+        sorted.reserve(entries.size());
+        for (const auto i : order) {
+            sorted.push_back(entries[i]);
+        }
+        return FacilityIndex(std::move(sorted));
+    }
+
+
+public:
+    FacilityIndex() = default;
+
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    [[nodiscard]]
+    bool empty() const noexcept { return entries_.empty(); }
+
+    /**
+     * Returns all facilities, in the order of the tree.
+     */
+    [[nodiscard]]
+    const std::vector<FacilityLocation>& entries() const noexcept { return entries_; }
+
+
+    /**
+     * Returns the great-circle distance in meters between two positions.
+     */
+    [[nodiscard]]
+    static double distance(double latitude1, double longitude1, double latitude2, double longitude2) noexcept {
+        return chordToMeters(chord2(toPoint(latitude1, longitude1), toPoint(latitude2, longitude2)));
+    }
+
+
+    /**
+     * Finds the k facilities nearest to a position that pass a filter.
+     *
+     * @param latitude The latitude in degrees.
+     * @param longitude The longitude in degrees.
+     * @param k The maximum number of facilities to return.
+     * @param accept A predicate on `const FacilityLocation&`, such as a test on the type.
+     * @returns The facilities found, nearest first.
+     */
+    template <class F>
+    [[nodiscard]]
+    std::vector<FacilityHit> nearest(double latitude, double longitude, std::size_t k, F accept) const {
+        std::vector<FacilityHit> result;
+        if ((k == 0) || entries_.empty()) {
+            return result;
+        }
+        std::vector<std::pair<double, std::size_t>> heap;
+        heap.reserve(k);
+        nearestIn(0, entries_.size(), 0, toPoint(latitude, longitude), k, accept, heap);
+
+        std::sort_heap(heap.begin(), heap.end());
+        result.reserve(heap.size());
+        for (const auto& [d2, i] : heap) {
+            result.push_back(FacilityHit{ .location = &entries_[i], .distance = chordToMeters(d2) });
+        }
+        return result;
+    }
+
+    [[nodiscard]]
+    std::vector<FacilityHit> nearest(double latitude, double longitude, std::size_t k) const {
+        return nearest(latitude, longitude, k, [](const FacilityLocation&) { return true; });
+    }
+
+    [[nodiscard]]
+    std::vector<FacilityHit> nearest(double latitude, double longitude, std::size_t k, FacilityListType type) const {
+        return nearest(latitude, longitude, k, [type](const FacilityLocation& location) { return location.type == type; });
+    }
+
+
+    /**
+     * Finds the facilities within a distance of a position that pass a filter.
+     *
+     * @param latitude The latitude in degrees.
+     * @param longitude The longitude in degrees.
+     * @param radius The distance in meters.
+     * @param accept A predicate on `const FacilityLocation&`.
+     * @returns The facilities found, nearest first.
+     */
+    template <class F>
+    [[nodiscard]]
+    std::vector<FacilityHit> within(double latitude, double longitude, double radius, F accept) const {
+        std::vector<FacilityHit> result;
+        if (!entries_.empty() && (radius >= 0.0)) {
+            withinIn(0, entries_.size(), 0, toPoint(latitude, longitude), metersToChord(radius), accept, result);
+            std::sort(result.begin(), result.end(), [](const FacilityHit& a, const FacilityHit& b) { return a.distance < b.distance; });
+        }
+        return result;
+    }
+
+    [[nodiscard]]
+    std::vector<FacilityHit> within(double latitude, double longitude, double radius) const {
+        return within(latitude, longitude, radius, [](const FacilityLocation&) { return true; });
+    }
+
+    [[nodiscard]]
+    std::vector<FacilityHit> within(double latitude, double longitude, double radius, FacilityListType type) const {
+        return within(latitude, longitude, radius, [type](const FacilityLocation& location) { return location.type == type; });
+    }
+
+
+    /**
+     * Finds the facilities in a latitude/longitude box that pass a filter. A box with west greater than east crosses
+     * the date line.
+     *
+     * @param south The southern latitude in degrees.
+     * @param west The western longitude in degrees.
+     * @param north The northern latitude in degrees.
+     * @param east The eastern longitude in degrees.
+     * @param accept A predicate on `const FacilityLocation&`.
+     * @returns The facilities found, in no particular order.
+     */
+    template <class F>
+    [[nodiscard]]
+    std::vector<const FacilityLocation*> inBox(double south, double west, double north, double east, F accept) const {
+        std::vector<const FacilityLocation*> result;
+        if (entries_.empty() || (south > north)) {
+            return result;
+        }
+        const bool wraps = west > east;
+        auto lonInside = [west, east, wraps](double lon) {
+            return wraps ? ((lon >= west) || (lon <= east)) : ((lon >= west) && (lon <= east));
+        };
+
+        // The bounds of the box on the unit sphere are reached at its corners, on the equator, or on a multiple of 90 degrees longitude.
+        std::vector<double> lats{ south, north };
+        if ((south < 0.0) && (north > 0.0)) {
+            lats.push_back(0.0);
+        }
+        std::vector<double> lons{ west, east };
+        for (const double lon : { -180.0, -90.0, 0.0, 90.0, 180.0 }) {
+            if (lonInside(lon)) {
+                lons.push_back(lon);
+            }
+        }
+        constexpr double margin{ 1e-9 };
+        Point low{ 2.0, 2.0, 2.0 };
+        Point high{ -2.0, -2.0, -2.0 };
+        for (const double lat : lats) {
+            for (const double lon : lons) {
+                const auto p = toPoint(lat, lon);
+                for (std::size_t axis = 0; axis < 3; ++axis) {
+                    low[axis] = std::min(low[axis], p[axis] - margin);
+                    high[axis] = std::max(high[axis], p[axis] + margin);
+                }
+            }
+        }
+
+        auto contains = [&](const FacilityLocation& location) {
+            return (location.position.latitude >= south) && (location.position.latitude <= north)
+                && lonInside(location.position.longitude) && accept(location);
+        };
+        boxIn(0, entries_.size(), 0, low, high, contains, result);
+        return result;
+    }
+
+    [[nodiscard]]
+    std::vector<const FacilityLocation*> inBox(double south, double west, double north, double east) const {
+        return inBox(south, west, north, east, [](const FacilityLocation&) { return true; });
+    }
+
+
+    /**
+     * Writes the index to a file. The data is written to a temporary file next to it first and then renamed.
+     *
+     * @param path The file to (over)write.
+     * @returns true if the file was written.
+     */
+    bool save(const std::filesystem::path& path) const {
+        auto temp = path;
+        temp += ".tmp";
+        {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            const Header header{ .magic = magic, .formatVersion = formatVersion, .entrySize = sizeof(FacilityLocation),
+                                 .leafSize = leafSize, .count = entries_.size() };
+            out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            out.write(reinterpret_cast<const char*>(entries_.data()), static_cast<std::streamsize>(entries_.size() * sizeof(FacilityLocation)));
+            if (!out) {
+                out.close();
+                std::error_code ignored;
+                std::filesystem::remove(temp, ignored);
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temp, path, error);
+        return !error;
+    }
+
+
+    /**
+     * Reads an index written by save().
+     *
+     * @param path The file to read.
+     * @returns The index, or nothing if the file is missing, damaged, or written by an incompatible version.
+     */
+    [[nodiscard]]
+    static std::optional<FacilityIndex> load(const std::filesystem::path& path) {
+        MappedFile file;
+        if (!file.open(path)) {
+            return std::nullopt;
+        }
+        const auto bytes = file.bytes();
+        Header header{};
+        if (bytes.size() < sizeof(Header)) {
+            return std::nullopt;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+        if ((header.magic != magic) || (header.formatVersion != formatVersion) || (header.entrySize != sizeof(FacilityLocation))
+            || (header.leafSize != leafSize) || (header.count != (bytes.size() - sizeof(Header)) / sizeof(FacilityLocation))
+            || ((bytes.size() - sizeof(Header)) % sizeof(FacilityLocation) != 0))
+        {
+            return std::nullopt;
+        }
+        std::vector<FacilityLocation> entries(static_cast<std::size_t>(header.count));
+        std::memcpy(entries.data(), bytes.data() + sizeof(Header), entries.size() * sizeof(FacilityLocation));
+        return FacilityIndex(std::move(entries));
+    }
+};
+
+
+/**
+ * Collects the results of FacilityListHandler requests into a FacilityIndex.
+ *
+ * Pass the handlers returned by airports(), waypoints(), ndbs(), and vors() to the list requests, and call build()
+ * once they are done. The builder is not synchronized; use it from the thread that dispatches the messages.
+ */
+class FacilityIndexBuilder {
+    std::vector<FacilityLocation> entries_;
+
+public:
+    FacilityIndexBuilder() = default;
+
+    // No copies or moves, as the handlers refer to the builder.
+    FacilityIndexBuilder(const FacilityIndexBuilder&) = delete;
+    FacilityIndexBuilder(FacilityIndexBuilder&&) = delete;
+    FacilityIndexBuilder& operator=(const FacilityIndexBuilder&) = delete;
+    FacilityIndexBuilder& operator=(FacilityIndexBuilder&&) = delete;
+    ~FacilityIndexBuilder() = default;
+
+
+    void reserve(std::size_t count) { entries_.reserve(count); }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return entries_.size(); }
+
+
+    /**
+     * Adds a facility. Identifiers and regions longer than the fixed fields are truncated.
+     */
+    void add(FacilityListType type, std::string_view ident, std::string_view region, const LatLonAlt& position) {
+        entries_.push_back(FacilityLocation::of(type, ident, region, position));
+    }
+
+
+    [[nodiscard]]
+    AirportHandler airports() {
+        return [this](std::string_view ident, std::string_view region, const AirportDetails& details) {
+            add(FacilityListTypes::airport, ident, region, details);
+        };
+    }
+
+    [[nodiscard]]
+    WaypointHandler waypoints() {
+        return [this](std::string_view ident, std::string_view region, const WaypointDetails& details) {
+            add(FacilityListTypes::waypoint, ident, region, details);
+        };
+    }
+
+    [[nodiscard]]
+    NdbHandler ndbs() {
+        return [this](std::string_view ident, std::string_view region, const NdbDetails& details) {
+            add(FacilityListTypes::ndb, ident, region, details);
+        };
+    }
+
+    [[nodiscard]]
+    VorHandler vors() {
+        return [this](std::string_view ident, std::string_view region, const VorDetails& details) {
+            add(FacilityListTypes::vor, ident, region, details);
+        };
+    }
+
+
+    /**
+     * Builds the index from the facilities added so far, and empties the builder.
+     */
+    [[nodiscard]]
+    FacilityIndex build() {
+        return FacilityIndex::build(std::exchange(entries_, {}));
+    }
+};
+
+} // namespace SimConnect
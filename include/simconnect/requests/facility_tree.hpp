@@ -0,0 +1,416 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/util/monotonic_arena.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A single record of a facility tree, such as an airport, one of its runways, or a parking spot.
+ *
+ * The record's data is the part of the Messages::FacilityDataMsg after the header, laid out according to the facility
+ * definition used; read it with as<T>(), where T is one of the Facilities data structs such as Facilities::RunwayData.
+ */
+struct FacilityNode {
+    FacilityDataType type{};
+    std::uint32_t uniqueId{ 0 };        ///< The UniqueRequestId of the message.
+    std::uint32_t index{ 0 };           ///< The position of this node in the tree, in depth-first order.
+    std::uint32_t itemIndex{ 0 };       ///< For list items, the index in the list.
+    std::uint32_t listSize{ 0 };        ///< For list items, the size of the list.
+    bool isListItem{ false };
+
+    const std::byte* data{ nullptr };
+    std::size_t size{ 0 };
+
+    const FacilityNode* parent{ nullptr };
+    const FacilityNode* firstChild{ nullptr };
+    const FacilityNode* lastChild{ nullptr };
+    const FacilityNode* nextSibling{ nullptr };
+    std::uint32_t childCount{ 0 };
+
+
+    /**
+     * Returns the data as one of the Facilities data structs.
+     *
+     * @throws SimConnectException if the record is smaller than T, such as when it was requested with another
+     *         facility definition.
+     */
+    template <class T>
+    [[nodiscard]]
+    const T& as() const {
+        if (size < sizeof(T)) {
+            throw SimConnectException(std::format("Facility record of {} bytes is too small for a {} byte struct.", size, sizeof(T)));
+        }
+        return *reinterpret_cast<const T*>(data);
+    }
+
+
+    /**
+     * A forward range over the children of a node, optionally only those of a single type.
+     */
+    class Children {
+        const FacilityNode* first_;
+        std::optional<FacilityDataType> type_;
+
+    public:
+        class iterator {
+            const FacilityNode* node_;
+            std::optional<FacilityDataType> type_;
+
+            void skip() noexcept {
+                while ((node_ != nullptr) && type_ && (node_->type != *type_)) {
+                    node_ = node_->nextSibling;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FacilityNode;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const FacilityNode*;
+            using reference = const FacilityNode&;
+
+            iterator() noexcept : node_(nullptr) {}
+            iterator(const FacilityNode* node, std::optional<FacilityDataType> type) noexcept : node_(node), type_(type) { skip(); }
+
+            reference operator*() const noexcept { return *node_; }
+            pointer operator->() const noexcept { return node_; }
+            iterator& operator++() noexcept { node_ = node_->nextSibling; skip(); return *this; }
+            iterator operator++(int) noexcept { auto copy = *this; ++*this; return copy; }
+            bool operator==(const iterator& other) const noexcept { return node_ == other.node_; }
+        };
+
+        Children(const FacilityNode* first, std::optional<FacilityDataType> type) noexcept : first_(first), type_(type) {}
+
+        [[nodiscard]] iterator begin() const noexcept { return { first_, type_ }; }
+        [[nodiscard]] iterator end() const noexcept { return {}; }
+    };
+
+
+    /**
+     * Returns the children of this node, in the order they were received.
+     */
+    [[nodiscard]]
+    Children children() const noexcept { return { firstChild, std::nullopt }; }
+
+    /**
+     * Returns the children of this node of the given type, such as FacilityDataTypes::runway.
+     */
+    [[nodiscard]]
+    Children children(FacilityDataType childType) const noexcept { return { firstChild, childType }; }
+};
+
+
+/**
+ * A finished facility tree. All nodes and their data live in a single block owned by the tree, with the nodes in
+ * depth-first order, so the tree is cheap to move and to free.
+ */
+class FacilityTree {
+    std::unique_ptr<std::byte[]> block_;
+    std::size_t bytes_{ 0 };
+    std::size_t nodeCount_{ 0 };
+
+public:
+    FacilityTree() = default;
+    FacilityTree(std::unique_ptr<std::byte[]> block, std::size_t bytes, std::size_t nodeCount) noexcept
+        : block_(std::move(block)), bytes_(bytes), nodeCount_(nodeCount) {}
+
+    FacilityTree(const FacilityTree&) = delete;
+    FacilityTree& operator=(const FacilityTree&) = delete;
+    FacilityTree(FacilityTree&&) noexcept = default;
+    FacilityTree& operator=(FacilityTree&&) noexcept = default;
+    ~FacilityTree() = default;
+
+
+    [[nodiscard]]
+    bool empty() const noexcept { return nodeCount_ == 0; }
+
+    /**
+     * Returns the root of the tree, usually the airport, or nullptr if the tree is empty.
+     */
+    [[nodiscard]]
+    const FacilityNode* root() const noexcept { return empty() ? nullptr : nodes(); }
+
+    /**
+     * Returns all nodes, in depth-first order.
+     */
+    [[nodiscard]]
+    const FacilityNode* nodes() const noexcept { return reinterpret_cast<const FacilityNode*>(block_.get()); }
+
+    [[nodiscard]]
+    std::size_t nodeCount() const noexcept { return nodeCount_; }
+
+    /**
+     * Returns the size of the tree's memory block.
+     */
+    [[nodiscard]]
+    std::size_t bytes() const noexcept { return bytes_; }
+};
+
+
+/**
+ * Builds facility trees from the stream of Messages::FacilityDataMsg records of facility data requests.
+ *
+ * The records of a request are linked into a tree by their UniqueRequestId and ParentUniqueRequestId. While a request
+ * is running, its nodes are collected in an arena of their own, so requests can be interleaved. finish() then copies the
+ * tree into a single exactly-sized block, and the arena is kept for the next request. A finished airport therefore
+ * costs one allocation, however many runways, parkings, and frequencies it has.
+ *
+ * The assembler is not thread-safe; feed it from the thread dispatching messages.
+ */
+class FacilityTreeAssembler {
+    using Node = FacilityNode;
+
+    struct Assembly {
+        MonotonicArena arena;
+        std::vector<std::pair<std::uint32_t, Node*>> byId;     ///< Sorted by unique ID; kept with its capacity on recycle.
+        Node* root{ nullptr };
+        std::size_t nodeCount{ 0 };
+        std::size_t dataBytes{ 0 };
+    };
+
+    std::unordered_map<RequestId, std::unique_ptr<Assembly>> active_;
+    std::vector<std::unique_ptr<Assembly>> spare_;
+    std::vector<const FacilityNode*> order_;    ///< Reused during finish().
+    std::vector<const FacilityNode*> stack_;    ///< Reused during finish().
+    std::size_t orphans_{ 0 };
+
+
+    static constexpr std::size_t aligned(std::size_t size) noexcept {
+        return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    }
+
+    Assembly& assembly(RequestId requestId) {
+        auto& slot = active_[requestId];
+        if (!slot) {
+            if (spare_.empty()) {
+                slot = std::make_unique<Assembly>();
+            } else {
+                slot = std::move(spare_.back());
+                spare_.pop_back();
+            }
+        }
+        return *slot;
+    }
+
+    static Node* find(const Assembly& assembly, std::uint32_t uniqueId) noexcept {
+        auto it = std::lower_bound(assembly.byId.begin(), assembly.byId.end(), uniqueId,
+                                   [](const auto& entry, std::uint32_t id) { return entry.first < id; });
+        return ((it != assembly.byId.end()) && (it->first == uniqueId)) ? it->second : nullptr;
+    }
+
+    /**
+     * Adds a node to the index. Unique IDs normally arrive in increasing order, making this an append.
+     */
+    static void index(Assembly& assembly, Node* node) {
+        auto& byId = assembly.byId;
+        if (byId.empty() || (byId.back().first < node->uniqueId)) {
+            byId.emplace_back(node->uniqueId, node);
+            return;
+        }
+        auto it = std::lower_bound(byId.begin(), byId.end(), node->uniqueId,
+                                   [](const auto& entry, std::uint32_t id) { return entry.first < id; });
+        if ((it != byId.end()) && (it->first == node->uniqueId)) {
+            it->second = node;
+        } else {
+            byId.emplace(it, node->uniqueId, node);
+        }
+    }
+
+    void recycle(std::unique_ptr<Assembly> assembly) {
+        assembly->arena.reset();
+        assembly->byId.clear();
+        assembly->root = nullptr;
+        assembly->nodeCount = 0;
+        assembly->dataBytes = 0;
+        spare_.push_back(std::move(assembly));
+    }
+
+
+    FacilityTree compact(const Assembly& assembly) {
+        order_.clear();
+        order_.reserve(assembly.nodeCount);
+        if (assembly.root != nullptr) {
+            // Depth-first, children in the order they were received.
+            stack_.assign(1, assembly.root);
+            while (!stack_.empty()) {
+                const auto* node = stack_.back();
+                stack_.pop_back();
+                const_cast<FacilityNode*>(node)->index = static_cast<std::uint32_t>(order_.size());
+                order_.push_back(node);
+
+                const auto first = stack_.size();
+                for (const auto* child = node->firstChild; child != nullptr; child = child->nextSibling) {
+                    stack_.push_back(child);
+                }
+                std::reverse(stack_.begin() + static_cast<std::ptrdiff_t>(first), stack_.end());
+            }
+        }
+        if (order_.empty()) {
+            return {};
+        }
+
+        const std::size_t nodeBytes = aligned(order_.size() * sizeof(FacilityNode));
+        const std::size_t total = nodeBytes + assembly.dataBytes;
+        auto block = std::make_unique<std::byte[]>(total);
+        auto* nodes = reinterpret_cast<FacilityNode*>(block.get());
+        auto* data = block.get() + nodeBytes;
+
+        auto relocate = [nodes](const FacilityNode* node) -> const FacilityNode* {
+            return (node == nullptr) ? nullptr : &nodes[node->index];
+        };
+        for (std::size_t i = 0; i < order_.size(); ++i) {
+            const auto& source = *order_[i];
+            auto* target = ::new (&nodes[i]) FacilityNode(source);
+            target->parent = relocate(source.parent);
+            target->firstChild = relocate(source.firstChild);
+            target->lastChild = relocate(source.lastChild);
+            target->nextSibling = relocate(source.nextSibling);
+            if (source.size > 0) {
+                std::memcpy(data, source.data, source.size);
+            }
+            target->data = data;
+            data += aligned(source.size);
+        }
+        return FacilityTree{ std::move(block), total, order_.size() };
+    }
+
+
+public:
+    FacilityTreeAssembler() = default;
+
+    // No copies or moves
+    FacilityTreeAssembler(const FacilityTreeAssembler&) = delete;
+    FacilityTreeAssembler(FacilityTreeAssembler&&) = delete;
+    FacilityTreeAssembler& operator=(const FacilityTreeAssembler&) = delete;
+    FacilityTreeAssembler& operator=(FacilityTreeAssembler&&) = delete;
+    ~FacilityTreeAssembler() = default;
+
+
+    /**
+     * Adds a record to the tree of its request. A record whose parent is unknown becomes the root if the request has
+     * none yet; otherwise it is counted as an orphan and dropped.
+     *
+     * @param msg The facility data message.
+     */
+    void add(const Messages::FacilityDataMsg& msg) {
+        auto& assembly = this->assembly(static_cast<RequestId>(msg.UserRequestId));
+
+        const auto* payload = reinterpret_cast<const std::byte*>(&msg.Data);
+        const auto header = static_cast<std::size_t>(payload - reinterpret_cast<const std::byte*>(&msg));
+        const std::size_t size = (msg.dwSize > header) ? (msg.dwSize - header) : 0;
+
+        Node* parent = find(assembly, static_cast<std::uint32_t>(msg.ParentUniqueRequestId));
+        if ((parent == nullptr) && (assembly.root != nullptr)) {
+            ++orphans_;
+            return;
+        }
+
+        auto* node = assembly.arena.create<Node>();
+        node->type = msg.Type;
+        node->uniqueId = static_cast<std::uint32_t>(msg.UniqueRequestId);
+        node->itemIndex = static_cast<std::uint32_t>(msg.ItemIndex);
+        node->listSize = static_cast<std::uint32_t>(msg.ListSize);
+        node->isListItem = (msg.IsListItem != 0);
+        if (size > 0) {
+            auto* copy = static_cast<std::byte*>(assembly.arena.allocate(size, alignof(std::max_align_t)));
+            std::memcpy(copy, payload, size);
+            node->data = copy;
+            node->size = size;
+        }
+        if (parent == nullptr) {
+            assembly.root = node;
+        } else {
+            node->parent = parent;
+            if (parent->lastChild == nullptr) {
+                parent->firstChild = node;
+            } else {
+                const_cast<FacilityNode*>(parent->lastChild)->nextSibling = node;
+            }
+            parent->lastChild = node;
+            ++parent->childCount;
+        }
+        index(assembly, node);
+        ++assembly.nodeCount;
+        assembly.dataBytes += aligned(size);
+    }
+
+
+    /**
+     * Finishes the tree of a request, usually when the FacilityDataEndMsg arrives.
+     *
+     * @param requestId The request ID.
+     * @returns The tree, which is empty if no records were received.
+     */
+    [[nodiscard]]
+    FacilityTree finish(RequestId requestId) {
+        auto it = active_.find(requestId);
+        if (it == active_.end()) {
+            return {};
+        }
+        auto assembly = std::move(it->second);
+        active_.erase(it);
+
+        auto tree = compact(*assembly);
+        recycle(std::move(assembly));
+        return tree;
+    }
+
+
+    /**
+     * Drops the partial tree of a request, for example after a conflict or an exception.
+     */
+    void discard(RequestId requestId) {
+        if (auto it = active_.find(requestId); it != active_.end()) {
+            auto assembly = std::move(it->second);
+            active_.erase(it);
+            recycle(std::move(assembly));
+        }
+    }
+
+
+    /**
+     * Returns the number of requests with a tree in progress.
+     */
+    [[nodiscard]]
+    std::size_t active() const noexcept { return active_.size(); }
+
+    /**
+     * Returns the number of records dropped because their parent was not known.
+     */
+    [[nodiscard]]
+    std::size_t orphans() const noexcept { return orphans_; }
+};
+
+} // namespace SimConnect
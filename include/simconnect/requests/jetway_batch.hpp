@@ -0,0 +1,278 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <simconnect/simconnect.hpp>
+#include <simconnect/simconnect_exception.hpp>
+#include <simconnect/requests/facilities/facility_key.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * The jetways wanted at one airport.
+ */
+struct JetwayQuery {
+    std::string_view icao;
+    std::span<const int> indices{};     ///< The parking indices, or empty for all jetways at the airport.
+};
+
+
+/**
+ * The jetways received for one airport in a JetwayBatch.
+ */
+struct AirportJetways {
+    std::string icao;
+    bool allJetways{ false };                   ///< True if all jetways were requested, rather than the indices.
+    std::vector<int> indices{};                 ///< The requested parking indices, sorted and without duplicates.
+    std::vector<Facilities::Jetway> jetways{};  ///< The jetways, in the order they were received.
+    bool complete{ false };
+    bool failed{ false };                       ///< The request failed, or SimConnect answered it with an exception.
+};
+
+
+/**
+ * Requests the jetways at many airports, with a single completion callback for the whole batch.
+ *
+ * The queries are coalesced per airport, so every airport gets one SimConnect_RequestJetwayData call, however many
+ * queries name it. The jetways of each airport are collected in one contiguous vector, copied straight from the
+ * messages. When every airport is complete, the callback is called once with all of them.
+ *
+ * SimConnect_RequestJetwayData does not take a request ID, so the answers are matched by the airport's ICAO code.
+ * Every call of the batch is tagged with its SendID, so an exception for one of them marks exactly that airport as
+ * failed. An answer without jetways carries neither code nor ID, and is taken to answer the oldest call of the batch
+ * still waiting, as SimConnect answers in order. Two batches waiting for the same airport at the same time will both
+ * take the answer.
+ *
+ * @tparam M The type of the SimConnect message handler, which must be derived from SimConnectMessageHandler.
+ */
+template <class M>
+class JetwayBatch
+{
+public:
+    using simconnect_message_handler_type = M;
+    using done_type = std::function<void(std::span<const AirportJetways> airports)>;
+
+
+private:
+    static_assert(sizeof(Facilities::Jetway) == sizeof(SIMCONNECT_JETWAY_DATA), "Jetway must match SIMCONNECT_JETWAY_DATA.");
+
+    M& handler_;
+    done_type onDone_;
+
+    std::vector<AirportJetways> airports_;
+    std::unordered_map<Facilities::FacilityKey, std::size_t> index_;
+    struct Waiting {
+        SendId sendId;                          ///< The SendID of the call.
+        std::size_t index;                      ///< The airport.
+    };
+
+    std::size_t sent_{ 0 };                     ///< The airports up to here have been requested.
+    std::deque<Waiting> waiting_;               ///< Requested and not complete, in the order they were requested.
+    bool reported_{ false };                    ///< The callback was called, and no airports were added since.
+
+    typename M::handler_id_type jetwayHandlerId_{};
+    typename M::handler_id_type exceptionHandlerId_{};
+
+
+    // No copies or moves
+    JetwayBatch(const JetwayBatch&) = delete;
+    JetwayBatch(JetwayBatch&&) = delete;
+    JetwayBatch& operator=(const JetwayBatch&) = delete;
+    JetwayBatch& operator=(JetwayBatch&&) = delete;
+
+
+    void complete(std::size_t index, bool failed) {
+        auto& airport = airports_[index];
+        if (airport.complete) {
+            return;
+        }
+        airport.complete = true;
+        airport.failed = failed;
+        std::erase_if(waiting_, [index](const Waiting& waiting) { return waiting.index == index; });
+        report();
+    }
+
+
+    void report() {
+        if (!done() || reported_) {
+            return;
+        }
+        reported_ = true;
+        if (onDone_) {
+            onDone_(airports_);
+        }
+    }
+
+
+    void received(const Messages::JetwayDataMsg& msg) {
+        std::size_t index{ 0 };
+        if (msg.dwArraySize > 0) {
+            const auto it = index_.find(Facilities::FacilityKey::of({ &msg.rgData[0].AirportIcao[0], sizeof(msg.rgData[0].AirportIcao) }));
+            if ((it == index_.end()) || (it->second >= sent_) || airports_[it->second].complete) {
+                return;
+            }
+            index = it->second;
+        } else if (!waiting_.empty()) {
+            index = waiting_.front().index;
+        } else {
+            return;
+        }
+
+        const auto* first = reinterpret_cast<const Facilities::Jetway*>(&msg.rgData[0]);
+        auto& jetways = airports_[index].jetways;
+        jetways.insert(jetways.end(), first, first + msg.dwArraySize);
+
+        if ((msg.dwEntryNumber + 1) >= msg.dwOutOf) {
+            complete(index, false);
+        }
+    }
+
+
+    void exception(const Messages::ExceptionMsg& msg) {
+        const auto it = std::ranges::find(waiting_, static_cast<SendId>(msg.dwSendID), &Waiting::sendId);
+        if (it != waiting_.end()) {
+            complete(it->index, true);
+        }
+    }
+
+
+public:
+    /**
+     * Creates an empty batch. Add airports with add(), and then call send().
+     *
+     * @param handler The SimConnect message handler, used to send the requests and receive the answers.
+     * @param onDone Called once all airports are complete.
+     */
+    JetwayBatch(M& handler, done_type onDone)
+        : handler_(handler), onDone_(std::move(onDone))
+    {
+        jetwayHandlerId_ = handler_.template registerHandler<Messages::JetwayDataMsg>(Messages::jetwayData,
+            [this](const Messages::JetwayDataMsg& msg) { received(msg); });
+        exceptionHandlerId_ = handler_.template registerHandler<Messages::ExceptionMsg>(Messages::exception,
+            [this](const Messages::ExceptionMsg& msg) { exception(msg); });
+    }
+
+    /**
+     * Creates a batch for the given queries, and sends it.
+     *
+     * @param handler The SimConnect message handler, used to send the requests and receive the answers.
+     * @param queries The airports and jetways to request.
+     * @param onDone Called once all airports are complete.
+     */
+    JetwayBatch(M& handler, std::span<const JetwayQuery> queries, done_type onDone)
+        : JetwayBatch(handler, std::move(onDone))
+    {
+        for (const auto& query : queries) {
+            add(query.icao, query.indices);
+        }
+        send();
+    }
+
+    ~JetwayBatch() {
+        handler_.unRegisterHandler(Messages::jetwayData, jetwayHandlerId_);
+        handler_.unRegisterHandler(Messages::exception, exceptionHandlerId_);
+    }
+
+
+    /**
+     * Adds jetways to request. Queries for an airport that is already in the batch are merged with it.
+     *
+     * @param icao The ICAO code of the airport.
+     * @param indices The parking indices, or empty for all jetways at the airport.
+     * @returns This batch, for chaining.
+     * @throws SimConnectException if the airport was already requested by send().
+     */
+    JetwayBatch& add(std::string_view icao, std::span<const int> indices = {}) {
+        const auto [it, inserted] = index_.try_emplace(Facilities::FacilityKey::of(icao), airports_.size());
+        if (inserted) {
+            airports_.push_back(AirportJetways{ .icao = std::string(icao), .allJetways = indices.empty() });
+            reported_ = false;
+        } else if (it->second < sent_) {
+            throw SimConnectException("Cannot add jetways to an airport that has already been requested.");
+        }
+        auto& airport = airports_[it->second];
+        if (indices.empty()) {
+            airport.allJetways = true;
+            airport.indices.clear();
+        } else if (!airport.allJetways) {
+            airport.indices.insert(airport.indices.end(), indices.begin(), indices.end());
+        }
+        return *this;
+    }
+
+
+    /**
+     * Requests the airports added since the last call, one call per airport. If every airport is already complete,
+     * which includes an empty batch, the completion callback is called straight away, unless it was already called
+     * and no airports were added since.
+     */
+    void send() {
+        for (; sent_ < airports_.size(); ++sent_) {
+            auto& airport = airports_[sent_];
+            std::ranges::sort(airport.indices);
+            airport.indices.erase(std::unique(airport.indices.begin(), airport.indices.end()), airport.indices.end());
+            airport.jetways.reserve(airport.indices.size());
+
+            handler_.connection().requestJetwayData(airport.icao, std::span<const int>{ airport.indices });
+            if (handler_.connection().failed()) {
+                airport.complete = true;
+                airport.failed = true;
+            } else {
+                waiting_.push_back({ .sendId = handler_.connection().fetchSendId(), .index = sent_ });
+            }
+        }
+        report();
+    }
+
+
+    /**
+     * Returns true if all requested airports are complete.
+     */
+    [[nodiscard]]
+    bool done() const noexcept { return waiting_.empty() && (sent_ == airports_.size()); }
+
+
+    /**
+     * Returns the airports, in the order they were first added.
+     */
+    [[nodiscard]]
+    std::span<const AirportJetways> airports() const noexcept { return airports_; }
+
+
+    /**
+     * Returns the jetways for an airport, or nullptr if it is not in the batch.
+     */
+    [[nodiscard]]
+    const AirportJetways* find(std::string_view icao) const {
+        const auto it = index_.find(Facilities::FacilityKey::of(icao));
+        return (it == index_.end()) ? nullptr : &airports_[it->second];
+    }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,208 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <simconnect/simconnect.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A record of a single call sent to SimConnect.
+ */
+struct SendRecord {
+    static constexpr std::size_t maxNameLength{ 63 };
+
+    SendId sendId{ noId };
+    const char* operation{ nullptr };       ///< The SimConnect function called, always a string literal.
+    unsigned long id{ unused };             ///< The main ID argument, such as the data definition or client data ID.
+    unsigned long requestId{ unused };      ///< The request ID, if the call has one.
+    std::array<char, maxNameLength + 1> name{};    ///< The main name argument, such as the simulation variable, truncated.
+
+
+    /**
+     * Returns the name argument.
+     */
+    [[nodiscard]]
+    std::string_view nameView() const noexcept { return name.data(); }
+
+
+    /**
+     * Returns a short description of the call, for logging.
+     */
+    [[nodiscard]]
+    std::string describe() const {
+        std::string result{ std::format("{} (sendId={}", (operation == nullptr) ? "unknown call" : operation, sendId) };
+        if (id != unused) {
+            result += std::format(", id={}", id);
+        }
+        if (requestId != unused) {
+            result += std::format(", requestId={}", requestId);
+        }
+        if (name[0] != '\0') {
+            result += std::format(", '{}'", nameView());
+        }
+        result += ')';
+        return result;
+    }
+};
+
+
+/**
+ * A fixed-size ring of the most recently sent calls, indexed by SendId.
+ *
+ * Exception messages only carry the SendId of the call that caused them. The connection records every call it sends
+ * here, so an exception handler can look up which call it was, and with which arguments, without searching. Recording
+ * is a handful of stores into a preallocated slot; there are no allocations or locks on the send path.
+ *
+ * Only the connection writes, and it does so with its lock held. Lookups may come from any thread: each slot carries a
+ * version counter that is odd while the slot is being written, and a lookup that sees it change simply reports the
+ * record as gone.
+ */
+class SendHistory {
+    struct Slot {
+        std::atomic<std::uint32_t> version{ 0 };
+        SendRecord record;
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+
+public:
+    static constexpr std::size_t defaultCapacity{ 256 };
+
+
+    /**
+     * Creates a history.
+     *
+     * @param capacity The number of calls to remember, rounded up to a power of two.
+     */
+    explicit SendHistory(std::size_t capacity = defaultCapacity)
+        : mask_(std::bit_ceil(std::max(capacity, std::size_t{ 1 })) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1))
+    {
+    }
+
+    // No copies or moves
+    SendHistory(const SendHistory&) = delete;
+    SendHistory(SendHistory&&) = delete;
+    SendHistory& operator=(const SendHistory&) = delete;
+    SendHistory& operator=(SendHistory&&) = delete;
+    ~SendHistory() = default;
+
+
+    /**
+     * Returns the number of calls remembered.
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+
+    /**
+     * Changes the capacity, forgetting all recorded calls.
+     *
+     * @note This is not safe while other threads record or look up calls, so do it before opening the connection.
+     * @param capacity The number of calls to remember, rounded up to a power of two.
+     */
+    void resize(std::size_t capacity) {
+        mask_ = std::bit_ceil(std::max(capacity, std::size_t{ 1 })) - 1;
+        slots_ = std::make_unique<Slot[]>(mask_ + 1);
+    }
+
+
+    /**
+     * Records a call, overwriting the oldest one sharing its slot.
+     *
+     * @param sendId The SendId of the call.
+     * @param operation The SimConnect function called. Must be a string literal or otherwise outlive the history.
+     * @param id The main ID argument, or unused.
+     * @param name The main name argument, which is truncated if needed.
+     * @param requestId The request ID, or unused.
+     */
+    void record(SendId sendId, const char* operation, unsigned long id = unused, std::string_view name = {},
+                unsigned long requestId = unused) noexcept
+    {
+        auto& slot = slots_[sendId & mask_];
+        const auto version = slot.version.load(std::memory_order_relaxed);
+
+        slot.version.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& rec = slot.record;
+        rec.sendId = sendId;
+        rec.operation = operation;
+        rec.id = id;
+        rec.requestId = requestId;
+        const auto length = std::min(name.size(), SendRecord::maxNameLength);
+        std::copy_n(name.data(), length, rec.name.data());
+        rec.name[length] = '\0';
+
+        slot.version.store(version + 2, std::memory_order_release);
+    }
+
+
+    /**
+     * Looks up a call by its SendId.
+     *
+     * @param sendId The SendId, usually ExceptionMsg::dwSendID.
+     * @returns A copy of the record, or std::nullopt if the call was never recorded or has since been overwritten.
+     */
+    [[nodiscard]]
+    std::optional<SendRecord> find(SendId sendId) const noexcept {
+        if (sendId == noId) {
+            return std::nullopt;
+        }
+        const auto& slot = slots_[sendId & mask_];
+        const auto before = slot.version.load(std::memory_order_acquire);
+        if ((before & 1U) != 0) {
+            return std::nullopt;
+        }
+        SendRecord copy{ slot.record };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) != before || copy.sendId != sendId) {
+            return std::nullopt;
+        }
+        return copy;
+    }
+
+
+    /**
+     * Looks up the call an exception refers to.
+     *
+     * @param msg The exception message.
+     * @returns A copy of the record, or std::nullopt if the call is not (or no longer) known.
+     */
+    [[nodiscard]]
+    std::optional<SendRecord> find(const Messages::ExceptionMsg& msg) const noexcept {
+        return find(static_cast<SendId>(msg.dwSendID));
+    }
+};
+
+} // namespace SimConnect
@@ -16,12 +16,14 @@
  */
 
 #include <chrono>
+#include <cstddef>
 #include <array>
 #include <functional>
 
 #include <simconnect.hpp>
 #include <simconnect/simconnect.hpp>
 
+#include <simconnect/connection_metrics.hpp>
 #include <simconnect/messaging/handler_policy.hpp>
 #include <simconnect/messaging/message_dispatcher.hpp>
 
@@ -202,22 +204,66 @@ public:
     }
 
 
+    /**
+     * Dispatches at most `maxMessages` waiting messages without blocking, for use from an external event loop. Wait on the
+     * connection's readiness handle, and call this when it is signalled. Because the readiness signal may already have
+     * been consumed, a return value of `maxMessages` means more messages can be waiting; if the connection can re-signal
+     * itself it is asked to do so, otherwise the caller should schedule another drain.
+     *
+     * @param maxMessages The maximum number of messages to dispatch.
+     * @returns The number of messages dispatched.
+     */
+    std::size_t drain(std::size_t maxMessages) {
+        std::size_t count{ 0 };
+        Messages::MsgBase* msg{ nullptr };
+        unsigned long size{ 0 };
+
+        while ((count < maxMessages) && connection_.isOpen() && connection_.getNextDispatch(msg, size)) {
+            dispatchReceived(msg, size);
+            ++count;
+        }
+        if constexpr (requires { connection_.signalReady(); }) {
+            if ((count == maxMessages) && (maxMessages > 0) && connection_.isOpen()) {
+                connection_.signalReady();
+            }
+        }
+        return count;
+    }
+
+
 protected:
+    /**
+     * Checks a message received from SimConnect and dispatches it.
+     *
+     * @param msg The message.
+     * @param size The size SimConnect reported for it.
+     */
+    void dispatchReceived(const Messages::MsgBase* msg, unsigned long size) {
+        if (msg == nullptr) {
+            this->logger().warn("Received null message from SimConnect");
+            return;
+        }
+        if (size < msg->dwSize) {
+            this->logger().warn("Received message size {} is too small for message of type {} that claims to be size {}.", size, msg->dwID, msg->dwSize);
+            return;
+        }
+        if constexpr (MetricsConnection<C>) {
+            const auto start = std::chrono::steady_clock::now();
+            dispatch(msg);
+            connection_.metrics().messageDispatched(static_cast<MessageId>(msg->dwID), size, std::chrono::steady_clock::now() - start);
+        } else {
+            dispatch(msg);
+        }
+    }
+
+
     /**
      * Dispatches any waiting messages.
      */
     void dispatchWaitingMessages() {
         volatile bool gotMessages{ false };
         while (connection_.callDispatch([this, &gotMessages](const Messages::MsgBase* msg, unsigned long size) {
-            if (msg == nullptr) {
-                this->logger().warn("Received null message from SimConnect");
-                return;
-            }
-            if (size < msg->dwSize) {
-                this->logger().warn("Received message size {} is too small for message of type {} that claims to be size {}.", size, msg->dwID, msg->dwSize);
-                return;
-            }
-            dispatch(msg);
+            dispatchReceived(msg, size);
             gotMessages = true;
         }) && gotMessages) {
             gotMessages = false; // Keep dispatching while there are messages
@@ -0,0 +1,677 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+
+namespace SimConnect {
+
+
+/**
+ * A JsonCursor is a read-only view on a single JSON value inside a text, typically a CommBus payload.
+ *
+ * Nothing is parsed up-front: constructing a cursor only checks that the text is structurally one JSON value,
+ * and navigating with operator[], at(), members(), or elements() scans the text on demand, skipping values that
+ * are not asked for. No DOM is built and nothing is allocated; every cursor and string it returns refers into the
+ * original text, which must outlive them.
+ *
+ * Lookups that fail, or type mismatches, produce an invalid cursor or std::nullopt rather than throwing, so
+ * navigation can be chained: `JsonCursor(payload)["fuel"]["left"].asNumber<double>()`.
+ *
+ * @note Object keys are compared after unescaping, but strings are only unescaped when asked for with equals(),
+ * appendTo(), or copyTo(); rawString() returns the text between the quotes as-is.
+ */
+class JsonCursor {
+public:
+    enum class Type {
+        invalid,
+        null,
+        boolean,
+        number,
+        string,
+        array,
+        object
+    };
+
+
+    /**
+     * A member of a JSON object.
+     */
+    struct Member;
+    class MemberIterator;
+    class ElementIterator;
+
+
+    /**
+     * A begin/end pair of iterators, usable in a range-based for loop.
+     */
+    template <class It>
+    struct Range {
+        It first;
+        It last;
+
+        [[nodiscard]] constexpr It begin() const noexcept { return first; }
+        [[nodiscard]] constexpr It end() const noexcept { return last; }
+    };
+
+
+private:
+    static constexpr std::size_t npos{ std::string_view::npos };
+    static constexpr std::size_t maxDepth{ 64 };
+
+    std::string_view json_;     ///< The exact text of this value, or empty if invalid.
+
+
+    struct AlreadyScanned {};
+    constexpr JsonCursor(std::string_view span, AlreadyScanned) noexcept : json_(span) {}
+
+
+    [[nodiscard]]
+    static constexpr bool isSpace(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t skipSpace(std::string_view text, std::size_t pos) noexcept {
+        while (pos < text.size() && isSpace(text[pos])) {
+            ++pos;
+        }
+        return pos;
+    }
+
+
+    /**
+     * Skips a string starting at the opening quote, returning the position after the closing quote, or npos.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t skipString(std::string_view text, std::size_t pos) noexcept {
+        for (++pos; pos < text.size(); ++pos) {
+            const auto c = static_cast<unsigned char>(text[pos]);
+            if (c == '\\') {
+                ++pos;
+            } else if (c == '"') {
+                return pos + 1;
+            } else if (c < 0x20) {
+                return npos;
+            }
+        }
+        return npos;
+    }
+
+
+    [[nodiscard]]
+    static constexpr std::size_t skipLiteral(std::string_view text, std::size_t pos, std::string_view literal) noexcept {
+        return (text.substr(pos, literal.size()) == literal) ? pos + literal.size() : npos;
+    }
+
+
+    [[nodiscard]]
+    static constexpr std::size_t skipNumber(std::string_view text, std::size_t pos) noexcept {
+        const auto start = pos;
+        while (pos < text.size()) {
+            const char c = text[pos];
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+                ++pos;
+            } else {
+                break;
+            }
+        }
+        return (pos == start) ? npos : pos;
+    }
+
+
+    /**
+     * Skips an object or array, checking that brackets and braces are properly nested.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t skipContainer(std::string_view text, std::size_t pos) noexcept {
+        std::uint64_t isObject{ 0 };    // One bit per nesting level
+        std::size_t depth{ 0 };
+        while (pos < text.size()) {
+            const char c = text[pos];
+            if (c == '"') {
+                pos = skipString(text, pos);
+                if (pos == npos) {
+                    return npos;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                if (depth == maxDepth) {
+                    return npos;
+                }
+                isObject = (isObject << 1) | ((c == '{') ? 1U : 0U);
+                ++depth;
+            } else if (c == '}' || c == ']') {
+                if (depth == 0 || ((isObject & 1U) != 0) != (c == '}')) {
+                    return npos;
+                }
+                isObject >>= 1;
+                if (--depth == 0) {
+                    return pos + 1;
+                }
+            }
+            ++pos;
+        }
+        return npos;
+    }
+
+
+    /**
+     * Skips the value starting at pos, which must not be whitespace, returning the position just after it, or npos.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t skipValue(std::string_view text, std::size_t pos) noexcept {
+        if (pos >= text.size()) {
+            return npos;
+        }
+        switch (text[pos]) {
+        case '"':
+            return skipString(text, pos);
+        case '{':
+        case '[':
+            return skipContainer(text, pos);
+        case 't':
+            return skipLiteral(text, pos, "true");
+        case 'f':
+            return skipLiteral(text, pos, "false");
+        case 'n':
+            return skipLiteral(text, pos, "null");
+        default:
+            return skipNumber(text, pos);
+        }
+    }
+
+
+    [[nodiscard]]
+    static constexpr int hexDigit(char c) noexcept {
+        if (c >= '0' && c <= '9') { return c - '0'; }
+        if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+        if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+        return -1;
+    }
+
+
+    [[nodiscard]]
+    static constexpr std::optional<std::uint32_t> hex4(std::string_view raw, std::size_t pos) noexcept {
+        if (pos + 4 > raw.size()) {
+            return std::nullopt;
+        }
+        std::uint32_t value{ 0 };
+        for (std::size_t i = 0; i < 4; ++i) {
+            const int digit = hexDigit(raw[pos + i]);
+            if (digit < 0) {
+                return std::nullopt;
+            }
+            value = (value << 4) | static_cast<std::uint32_t>(digit);
+        }
+        return value;
+    }
+
+
+    /**
+     * Decodes the escapes in the raw contents of a string, passing each resulting byte (UTF-8) to the sink.
+     * The sink returns false to stop early.
+     *
+     * @returns false if the string has an invalid escape, or the sink stopped.
+     */
+    template <class Sink>
+    static constexpr bool decode(std::string_view raw, Sink&& sink) {
+        for (std::size_t pos = 0; pos < raw.size(); ++pos) {
+            if (raw[pos] != '\\') {
+                if (!sink(raw[pos])) { return false; }
+                continue;
+            }
+            if (++pos == raw.size()) {
+                return false;
+            }
+            char c{ '\0' };
+            switch (raw[pos]) {
+            case '"':  c = '"';  break;
+            case '\\': c = '\\'; break;
+            case '/':  c = '/';  break;
+            case 'b':  c = '\b'; break;
+            case 'f':  c = '\f'; break;
+            case 'n':  c = '\n'; break;
+            case 'r':  c = '\r'; break;
+            case 't':  c = '\t'; break;
+            case 'u': {
+                auto codePoint = hex4(raw, pos + 1);
+                if (!codePoint) {
+                    return false;
+                }
+                pos += 4;
+                if (*codePoint >= 0xD800 && *codePoint <= 0xDBFF) {
+                    // High surrogate, must be followed by an escaped low surrogate.
+                    const auto low = (raw.substr(pos + 1, 2) == "\\u") ? hex4(raw, pos + 3) : std::nullopt;
+                    if (!low || *low < 0xDC00 || *low > 0xDFFF) {
+                        return false;
+                    }
+                    codePoint = 0x10000 + ((*codePoint - 0xD800) << 10) + (*low - 0xDC00);
+                    pos += 6;
+                }
+                const auto cp = *codePoint;
+                if (cp < 0x80) {
+                    if (!sink(static_cast<char>(cp))) { return false; }
+                } else if (cp < 0x800) {
+                    if (!sink(static_cast<char>(0xC0 | (cp >> 6))) || !sink(static_cast<char>(0x80 | (cp & 0x3F)))) { return false; }
+                } else if (cp < 0x10000) {
+                    if (!sink(static_cast<char>(0xE0 | (cp >> 12))) || !sink(static_cast<char>(0x80 | ((cp >> 6) & 0x3F))) ||
+                        !sink(static_cast<char>(0x80 | (cp & 0x3F)))) { return false; }
+                } else {
+                    if (!sink(static_cast<char>(0xF0 | (cp >> 18))) || !sink(static_cast<char>(0x80 | ((cp >> 12) & 0x3F))) ||
+                        !sink(static_cast<char>(0x80 | ((cp >> 6) & 0x3F))) || !sink(static_cast<char>(0x80 | (cp & 0x3F)))) { return false; }
+                }
+                continue;
+            }
+            default:
+                return false;
+            }
+            if (!sink(c)) { return false; }
+        }
+        return true;
+    }
+
+
+    /**
+     * Compares the raw contents of a string with an unescaped string.
+     */
+    [[nodiscard]]
+    static constexpr bool rawEquals(std::string_view raw, std::string_view expected) noexcept {
+        if (raw.find('\\') == npos) {
+            return raw == expected;
+        }
+        std::size_t matched{ 0 };
+        const bool complete = decode(raw, [&](char c) {
+            if (matched == expected.size() || expected[matched] != c) {
+                return false;
+            }
+            ++matched;
+            return true;
+        });
+        return complete && matched == expected.size();
+    }
+
+
+public:
+    constexpr JsonCursor() noexcept = default;
+
+
+    /**
+     * Creates a cursor for a complete JSON text. If the text is not a single well-nested JSON value (optionally
+     * surrounded by whitespace), the cursor is invalid.
+     *
+     * @param text The JSON text.
+     */
+    constexpr explicit JsonCursor(std::string_view text) noexcept {
+        const auto start = skipSpace(text, 0);
+        const auto end = skipValue(text, start);
+        if (end != npos && skipSpace(text, end) == text.size()) {
+            json_ = text.substr(start, end - start);
+        }
+    }
+
+
+    /**
+     * Returns true if this cursor points at a value.
+     */
+    [[nodiscard]]
+    constexpr bool isValid() const noexcept { return !json_.empty(); }
+
+    [[nodiscard]]
+    constexpr explicit operator bool() const noexcept { return isValid(); }
+
+
+    /**
+     * Returns the exact text of this value.
+     */
+    [[nodiscard]]
+    constexpr std::string_view raw() const noexcept { return json_; }
+
+
+    /**
+     * Returns the type of this value, determined by its first character.
+     */
+    [[nodiscard]]
+    constexpr Type type() const noexcept {
+        if (json_.empty()) {
+            return Type::invalid;
+        }
+        switch (json_.front()) {
+        case '{': return Type::object;
+        case '[': return Type::array;
+        case '"': return Type::string;
+        case 't':
+        case 'f': return Type::boolean;
+        case 'n': return Type::null;
+        default:  return Type::number;
+        }
+    }
+
+    [[nodiscard]] constexpr bool isNull() const noexcept { return type() == Type::null; }
+    [[nodiscard]] constexpr bool isObject() const noexcept { return type() == Type::object; }
+    [[nodiscard]] constexpr bool isArray() const noexcept { return type() == Type::array; }
+    [[nodiscard]] constexpr bool isString() const noexcept { return type() == Type::string; }
+
+
+    /**
+     * Returns the boolean value, or std::nullopt if this is not a boolean.
+     */
+    [[nodiscard]]
+    constexpr std::optional<bool> asBool() const noexcept {
+        if (json_ == "true") { return true; }
+        if (json_ == "false") { return false; }
+        return std::nullopt;
+    }
+
+
+    /**
+     * Returns the numeric value converted to T, or std::nullopt if this is not a number or does not fit in T.
+     * Integral types only accept numbers without a fraction or exponent.
+     *
+     * @tparam T The arithmetic type to convert to.
+     */
+    template <class T>
+        requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+    [[nodiscard]]
+    std::optional<T> asNumber() const noexcept {
+        if (type() != Type::number) {
+            return std::nullopt;
+        }
+        T value{};
+        const char* const end = json_.data() + json_.size();
+        const auto [ptr, ec] = std::from_chars(json_.data(), end, value);
+        if (ec != std::errc{} || ptr != end) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+
+    /**
+     * Returns the contents of a string between the quotes, with escapes left as-is, or std::nullopt if this is not a string.
+     * For strings without backslashes, this is the string's value.
+     */
+    [[nodiscard]]
+    constexpr std::optional<std::string_view> rawString() const noexcept {
+        if (type() != Type::string) {
+            return std::nullopt;
+        }
+        return json_.substr(1, json_.size() - 2);
+    }
+
+
+    /**
+     * Returns true if this is a string whose unescaped value equals the given string.
+     *
+     * @param expected The expected value.
+     */
+    [[nodiscard]]
+    constexpr bool equals(std::string_view expected) const noexcept {
+        const auto raw = rawString();
+        return raw && rawEquals(*raw, expected);
+    }
+
+
+    /**
+     * Appends the unescaped value of a string to the given string.
+     *
+     * @param out The string to append to.
+     * @returns false if this is not a string or contains an invalid escape.
+     */
+    bool appendTo(std::string& out) const {
+        const auto raw = rawString();
+        return raw && decode(*raw, [&out](char c) { out.push_back(c); return true; });
+    }
+
+
+    /**
+     * Copies the unescaped value of a string into a fixed-size buffer, without a terminating NUL.
+     *
+     * @param buffer The buffer to copy into.
+     * @param size The size of the buffer.
+     * @returns The number of bytes copied, or std::nullopt if this is not a string, contains an invalid escape, or does not fit.
+     */
+    [[nodiscard]]
+    std::optional<std::size_t> copyTo(char* buffer, std::size_t size) const noexcept {
+        const auto raw = rawString();
+        std::size_t len{ 0 };
+        if (!raw || !decode(*raw, [&](char c) {
+                if (len == size) { return false; }
+                buffer[len++] = c;
+                return true;
+            })) {
+            return std::nullopt;
+        }
+        return len;
+    }
+
+
+    /**
+     * Returns the members of an object, as a range. Iterating an invalid cursor or a non-object yields nothing.
+     */
+    [[nodiscard]]
+    constexpr Range<MemberIterator> members() const noexcept;
+
+
+    /**
+     * Returns the elements of an array, as a range. Iterating an invalid cursor or a non-array yields nothing.
+     */
+    [[nodiscard]]
+    constexpr Range<ElementIterator> elements() const noexcept;
+
+
+    /**
+     * Finds a member of an object by (unescaped) key. If the key occurs more than once, the first one wins.
+     *
+     * @param key The key to look for.
+     * @returns The member's value, or an invalid cursor if this is not an object or has no such key.
+     */
+    [[nodiscard]]
+    constexpr JsonCursor operator[](std::string_view key) const noexcept;
+
+
+    /**
+     * Returns an element of an array by index.
+     *
+     * @param index The zero-based index.
+     * @returns The element, or an invalid cursor if this is not an array or the index is out of range.
+     */
+    [[nodiscard]]
+    constexpr JsonCursor at(std::size_t index) const noexcept;
+
+
+    /**
+     * Returns the number of members of an object or elements of an array, or 0 for other values.
+     */
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept;
+};
+
+
+struct JsonCursor::Member {
+    std::string_view rawKey;    ///< The key between the quotes, with escapes left as-is.
+    JsonCursor value;           ///< The member's value.
+
+    /**
+     * Returns true if the (unescaped) key equals the given string.
+     */
+    [[nodiscard]]
+    constexpr bool keyEquals(std::string_view key) const noexcept {
+        return JsonCursor::rawEquals(rawKey, key);
+    }
+};
+
+
+/**
+ * Forward iterator over the members of an object. Members are scanned as the iterator advances.
+ */
+class JsonCursor::MemberIterator {
+    std::string_view object_;
+    std::size_t pos_{ npos };   ///< Position after the current member, or npos at the end.
+    Member current_{};
+
+    constexpr void advance() noexcept {
+        auto pos = skipSpace(object_, pos_);
+        if (pos < object_.size() && object_[pos] == ',') {
+            pos = skipSpace(object_, pos + 1);
+        }
+        if (pos >= object_.size() || object_[pos] != '"') {
+            pos_ = npos;
+            return;
+        }
+        const auto keyEnd = skipString(object_, pos);
+        auto colon = skipSpace(object_, keyEnd);
+        if (keyEnd == npos || colon >= object_.size() || object_[colon] != ':') {
+            pos_ = npos;
+            return;
+        }
+        const auto valueStart = skipSpace(object_, colon + 1);
+        const auto valueEnd = skipValue(object_, valueStart);
+        if (valueEnd == npos) {
+            pos_ = npos;
+            return;
+        }
+        current_ = Member{ object_.substr(pos + 1, keyEnd - pos - 2), JsonCursor(object_.substr(valueStart, valueEnd - valueStart), AlreadyScanned{}) };
+        pos_ = valueEnd;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Member;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Member*;
+    using reference = const Member&;
+
+    constexpr MemberIterator() noexcept = default;
+    constexpr explicit MemberIterator(std::string_view object) noexcept : object_(object), pos_(1) {
+        advance();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return current_; }
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return &current_; }
+
+    constexpr MemberIterator& operator++() noexcept { advance(); return *this; }
+    constexpr MemberIterator operator++(int) noexcept { auto result = *this; advance(); return result; }
+
+    [[nodiscard]]
+    constexpr bool operator==(const MemberIterator& other) const noexcept {
+        return (pos_ == npos && other.pos_ == npos) || (pos_ == other.pos_ && object_.data() == other.object_.data());
+    }
+};
+
+
+/**
+ * Forward iterator over the elements of an array. Elements are scanned as the iterator advances.
+ */
+class JsonCursor::ElementIterator {
+    std::string_view array_;
+    std::size_t pos_{ npos };   ///< Position after the current element, or npos at the end.
+    JsonCursor current_{};
+
+    constexpr void advance() noexcept {
+        auto pos = skipSpace(array_, pos_);
+        if (pos < array_.size() && array_[pos] == ',') {
+            pos = skipSpace(array_, pos + 1);
+        }
+        if (pos >= array_.size() || array_[pos] == ']') {
+            pos_ = npos;
+            return;
+        }
+        const auto end = skipValue(array_, pos);
+        if (end == npos) {
+            pos_ = npos;
+            return;
+        }
+        current_ = JsonCursor(array_.substr(pos, end - pos), AlreadyScanned{});
+        pos_ = end;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = JsonCursor;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const JsonCursor*;
+    using reference = const JsonCursor&;
+
+    constexpr ElementIterator() noexcept = default;
+    constexpr explicit ElementIterator(std::string_view array) noexcept : array_(array), pos_(1) {
+        advance();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return current_; }
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return &current_; }
+
+    constexpr ElementIterator& operator++() noexcept { advance(); return *this; }
+    constexpr ElementIterator operator++(int) noexcept { auto result = *this; advance(); return result; }
+
+    [[nodiscard]]
+    constexpr bool operator==(const ElementIterator& other) const noexcept {
+        return (pos_ == npos && other.pos_ == npos) || (pos_ == other.pos_ && array_.data() == other.array_.data());
+    }
+};
+
+
+constexpr JsonCursor::Range<JsonCursor::MemberIterator> JsonCursor::members() const noexcept {
+    return { isObject() ? MemberIterator(json_) : MemberIterator(), MemberIterator() };
+}
+
+
+constexpr JsonCursor::Range<JsonCursor::ElementIterator> JsonCursor::elements() const noexcept {
+    return { isArray() ? ElementIterator(json_) : ElementIterator(), ElementIterator() };
+}
+
+
+constexpr JsonCursor JsonCursor::operator[](std::string_view key) const noexcept {
+    for (const auto& member : members()) {
+        if (member.keyEquals(key)) {
+            return member.value;
+        }
+    }
+    return {};
+}
+
+
+constexpr JsonCursor JsonCursor::at(std::size_t index) const noexcept {
+    for (const auto& element : elements()) {
+        if (index-- == 0) {
+            return element;
+        }
+    }
+    return {};
+}
+
+
+constexpr std::size_t JsonCursor::size() const noexcept {
+    std::size_t count{ 0 };
+    if (isObject()) {
+        for ([[maybe_unused]] const auto& member : members()) { ++count; }
+    } else if (isArray()) {
+        for ([[maybe_unused]] const auto& element : elements()) { ++count; }
+    }
+    return count;
+}
+
+} // namespace SimConnect
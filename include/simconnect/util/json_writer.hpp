@@ -0,0 +1,242 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace SimConnect {
+
+
+/**
+ * A streaming JSON writer, the counterpart of JsonCursor for building CommBus payloads.
+ *
+ * Values are appended to an internal buffer as they are written, with commas inserted automatically. The buffer
+ * keeps its capacity across clear(), so a writer reused for every message stops allocating once it has seen the
+ * largest one. Pass view() to CommBusHandler::sendEvent() or CommBusChannel::send().
+ *
+ * @note The writer does not check that keys and values alternate correctly inside objects; that is up to the caller.
+ * Nesting deeper than 64 levels is not supported.
+ */
+class JsonWriter {
+    std::string buffer_;
+    std::uint64_t hasValue_{ 0 };   ///< One bit per nesting level: set once the container has its first value.
+    std::size_t depth_{ 0 };
+    bool afterKey_{ false };
+
+
+    void separate() {
+        if (afterKey_) {
+            afterKey_ = false;
+            return;
+        }
+        if ((hasValue_ & 1U) != 0) {
+            buffer_.push_back(',');
+        }
+        hasValue_ |= 1U;
+    }
+
+
+    void open(char c) {
+        separate();
+        buffer_.push_back(c);
+        hasValue_ <<= 1;
+        ++depth_;
+    }
+
+
+    void close(char c) {
+        if (depth_ > 0) {
+            hasValue_ >>= 1;
+            --depth_;
+        }
+        buffer_.push_back(c);
+    }
+
+
+    void appendString(std::string_view s) {
+        static constexpr std::string_view hex{ "0123456789abcdef" };
+
+        buffer_.push_back('"');
+        std::size_t start{ 0 };
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            const auto c = static_cast<unsigned char>(s[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            buffer_.append(s.substr(start, i - start));
+            start = i + 1;
+            switch (c) {
+            case '"':  buffer_.append("\\\""); break;
+            case '\\': buffer_.append("\\\\"); break;
+            case '\b': buffer_.append("\\b");  break;
+            case '\f': buffer_.append("\\f");  break;
+            case '\n': buffer_.append("\\n");  break;
+            case '\r': buffer_.append("\\r");  break;
+            case '\t': buffer_.append("\\t");  break;
+            default:
+                buffer_.append("\\u00");
+                buffer_.push_back(hex[c >> 4]);
+                buffer_.push_back(hex[c & 0x0F]);
+                break;
+            }
+        }
+        buffer_.append(s.substr(start));
+        buffer_.push_back('"');
+    }
+
+
+public:
+    JsonWriter() = default;
+
+    /**
+     * Creates a writer with the given initial buffer capacity.
+     *
+     * @param capacity The number of bytes to reserve.
+     */
+    explicit JsonWriter(std::size_t capacity) {
+        buffer_.reserve(capacity);
+    }
+
+
+    /**
+     * Discards the written text, keeping the buffer's capacity.
+     */
+    JsonWriter& clear() noexcept {
+        buffer_.clear();
+        hasValue_ = 0;
+        depth_ = 0;
+        afterKey_ = false;
+        return *this;
+    }
+
+
+    /**
+     * Returns the text written so far.
+     */
+    [[nodiscard]]
+    std::string_view view() const noexcept { return buffer_; }
+
+
+    /**
+     * Returns the current nesting depth; 0 once all objects and arrays are closed.
+     */
+    [[nodiscard]]
+    std::size_t depth() const noexcept { return depth_; }
+
+
+    JsonWriter& beginObject() { open('{'); return *this; }
+    JsonWriter& endObject() { close('}'); return *this; }
+    JsonWriter& beginArray() { open('['); return *this; }
+    JsonWriter& endArray() { close(']'); return *this; }
+
+
+    /**
+     * Writes an object key. The next value written becomes its value.
+     *
+     * @param name The key.
+     */
+    JsonWriter& key(std::string_view name) {
+        separate();
+        appendString(name);
+        buffer_.push_back(':');
+        afterKey_ = true;
+        return *this;
+    }
+
+
+    /**
+     * Writes a string value, escaping it as needed.
+     */
+    JsonWriter& value(std::string_view s) {
+        separate();
+        appendString(s);
+        return *this;
+    }
+
+    JsonWriter& value(const char* s) {
+        return value(std::string_view{ s });
+    }
+
+
+    /**
+     * Writes a boolean value.
+     */
+    JsonWriter& value(bool b) {
+        separate();
+        buffer_.append(b ? "true" : "false");
+        return *this;
+    }
+
+
+    /**
+     * Writes null.
+     */
+    JsonWriter& value(std::nullptr_t) {
+        separate();
+        buffer_.append("null");
+        return *this;
+    }
+
+
+    /**
+     * Writes a number, using the shortest representation that reads back to the same value. Infinities and NaN
+     * have no JSON representation and are written as null.
+     */
+    template <class T>
+        requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+    JsonWriter& value(T number) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (!std::isfinite(number)) {
+                return value(nullptr);
+            }
+        }
+        separate();
+        std::array<char, 32> buf{};
+        const auto result = std::to_chars(buf.data(), buf.data() + buf.size(), number);
+        buffer_.append(buf.data(), result.ptr);
+        return *this;
+    }
+
+
+    /**
+     * Writes a key and its value.
+     */
+    template <class T>
+    JsonWriter& member(std::string_view name, T&& v) {
+        return key(name).value(std::forward<T>(v));
+    }
+
+
+    /**
+     * Writes text that is already valid JSON, such as a value taken from a JsonCursor with raw().
+     */
+    JsonWriter& rawValue(std::string_view json) {
+        separate();
+        buffer_.append(json);
+        return *this;
+    }
+};
+
+} // namespace SimConnect
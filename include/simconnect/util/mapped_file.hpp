@@ -0,0 +1,170 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace SimConnect {
+
+
+/**
+ * A read-only memory mapping of a whole file.
+ *
+ * The mapping stays valid until close() is called or the object is destroyed, so spans handed out by bytes() must not
+ * outlive it. An empty file cannot be mapped and is treated as a failure to open.
+ */
+class MappedFile {
+    const std::byte* data_{ nullptr };
+    std::size_t size_{ 0 };
+
+#if defined(_WIN32)
+    HANDLE file_{ INVALID_HANDLE_VALUE };
+    HANDLE mapping_{ nullptr };
+#else
+    int fd_{ -1 };
+#endif
+
+
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path) { open(path); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#if defined(_WIN32)
+            file_ = std::exchange(other.file_, INVALID_HANDLE_VALUE);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#else
+            fd_ = std::exchange(other.fd_, -1);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile() { close(); }
+
+
+    /**
+     * Maps a file, closing any previous mapping first.
+     *
+     * @param path The file to map.
+     * @returns true if the file was mapped.
+     */
+    bool open(const std::filesystem::path& path) {
+        close();
+
+#if defined(_WIN32)
+        file_ = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file_, &size) || (size.QuadPart == 0)) {
+            close();
+            return false;
+        }
+        mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) {
+            close();
+            return false;
+        }
+        data_ = static_cast<const std::byte*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat info {};
+        if ((::fstat(fd_, &info) != 0) || (info.st_size == 0)) {
+            close();
+            return false;
+        }
+        void* address = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd_, 0);
+        if (address != MAP_FAILED) {
+            data_ = static_cast<const std::byte*>(address);
+            size_ = static_cast<std::size_t>(info.st_size);
+        }
+#endif
+        if (data_ == nullptr) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+
+    /**
+     * Unmaps the file.
+     */
+    void close() noexcept {
+#if defined(_WIN32)
+        if (data_ != nullptr) {
+            ::UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+
+    [[nodiscard]]
+    bool isOpen() const noexcept { return data_ != nullptr; }
+
+    [[nodiscard]]
+    std::span<const std::byte> bytes() const noexcept { return { data_, size_ }; }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return size_; }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,248 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <simconnect/simconnect_exception.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Formats a label in exposition syntax, escaping backslashes, double quotes, and newlines in the value as the
+ * Prometheus text format requires.
+ *
+ * @param name The label name, which must already be a valid identifier.
+ * @param value The label value, which may contain any characters.
+ * @returns The label, such as `handler="Data \"A\""`.
+ */
+[[nodiscard]]
+inline std::string metricLabel(std::string_view name, std::string_view value) {
+    std::string label;
+    label.reserve(name.size() + value.size() + 3);
+    label += name;
+    label += "=\"";
+    for (const char c : value) {
+        switch (c) {
+        case '\\': label += "\\\\"; break;
+        case '"': label += "\\\""; break;
+        case '\n': label += "\\n"; break;
+        default: label += c; break;
+        }
+    }
+    label += '"';
+    return label;
+}
+
+
+/**
+ * A monotonically increasing count.
+ */
+class MetricCounter {
+    std::atomic<std::uint64_t> value_{ 0 };
+
+public:
+    void inc(std::uint64_t amount = 1) noexcept { value_.fetch_add(amount, std::memory_order_relaxed); }
+
+    [[nodiscard]]
+    std::uint64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+};
+
+
+/**
+ * A value that can go up and down.
+ */
+class MetricGauge {
+    std::atomic<std::int64_t> value_{ 0 };
+
+public:
+    void set(std::int64_t value) noexcept { value_.store(value, std::memory_order_relaxed); }
+    void add(std::int64_t amount) noexcept { value_.fetch_add(amount, std::memory_order_relaxed); }
+
+    [[nodiscard]]
+    std::int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+};
+
+
+/**
+ * A distribution of observed values over fixed buckets. Each bucket counts the observations up to and including its
+ * upper bound, but not those of the buckets before it; the exposition formats make them cumulative.
+ */
+class MetricHistogram {
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;    ///< One per bound, plus one for everything above.
+    std::atomic<std::uint64_t> count_{ 0 };
+    std::atomic<double> sum_{ 0.0 };
+
+public:
+    /**
+     * Creates a histogram.
+     *
+     * @param bounds The upper bounds of the buckets, in ascending order.
+     */
+    explicit MetricHistogram(std::vector<double> bounds)
+        : bounds_(std::move(bounds)), buckets_(std::make_unique<std::atomic<std::uint64_t>[]>(bounds_.size() + 1))
+    {
+    }
+
+    void observe(double value) noexcept {
+        const auto bucket = static_cast<std::size_t>(std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin());
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    const std::vector<double>& bounds() const noexcept { return bounds_; }
+
+    /**
+     * Returns the number of observations in a single bucket. Index bounds().size() is the bucket above the last bound.
+     */
+    [[nodiscard]]
+    std::uint64_t bucket(std::size_t index) const noexcept { return buckets_[index].load(std::memory_order_relaxed); }
+
+    [[nodiscard]]
+    std::uint64_t count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]]
+    double sum() const noexcept { return sum_.load(std::memory_order_relaxed); }
+};
+
+
+enum class MetricType {
+    counter,
+    gauge,
+    histogram,
+};
+
+
+/**
+ * A set of named metrics. Metrics sharing a name form a family that differs only in its labels.
+ *
+ * Looking up or creating a metric takes a lock, so do it once and keep the reference; the returned metrics stay valid
+ * for the registry's lifetime and are updated lock-free.
+ */
+class MetricsRegistry {
+public:
+    using metric_type = std::variant<std::unique_ptr<MetricCounter>, std::unique_ptr<MetricGauge>, std::unique_ptr<MetricHistogram>>;
+
+    /**
+     * A single metric within a family.
+     */
+    struct Series {
+        std::string labels;                 ///< The labels in exposition syntax, such as `type="8"`, or empty. See metricLabel().
+        metric_type metric;
+    };
+
+    /**
+     * All metrics sharing a name.
+     */
+    struct Family {
+        std::string name;
+        std::string help;
+        MetricType type;
+        std::deque<Series> series;
+    };
+
+
+private:
+    mutable std::mutex mutex_;
+    std::deque<Family> families_;
+
+
+    template <class T, class... Args>
+    T& findOrAdd(MetricType type, std::string_view name, std::string_view help, std::string_view labels, Args&&... args) {
+        std::lock_guard lock(mutex_);
+
+        auto family = std::find_if(families_.begin(), families_.end(), [name](const Family& f) { return f.name == name; });
+        if (family == families_.end()) {
+            family = families_.insert(families_.end(), Family{ std::string(name), std::string(help), type, {} });
+        } else if (family->type != type) {
+            throw SimConnectException(std::string("Metric '") + std::string(name) + "' was already registered with another type.");
+        }
+        for (auto& series : family->series) {
+            if (series.labels == labels) {
+                return *std::get<std::unique_ptr<T>>(series.metric);
+            }
+        }
+        auto metric = std::make_unique<T>(std::forward<Args>(args)...);
+        auto& result = *metric;
+        family->series.push_back(Series{ std::string(labels), std::move(metric) });
+        return result;
+    }
+
+
+public:
+    MetricsRegistry() = default;
+
+    // No copies or moves
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry(MetricsRegistry&&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(MetricsRegistry&&) = delete;
+    ~MetricsRegistry() = default;
+
+
+    /**
+     * Returns the counter with the given name and labels, creating it if needed.
+     *
+     * @param name The metric name, such as `simconnect_messages_received_total`.
+     * @param help A one-line description, used when the family is created.
+     * @param labels The labels in exposition syntax, such as `type="8"`. Use metricLabel() for values that may need escaping.
+     * @throws SimConnectException if the name is already used for a different type of metric.
+     */
+    MetricCounter& counter(std::string_view name, std::string_view help, std::string_view labels = {}) {
+        return findOrAdd<MetricCounter>(MetricType::counter, name, help, labels);
+    }
+
+    MetricGauge& gauge(std::string_view name, std::string_view help, std::string_view labels = {}) {
+        return findOrAdd<MetricGauge>(MetricType::gauge, name, help, labels);
+    }
+
+    /**
+     * Returns the histogram with the given name and labels, creating it with the given bucket bounds if needed.
+     */
+    MetricHistogram& histogram(std::string_view name, std::string_view help, std::vector<double> bounds, std::string_view labels = {}) {
+        return findOrAdd<MetricHistogram>(MetricType::histogram, name, help, labels, std::move(bounds));
+    }
+
+
+    /**
+     * Calls a function for every family, in the order they were created, while holding the registry's lock.
+     */
+    template <class F>
+    void forEach(F&& visitor) const {
+        std::lock_guard lock(mutex_);
+        for (const auto& family : families_) {
+            visitor(family);
+        }
+    }
+};
+
+} // namespace SimConnect
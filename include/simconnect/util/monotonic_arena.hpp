@@ -0,0 +1,138 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace SimConnect {
+
+
+/**
+ * A bump allocator that hands out memory from a list of chunks and frees it all at once.
+ *
+ * Allocations never move, so pointers into the arena stay valid until reset() or destruction. Chunks double in size as
+ * the arena grows. reset() keeps the largest chunk, so an arena reused for similar work stops allocating after the
+ * first round. Nothing allocated here is ever destroyed, so only trivially destructible objects belong in it.
+ */
+class MonotonicArena {
+    struct Chunk {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t size;
+    };
+
+    std::vector<Chunk> chunks_;
+    std::size_t initialSize_;
+    std::size_t offset_{ 0 };       ///< Used bytes in the last chunk.
+    std::size_t used_{ 0 };
+
+
+    void grow(std::size_t minimum) {
+        const std::size_t last = chunks_.empty() ? (initialSize_ / 2) : chunks_.back().size;
+        const std::size_t size = std::max(minimum, last * 2);
+        chunks_.push_back(Chunk{ std::make_unique<std::byte[]>(size), size });
+        offset_ = 0;
+    }
+
+
+public:
+    static constexpr std::size_t defaultInitialSize{ 16 * 1024 };
+
+    explicit MonotonicArena(std::size_t initialSize = defaultInitialSize) : initialSize_(std::max<std::size_t>(initialSize, 64)) {}
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+    MonotonicArena(MonotonicArena&&) = default;
+    MonotonicArena& operator=(MonotonicArena&&) = default;
+    ~MonotonicArena() = default;
+
+
+    /**
+     * Allocates uninitialized memory.
+     *
+     * @param size The number of bytes.
+     * @param alignment The alignment, which must be a power of two no larger than alignof(std::max_align_t).
+     * @returns The memory.
+     */
+    [[nodiscard]]
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+        if (!chunks_.empty()) {
+            const std::size_t start = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (start + size <= chunks_.back().size) {
+                offset_ = start + size;
+                used_ += size;
+                return chunks_.back().memory.get() + start;
+            }
+        }
+        grow(size);
+        offset_ = size;
+        used_ += size;
+        return chunks_.back().memory.get();
+    }
+
+
+    /**
+     * Constructs an object in the arena.
+     */
+    template <class T, class... Args>
+    [[nodiscard]]
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Objects in a MonotonicArena are never destroyed.");
+        return ::new (allocate(sizeof(T), alignof(T))) T{ std::forward<Args>(args)... };
+    }
+
+
+    /**
+     * Releases everything allocated so far, keeping the largest chunk for reuse.
+     */
+    void reset() noexcept {
+        if (chunks_.size() > 1) {
+            auto largest = std::max_element(chunks_.begin(), chunks_.end(), [](const Chunk& lhs, const Chunk& rhs) { return lhs.size < rhs.size; });
+            Chunk keep{ std::move(largest->memory), largest->size };
+            chunks_.clear();
+            chunks_.push_back(std::move(keep));
+        }
+        offset_ = 0;
+        used_ = 0;
+    }
+
+
+    /**
+     * Returns the number of bytes handed out since the last reset, not counting alignment padding.
+     */
+    [[nodiscard]]
+    std::size_t used() const noexcept { return used_; }
+
+    /**
+     * Returns the number of bytes held in chunks.
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        std::size_t total{ 0 };
+        for (const auto& chunk : chunks_) {
+            total += chunk.size;
+        }
+        return total;
+    }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,86 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <optional>
+
+#include <simconnect/util/sequenced_ring.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A bounded, lock-free queue for many producers and many consumers.
+ *
+ * This shares the MpscQueue's SequencedRing, with the head claimed through compare-and-swap as well, so any thread may
+ * pop. Because a producer may also pop, it can make room in a full queue by discarding the oldest element. The
+ * capacity is rounded up to a power of two.
+ *
+ * @tparam T The element type, which must be default constructible and move assignable.
+ */
+template <class T>
+class MpmcQueue : public SequencedRing<T> {
+    using SequencedRing<T>::cells_;
+    using SequencedRing<T>::mask_;
+    using SequencedRing<T>::head_;
+
+public:
+    static constexpr bool multiProducer{ true };
+    static constexpr bool multiConsumer{ true };
+
+
+    /**
+     * Creates a queue.
+     *
+     * @param capacity The minimum number of elements the queue can hold.
+     */
+    explicit MpmcQueue(std::size_t capacity) : SequencedRing<T>(capacity) {}
+
+    // No copies or moves
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue(MpmcQueue&&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(MpmcQueue&&) = delete;
+    ~MpmcQueue() = default;
+
+
+    /**
+     * Removes the oldest element. Safe to call from any number of threads.
+     *
+     * @returns The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<T> tryPop() {
+        auto pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = cells_[pos & mask_];
+            const auto seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return this->take(cell, pos);
+                }
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+} // namespace SimConnect
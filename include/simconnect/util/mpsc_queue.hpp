@@ -0,0 +1,78 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <optional>
+
+#include <simconnect/util/sequenced_ring.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * A bounded, lock-free queue for many producers and a single consumer.
+ *
+ * Each cell carries a sequence number that tells producers and the consumer whether it is free or filled, so
+ * producers only contend on a single atomic increment and never block. The capacity is rounded up to a power of two.
+ *
+ * @tparam T The element type, which must be default constructible and move assignable.
+ */
+template <class T>
+class MpscQueue : public SequencedRing<T> {
+    using SequencedRing<T>::cells_;
+    using SequencedRing<T>::mask_;
+    using SequencedRing<T>::head_;
+
+public:
+    static constexpr bool multiProducer{ true };
+    static constexpr bool multiConsumer{ false };
+
+
+    /**
+     * Creates a queue.
+     *
+     * @param capacity The minimum number of elements the queue can hold.
+     */
+    explicit MpscQueue(std::size_t capacity) : SequencedRing<T>(capacity) {}
+
+    // No copies or moves
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+    ~MpscQueue() = default;
+
+
+    /**
+     * Removes the oldest element. Must only be called from the consumer thread.
+     *
+     * @returns The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<T> tryPop() {
+        const auto head = head_.load(std::memory_order_relaxed);
+        auto& cell = cells_[head & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1) {
+            return std::nullopt;
+        }
+        std::optional<T> value{ this->take(cell, head) };
+        head_.store(head + 1, std::memory_order_relaxed);
+        return value;
+    }
+};
+
+} // namespace SimConnect
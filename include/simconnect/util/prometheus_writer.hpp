@@ -0,0 +1,189 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <simconnect/util/metrics.hpp>
+
+
+namespace SimConnect {
+
+
+/**
+ * Renders a MetricsRegistry in the Prometheus text exposition format (version 0.0.4).
+ *
+ * The output can be written to a stream (including std::cout), handed to a callback, or written to a file for a
+ * node_exporter textfile collector. Call it on whatever schedule the scraper needs; rendering only reads the atomics.
+ */
+class PrometheusWriter {
+
+    static void appendValue(std::string& out, double value) {
+        if (std::isinf(value)) {
+            out += (value > 0) ? "+Inf" : "-Inf";
+        } else if (std::isnan(value)) {
+            out += "NaN";
+        } else {
+            std::format_to(std::back_inserter(out), "{}", value);
+        }
+    }
+
+
+    static void appendHelp(std::string& out, std::string_view help) {
+        for (const char c : help) {
+            switch (c) {
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            default: out += c; break;
+            }
+        }
+    }
+
+
+    static void appendSample(std::string& out, std::string_view name, std::string_view suffix, std::string_view labels,
+                             std::string_view extraLabel = {})
+    {
+        out += name;
+        out += suffix;
+        if (!labels.empty() || !extraLabel.empty()) {
+            out += '{';
+            out += labels;
+            if (!labels.empty() && !extraLabel.empty()) {
+                out += ',';
+            }
+            out += extraLabel;
+            out += '}';
+        }
+        out += ' ';
+    }
+
+
+    static void appendHistogram(std::string& out, const std::string& name, const std::string& labels, const MetricHistogram& histogram) {
+        std::uint64_t cumulative{ 0 };
+        const auto& bounds = histogram.bounds();
+        for (std::size_t i = 0; i <= bounds.size(); ++i) {
+            cumulative += histogram.bucket(i);
+            std::string le{ "le=\"" };
+            appendValue(le, (i < bounds.size()) ? bounds[i] : std::numeric_limits<double>::infinity());
+            le += '"';
+            appendSample(out, name, "_bucket", labels, le);
+            std::format_to(std::back_inserter(out), "{}\n", cumulative);
+        }
+        appendSample(out, name, "_sum", labels);
+        appendValue(out, histogram.sum());
+        out += '\n';
+        appendSample(out, name, "_count", labels);
+        std::format_to(std::back_inserter(out), "{}\n", histogram.count());
+    }
+
+
+public:
+    /**
+     * Renders the registry.
+     *
+     * @param registry The metrics to render.
+     * @returns The exposition text.
+     */
+    [[nodiscard]]
+    static std::string render(const MetricsRegistry& registry) {
+        std::string out;
+        out.reserve(4096);
+
+        registry.forEach([&out](const MetricsRegistry::Family& family) {
+            std::format_to(std::back_inserter(out), "# HELP {} ", family.name);
+            appendHelp(out, family.help);
+            out += '\n';
+            std::format_to(std::back_inserter(out), "# TYPE {} {}\n", family.name,
+                           (family.type == MetricType::counter) ? "counter" : (family.type == MetricType::gauge) ? "gauge" : "histogram");
+
+            for (const auto& series : family.series) {
+                switch (family.type) {
+                case MetricType::counter:
+                    appendSample(out, family.name, "", series.labels);
+                    std::format_to(std::back_inserter(out), "{}\n", std::get<std::unique_ptr<MetricCounter>>(series.metric)->value());
+                    break;
+                case MetricType::gauge:
+                    appendSample(out, family.name, "", series.labels);
+                    std::format_to(std::back_inserter(out), "{}\n", std::get<std::unique_ptr<MetricGauge>>(series.metric)->value());
+                    break;
+                case MetricType::histogram:
+                    appendHistogram(out, family.name, series.labels, *std::get<std::unique_ptr<MetricHistogram>>(series.metric));
+                    break;
+                }
+            }
+        });
+        return out;
+    }
+
+
+    /**
+     * Writes the registry to a stream.
+     */
+    static void write(const MetricsRegistry& registry, std::ostream& out) {
+        out << render(registry);
+        out.flush();
+    }
+
+
+    /**
+     * Hands the rendered registry to a callback, for example to serve it over HTTP.
+     */
+    static void write(const MetricsRegistry& registry, const std::function<void(std::string_view)>& sink) {
+        const auto text = render(registry);
+        sink(text);
+    }
+
+
+    /**
+     * Writes the registry to a file. The text is written to a temporary file next to it first and then renamed, so a
+     * scraper never sees a partial file.
+     *
+     * @param registry The metrics to render.
+     * @param path The file to (over)write.
+     * @returns true if the file was written.
+     */
+    static bool writeFile(const MetricsRegistry& registry, const std::filesystem::path& path) {
+        auto temp = path;
+        temp += ".tmp";
+        {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            out << render(registry);
+            if (!out) {
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temp, path, error);
+        return !error;
+    }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,61 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utility>
+
+
+namespace SimConnect {
+
+
+/**
+ * Runs a function when it goes out of scope, also when the scope is left by an exception. Used to reset "busy"
+ * flags and give back reserved resources on every path out of a function.
+ *
+ * @code
+ * busy_ = true;
+ * ScopeExit done([this]() { busy_ = false; });
+ * @endcode
+ *
+ * @tparam F The type of the function, which must not throw.
+ */
+template <class F>
+class ScopeExit {
+    F onExit_;
+    bool active_{ true };
+
+public:
+    explicit ScopeExit(F onExit) noexcept : onExit_(std::move(onExit)) {}
+
+    ScopeExit(const ScopeExit&) = delete;
+    ScopeExit(ScopeExit&&) = delete;
+    ScopeExit& operator=(const ScopeExit&) = delete;
+    ScopeExit& operator=(ScopeExit&&) = delete;
+
+    ~ScopeExit() {
+        if (active_) {
+            onExit_();
+        }
+    }
+
+
+    /**
+     * Cancels the function, for when the normal path has taken care of it.
+     */
+    void release() noexcept { active_ = false; }
+};
+
+} // namespace SimConnect
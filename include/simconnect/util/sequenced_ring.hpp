@@ -0,0 +1,137 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+
+namespace SimConnect {
+
+
+/**
+ * The storage and producer side shared by MpscQueue and MpmcQueue: a bounded ring of cells that each carry a sequence
+ * number telling producers and consumers whether the cell is free or filled. Producers claim a position with a single
+ * compare-and-swap on the tail and never block. The queues add their own consumer side on top.
+ *
+ * @tparam T The element type, which must be default constructible and move assignable.
+ */
+template <class T>
+class SequencedRing {
+protected:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static constexpr std::size_t cacheLine{ 64 };
+
+    std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(cacheLine) std::atomic<std::size_t> tail_{ 0 };    ///< Next position to write, shared by producers.
+    alignas(cacheLine) std::atomic<std::size_t> head_{ 0 };    ///< Next position to read, owned by the consumer side.
+
+
+    /**
+     * Creates the ring.
+     *
+     * @param capacity The minimum number of elements the ring can hold, rounded up to a power of two.
+     */
+    explicit SequencedRing(std::size_t capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? std::size_t{ 2 } : capacity) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1))
+    {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~SequencedRing() = default;
+
+
+    /**
+     * Takes the element out of a cell a consumer has claimed at position pos, and frees the cell for the producer
+     * one lap later.
+     */
+    T take(Cell& cell, std::size_t pos) {
+        T value{ std::move(cell.value) };
+        cell.value = T{};
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+
+public:
+    // No copies or moves
+    SequencedRing(const SequencedRing&) = delete;
+    SequencedRing(SequencedRing&&) = delete;
+    SequencedRing& operator=(const SequencedRing&) = delete;
+    SequencedRing& operator=(SequencedRing&&) = delete;
+
+
+    /**
+     * Returns the number of elements the queue can hold.
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+
+    /**
+     * Adds an element. Safe to call from any number of threads.
+     *
+     * @param value The element to add.
+     * @returns false if the queue is full, in which case value is left untouched.
+     */
+    bool tryPush(T& value) {
+        auto pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = cells_[pos & mask_];
+            const auto seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPush(T&& value) {
+        return tryPush(value);
+    }
+
+
+    /**
+     * Returns an estimate of the number of elements in the queue.
+     */
+    [[nodiscard]]
+    std::size_t sizeApprox() const noexcept {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+};
+
+} // namespace SimConnect
@@ -0,0 +1,137 @@
+#pragma once
+/*
+ * Copyright (c) 2026. Bert Laverman
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+
+namespace SimConnect {
+
+
+/**
+ * A bounded, lock-free queue for a single producer and a single consumer.
+ *
+ * The producer only writes the tail and the consumer only writes the head, so neither side ever retries. Each side
+ * keeps a cached copy of the other's index and only reloads it when the queue looks full or empty, which keeps the
+ * shared cache lines quiet. The capacity is rounded up to a power of two.
+ *
+ * @tparam T The element type, which must be default constructible and move assignable.
+ */
+template <class T>
+class SpscQueue {
+    static constexpr std::size_t cacheLine{ 64 };
+
+    std::size_t mask_;
+    std::unique_ptr<T[]> cells_;
+    alignas(cacheLine) std::atomic<std::size_t> tail_{ 0 };    ///< Next position to write, only written by the producer.
+    std::size_t cachedHead_{ 0 };                               ///< The producer's last view of head_.
+    alignas(cacheLine) std::atomic<std::size_t> head_{ 0 };    ///< Next position to read, only written by the consumer.
+    std::size_t cachedTail_{ 0 };                               ///< The consumer's last view of tail_.
+
+
+public:
+    static constexpr bool multiProducer{ false };
+    static constexpr bool multiConsumer{ false };
+
+
+    /**
+     * Creates a queue.
+     *
+     * @param capacity The minimum number of elements the queue can hold.
+     */
+    explicit SpscQueue(std::size_t capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? std::size_t{ 2 } : capacity) - 1),
+          cells_(std::make_unique<T[]>(mask_ + 1))
+    {
+    }
+
+    // No copies or moves
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+    ~SpscQueue() = default;
+
+
+    /**
+     * Returns the number of elements the queue can hold.
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+
+    /**
+     * Adds an element. Must only be called from the producer thread.
+     *
+     * @param value The element to add.
+     * @returns false if the queue is full, in which case value is left untouched.
+     */
+    bool tryPush(T& value) {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ > mask_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ > mask_) {
+                return false;
+            }
+        }
+        cells_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(T&& value) {
+        return tryPush(value);
+    }
+
+
+    /**
+     * Removes the oldest element. Must only be called from the consumer thread.
+     *
+     * @returns The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<T> tryPop() {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return std::nullopt;
+            }
+        }
+        auto& cell = cells_[head & mask_];
+        std::optional<T> value{ std::move(cell) };
+        cell = T{};
+        head_.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+
+    /**
+     * Returns an estimate of the number of elements in the queue.
+     */
+    [[nodiscard]]
+    std::size_t sizeApprox() const noexcept {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+};
+
+} // namespace SimConnect
@@ -34,8 +34,8 @@ namespace SimConnect {
 /**
  * A SimConnect connection with support for notifications through a Windows Event.
  */
-template <bool ThreadSafe = false, class L = NullLogger, bool TrackMappedEvents = true>
-class WindowsEventConnection : public Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents>, ThreadSafe, L, TrackMappedEvents> {
+template <bool ThreadSafe = false, class L = NullLogger, bool TrackMappedEvents = true, bool Metrics = false>
+class WindowsEventConnection : public Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents, Metrics>, ThreadSafe, L, TrackMappedEvents, Metrics> {
 public:
 	using logger_type = L;
 
@@ -50,21 +50,21 @@ public:
 	/**
 	 * Constructor, using the default client name.
 	 */
-    WindowsEventConnection() : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents>, ThreadSafe, L, TrackMappedEvents>(), eventHandle_() {}
+    WindowsEventConnection() : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents, Metrics>, ThreadSafe, L, TrackMappedEvents, Metrics>(), eventHandle_() {}
 
 
 	/**
 	 * Constructor.
 	 * @param name The name of the connection.
 	 */
-    WindowsEventConnection(std::string_view name) : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents>, ThreadSafe, L, TrackMappedEvents>(name), eventHandle_() {}
+    WindowsEventConnection(std::string_view name) : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents, Metrics>, ThreadSafe, L, TrackMappedEvents, Metrics>(name), eventHandle_() {}
 
 
 	/**
 	 * Constructor, using the default client name.
 	 * @param eventHandle The event handle to use for signalling that SIMCONNECT messages are available.
 	 */
-    WindowsEventConnection(HANDLE eventHandle) : Connection<WindowsEventConnection<ThreadSafe, L>, ThreadSafe, L>(), eventHandle_(eventHandle) {}
+    WindowsEventConnection(HANDLE eventHandle) : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents, Metrics>, ThreadSafe, L, TrackMappedEvents, Metrics>(), eventHandle_(eventHandle) {}
 
 
 	/**
@@ -72,7 +72,7 @@ public:
 	 * @param name The name of the connection.
 	 * @param eventHandle The event handle to use for signalling that SIMCONNECT messages are available.
 	 */
-    WindowsEventConnection(std::string_view name, HANDLE eventHandle) : Connection<WindowsEventConnection<ThreadSafe, L>, ThreadSafe, L>(name), eventHandle_(eventHandle) {}
+    WindowsEventConnection(std::string_view name, HANDLE eventHandle) : Connection<WindowsEventConnection<ThreadSafe, L, TrackMappedEvents, Metrics>, ThreadSafe, L, TrackMappedEvents, Metrics>(name), eventHandle_(eventHandle) {}
 
     ~WindowsEventConnection() {
         if (eventHandle_ != nullptr) {
@@ -131,6 +131,27 @@ public:
 	bool waitForMessage(std::chrono::milliseconds duration = std::chrono::milliseconds(0)) {
 		return ::WaitForSingleObject(eventHandle_, (duration <= std::chrono::milliseconds(0)) ? INFINITE : static_cast<unsigned long>(duration.count())) == WAIT_OBJECT_0;
 	}
+
+
+    /**
+     * Returns the handle SimConnect signals when messages arrive, so an existing event loop can wait on it, for example
+     * with `WaitForMultipleObjects()` or `asio::windows::object_handle`. It is an auto-reset event, so a wait consumes
+     * the signal. Use the message handler's `drain()` to dispatch a bounded number of messages per wakeup.
+     *
+     * @returns The event handle, or `nullptr` if the connection was never opened.
+     */
+    [[nodiscard]]
+    HANDLE readinessHandle() const noexcept { return eventHandle_; }
+
+
+    /**
+     * Signals the readiness handle again, so the event loop wakes up for messages a bounded drain left behind.
+     */
+    void signalReady() noexcept {
+        if (eventHandle_ != nullptr) {
+            ::SetEvent(eventHandle_);
+        }
+    }
 };
 
 } // namespace SimConnect
\ No newline at end of file
@@ -28,13 +28,15 @@ namespace SimConnect {
 
 /**
  * A SimConnect message handler.
+ *
+ * @tparam Metrics Whether the connection keeps metrics, see Connection.
  */
-template <bool ThreadSafe = false, class L = NullLogger, class M = MultiHandlerPolicy<Messages::MsgBase>>
-class WindowsEventHandler : public SimConnectMessageHandler<WindowsEventConnection<ThreadSafe, L>, WindowsEventHandler<ThreadSafe, L, M>, M>
+template <bool ThreadSafe = false, class L = NullLogger, class M = MultiHandlerPolicy<Messages::MsgBase>, bool Metrics = false>
+class WindowsEventHandler : public SimConnectMessageHandler<WindowsEventConnection<ThreadSafe, L, true, Metrics>, WindowsEventHandler<ThreadSafe, L, M, Metrics>, M>
 {
 
 public:
-    using connection_type = WindowsEventConnection<ThreadSafe, L>;
+    using connection_type = WindowsEventConnection<ThreadSafe, L, true, Metrics>;
     using handler_id_type = typename M::handler_id_type;
 	using handler_proc_type = typename M::handler_proc_type;
 	using logger_type = L;
@@ -47,7 +49,7 @@ private:
 
 public:
     WindowsEventHandler(connection_type& connection, LogLevel logLevel = LogLevel::Info)
-        : SimConnectMessageHandler<WindowsEventConnection<ThreadSafe, L>, WindowsEventHandler<ThreadSafe, L, M>, M>(connection, "WindowsEventHandler", logLevel)
+        : SimConnectMessageHandler<WindowsEventConnection<ThreadSafe, L, true, Metrics>, WindowsEventHandler<ThreadSafe, L, M, Metrics>, M>(connection, "WindowsEventHandler", logLevel)
     {
     }
 
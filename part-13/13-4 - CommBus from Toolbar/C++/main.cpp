@@ -24,7 +24,6 @@
 
 #include <exception>
 #include <iostream>
-#include <regex>
 #include <string>
 #include <string_view>
 #include <format>
@@ -36,6 +35,7 @@
 #include <simconnect/comm_bus_handler.hpp>
 
 #include <simconnect/util/console_logger.hpp>
+#include <simconnect/util/json_cursor.hpp>
 
 
 using namespace SimConnect;
@@ -253,26 +253,26 @@ static void handleException(const Messages::ExceptionMsg &msg)
  * Expected shape: {"message": string, "flag": bool}. Malformed or unexpected payloads are
  * reported and otherwise ignored - this is a demo listener, not a validating one.
  *
- * @note Minimal and non-validating, written for this demo's fixed, flat payload shape only -
- * assumes "message" precedes "flag" and neither field contains escaped quotes or nested
- * structures. A general-purpose JSON parser isn't warranted for a two-field demo payload;
- * the MSFS SDK's bundled RapidJSON was tried first but doesn't compile under this project's
- * strict warnings-as-errors C++20 settings (a real const-member assignment in its own
- * headers, not just a suppressible warning).
+ * @note The payload is read in place with a JsonCursor, which walks the string_view without building a
+ * document or allocating. The MSFS SDK's bundled RapidJSON was tried first but doesn't compile under this
+ * project's strict warnings-as-errors C++20 settings (a real const-member assignment in its own headers,
+ * not just a suppressible warning).
  *
  * @param payload The reassembled CommBus payload (see CommBusHandler::subscribeToEvent).
  */
 static void handleHelloJson(std::string_view payload)
 {
-  static const std::regex pattern{ R"re("message"\s*:\s*"([^"]*)"\s*,\s*"flag"\s*:\s*(true|false))re" };
+  const JsonCursor json(payload);
+  const auto message = json["message"];
+  const auto flag = json["flag"].asBool();
 
-  std::match_results<std::string_view::const_iterator> match;
-  if (!std::regex_search(payload.cbegin(), payload.cend(), match, pattern)) {
+  std::string text;
+  if (!message.appendTo(text) || !flag.has_value()) {
     std::cerr << std::format("[Failed to parse JSON payload: '{}']\n", payload);
     return;
   }
 
-  std::cout << std::format("Received: message='{}', flag={}\n", match[1].str(), match[2].str() == "true"); // NOLINT(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+  std::cout << std::format("Received: message='{}', flag={}\n", text, *flag);
 }
 
 
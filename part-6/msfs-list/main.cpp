@@ -66,6 +66,7 @@ static HANDLE hSimConnect{ nullptr };		// The connection handle
 static bool connected{ false };				// Do we have a live connection?
 
 static std::map<std::string, std::string> args;
+static std::map<DWORD, std::string> sentCalls;	// SendID to a description of the call, to explain exceptions.
 
 
 enum RequestIds : DWORD {
@@ -89,7 +90,11 @@ static void handleException(const SIMCONNECT_RECV_EXCEPTION& msg)
     std::cout << std::format("Received an exception type {}:\n", msg.dwException);
     if (msg.dwSendID != SIMCONNECT_RECV_EXCEPTION::UNKNOWN_SENDID)
     {
-        std::cout << std::format("- Related to a message with SendID {}.\n", msg.dwSendID);
+        if (auto it = sentCalls.find(msg.dwSendID); it != sentCalls.end()) {
+            std::cout << std::format("- Caused by {} (SendID {}).\n", it->second, msg.dwSendID);
+        } else {
+            std::cout << std::format("- Related to a message with SendID {}.\n", msg.dwSendID);
+        }
     }
     if (msg.dwIndex != SIMCONNECT_RECV_EXCEPTION::UNKNOWN_INDEX)
     {
@@ -648,6 +653,7 @@ static void addToFacilityDef(DWORD defId, const char* name) {
         lastSendID = 0;
 	}
 	std::cerr << std::format("Added '{}' to facility definition {} with SendID {}.\n", name, defId, lastSendID);
+    sentCalls[lastSendID] = std::format("SimConnect_AddToFacilityDefinition({}, '{}')", defId, name);
 }
 
 
@@ -89,14 +89,19 @@ static void handleClose([[maybe_unused]] const Messages::QuitMsg& msg) {
  * Handle SimConnect Exception messages.
  *
  * @param msg The exception message to handle.
+ * @param history The connection's history of sent calls, to find the call that caused the exception.
  */
-static void handleException(const Messages::ExceptionMsg& msg)
+static void handleException(const Messages::ExceptionMsg& msg, const SendHistory& history)
 {
 
     std::cerr << std::format("Received an exception type {}:\n", msg.dwException);
     if (msg.dwSendID != unknownSendId)
     {
-        std::cerr << std::format("- Related to a message with SendID {}.\n", msg.dwSendID);
+        if (auto call = history.find(msg)) {
+            std::cerr << std::format("- Caused by {}.\n", call->describe());
+        } else {
+            std::cerr << std::format("- Related to a message with SendID {}.\n", msg.dwSendID);
+        }
     }
     if (msg.dwIndex != Exceptions::unknownIndex)
     {
@@ -692,7 +697,9 @@ auto main(int argc, const char* argv[]) -> int // NOLINT(bugprone-exception-esca
 
     connectionHandler.registerHandler<Messages::OpenMsg>(Messages::open, handleOpen);
 	connectionHandler.registerHandler<Messages::QuitMsg>(Messages::quit, handleClose);
-    connectionHandler.registerHandler<Messages::ExceptionMsg>(Messages::exception, handleException);
+    connectionHandler.registerHandler<Messages::ExceptionMsg>(Messages::exception, [&connection](const Messages::ExceptionMsg& msg) {
+        handleException(msg, connection.sendHistory());
+    });
 
     if (!connection.open()) {
         std::cerr << "[ABORTING: Failed to connect to the simulator]\n";